@@ -111,6 +111,7 @@ def check_dir(start_dir):
         'summator.xml',
         'tf.patch',
         'tftext.patch',
+        'uds.patch',
         'vehicle_images.txt',
         'bazel_rules_apple.patch',
         "pom.xml",
@@ -195,6 +196,7 @@ def check_func(start_dir):
         'summator.xml',
         'tf.patch',
         'tftext.patch',
+        'uds.patch',
         'zlib.LICENSE.txt',
         'bazel_rules_apple.patch',
         'yarn.lock',
@@ -0,0 +1,217 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "request_arena.hpp"
+#include "rest_parser.hpp"
+
+// Counts heap allocations made while request and response messages are deserialized or parsed,
+// filled like by inference and destroyed, with messages allocated on heap and on request arena.
+namespace {
+std::atomic<uint64_t> allocationsCount{0};
+}  // namespace
+
+void* operator new(size_t size) {
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace {
+
+struct Measurement {
+    double allocations = 0;
+    double microseconds = 0;
+};
+
+Measurement measure(uint32_t iterations, const std::function<void()>& function) {
+    uint64_t allocationsBefore = allocationsCount.load();
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    Measurement result;
+    result.allocations = static_cast<double>(allocationsCount.load() - allocationsBefore) / iterations;
+    result.microseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / 1000.0 / iterations;
+    return result;
+}
+
+void printComparison(const std::string& description, const Measurement& heap, const Measurement& arena) {
+    std::cout << description << std::endl
+              << "\theap:  " << heap.allocations << " allocations, " << heap.microseconds << " us per request" << std::endl
+              << "\tarena: " << arena.allocations << " allocations, " << arena.microseconds << " us per request" << std::endl;
+}
+
+// Output tensors metadata and contents as serialized by model instance
+void fillResponse(KFSResponse& response, uint32_t outputs, const std::string& content) {
+    response.set_model_name("model");
+    response.set_model_version("1");
+    response.set_id("request");
+    for (uint32_t i = 0; i < outputs; ++i) {
+        auto* output = response.add_outputs();
+        output->set_name("output_" + std::to_string(i));
+        output->set_datatype("FP32");
+        output->add_shape(1);
+        output->add_shape(content.size() / sizeof(float));
+        response.add_raw_output_contents(content);
+    }
+}
+
+KFSRequest prepareRequest(uint32_t inputs, uint32_t elements) {
+    KFSRequest request;
+    request.set_model_name("model");
+    request.set_id("request");
+    (*request.mutable_parameters())["priority"].set_int64_param(1);
+    std::vector<float> data(elements, 1.0);
+    for (uint32_t i = 0; i < inputs; ++i) {
+        auto* input = request.add_inputs();
+        input->set_name("input_" + std::to_string(i));
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(elements);
+        (*input->mutable_parameters())["binary_data_size"].set_int64_param(elements * sizeof(float));
+        request.add_raw_input_contents(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+        request.add_outputs()->set_name("output_" + std::to_string(i));
+    }
+    return request;
+}
+
+std::string prepareJson(uint32_t inputs, uint32_t elements) {
+    std::string json = R"({"id":"request","parameters":{"priority":1},"inputs":[)";
+    for (uint32_t i = 0; i < inputs; ++i) {
+        if (i > 0) {
+            json += ',';
+        }
+        json += R"({"name":"input_)" + std::to_string(i) + R"(","datatype":"FP32","shape":[1,)" + std::to_string(elements) + R"(],"data":[)";
+        for (uint32_t j = 0; j < elements; ++j) {
+            json += (j > 0) ? ",1.5" : "1.5";
+        }
+        json += "]}";
+    }
+    json += "]}";
+    return json;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "Heap allocations of KServe request and response messages allocated on heap and on protobuf arena");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("inputs",
+            "number of inputs and outputs in request",
+            cxxopts::value<uint32_t>()->default_value("4"),
+            "INPUTS")
+        ("elements",
+            "number of FP32 elements in each input and output",
+            cxxopts::value<uint32_t>()->default_value("1000"),
+            "ELEMENTS")
+        ("niter",
+            "number of iterations for each measurement",
+            cxxopts::value<uint32_t>()->default_value("10000"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t inputs = result->operator[]("inputs").as<uint32_t>();
+    const uint32_t elements = result->operator[]("elements").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0) {
+        std::cerr << "niter has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+    const std::string serializedRequest = prepareRequest(inputs, elements).SerializeAsString();
+    const std::string json = prepareJson(inputs, elements);
+    const std::string outputContent(elements * sizeof(float), '\0');
+    bool failed = false;
+
+    std::cout << "inputs: " << inputs << ", elements: " << elements << ", iterations: " << niter << std::endl;
+    // gRPC frontend deserializes request from wire format and serializes response
+    auto grpcHeap = measure(niter, [&]() {
+        KFSRequest request;
+        KFSResponse response;
+        failed |= !request.ParseFromString(serializedRequest);
+        fillResponse(response, request.inputs_size(), outputContent);
+    });
+    auto grpcArena = measure(niter, [&]() {
+        ovms::RequestArena arena;
+        auto* request = arena.create<KFSRequest>();
+        auto* response = arena.create<KFSResponse>();
+        failed |= !request->ParseFromString(serializedRequest);
+        fillResponse(*response, request->inputs_size(), outputContent);
+    });
+    printComparison("gRPC ModelInfer", grpcHeap, grpcArena);
+
+    // REST frontend parses json into request proto and fills response before converting it to json
+    auto restHeap = measure(niter, [&]() {
+        KFSRequest request;
+        KFSResponse response;
+        ovms::KFSRestParser parser;
+        failed |= !parser.parse(json.c_str(), json.size()).ok();
+        request.Swap(&parser.getProto());
+        fillResponse(response, request.inputs_size(), outputContent);
+    });
+    auto restArena = measure(niter, [&]() {
+        ovms::RequestArena arena;
+        auto* request = arena.create<KFSRequest>();
+        auto* response = arena.create<KFSResponse>();
+        ovms::KFSRestParser parser(arena.get());
+        failed |= !parser.parse(json.c_str(), json.size()).ok();
+        request->Swap(&parser.getProto());
+        fillResponse(*response, request->inputs_size(), outputContent);
+    });
+    printComparison("REST KServe infer", restHeap, restArena);
+    if (failed) {
+        std::cerr << "parsing request failed" << std::endl;
+        return EX_SOFTWARE;
+    }
+    return EX_OK;
+}
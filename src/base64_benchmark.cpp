@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "absl/strings/escaping.h"
+#include "base64_decoder.hpp"
+#include "benchmark_utils.hpp"
+#include "rest_utils.hpp"
+#include "status.hpp"
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "REST API base64 binary input decoding benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("size",
+            "size in bytes of each synthetic binary input",
+            cxxopts::value<uint32_t>()->default_value("150000"),
+            "SIZE")
+        ("batch",
+            "number of binary inputs decoded per request",
+            cxxopts::value<uint32_t>()->default_value("16"),
+            "BATCH")
+        ("niter",
+            "number of decoded requests",
+            cxxopts::value<uint32_t>()->default_value("100"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t size = result->operator[]("size").as<uint32_t>();
+    const uint32_t batch = result->operator[]("batch").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0 || batch == 0) {
+        std::cerr << "niter and batch have to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::mt19937 generator(42);
+    std::vector<std::string> inputs(batch);
+    std::vector<std::string> encodedInputs(batch);
+    for (uint32_t i = 0; i < batch; ++i) {
+        inputs[i].resize(size);
+        for (auto& byte : inputs[i]) {
+            byte = static_cast<char>(generator());
+        }
+        encodedInputs[i] = absl::Base64Escape(inputs[i]);
+    }
+
+    std::vector<std::string> decoded(batch);
+    for (uint32_t i = 0; i < batch; ++i) {
+        if (!ovms::decodeBase64(encodedInputs[i].data(), encodedInputs[i].size(), decoded[i]).ok() || decoded[i] != inputs[i]) {
+            std::cerr << "decoded input differs from original" << std::endl;
+            return EX_SOFTWARE;
+        }
+    }
+    // the way inputs were decoded before: encoded text copied out of json document, decoded into temporary string
+    double abslTime = ovms::measureMilliseconds(niter, [&encodedInputs, &decoded, batch]() {
+        for (uint32_t i = 0; i < batch; ++i) {
+            std::string encoded = encodedInputs[i];
+            std::string temporary;
+            absl::Base64Unescape(encoded, &temporary);
+            decoded[i].assign(temporary);
+        }
+    });
+    double decoderTime = ovms::measureMilliseconds(niter, [&encodedInputs, &decoded, batch]() {
+        for (uint32_t i = 0; i < batch; ++i) {
+            ovms::decodeBase64(encodedInputs[i].data(), encodedInputs[i].size(), decoded[i]);
+        }
+    });
+    std::cout << "iterations: " << niter << " batch: " << batch << " input size: " << size << " bytes" << std::endl;
+    std::cout << "absl with copies: " << abslTime << " ms, direct decoding: " << decoderTime << " ms" << std::endl;
+    return EX_OK;
+}
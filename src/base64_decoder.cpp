@@ -0,0 +1,186 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "base64_decoder.hpp"
+
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace ovms {
+namespace {
+constexpr uint8_t INVALID_DIGIT = 0xFF;
+
+constexpr std::array<uint8_t, 256> makeDecodeTable() {
+    std::array<uint8_t, 256> table{};
+    for (auto& value : table) {
+        value = INVALID_DIGIT;
+    }
+    const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (uint8_t i = 0; i < 64; ++i) {
+        table[static_cast<uint8_t>(alphabet[i])] = i;
+    }
+    return table;
+}
+
+constexpr auto DECODE_TABLE = makeDecodeTable();
+
+bool isWhitespace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// Decodes groups of four base64 digits until the first group containing any other character
+void decodeGroups(const char*& src, const char* end, char*& out) {
+    while (end - src >= 4) {
+        const uint32_t a = DECODE_TABLE[static_cast<uint8_t>(src[0])];
+        const uint32_t b = DECODE_TABLE[static_cast<uint8_t>(src[1])];
+        const uint32_t c = DECODE_TABLE[static_cast<uint8_t>(src[2])];
+        const uint32_t d = DECODE_TABLE[static_cast<uint8_t>(src[3])];
+        if ((a | b | c | d) >= 64) {
+            return;
+        }
+        const uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = static_cast<char>(group >> 16);
+        out[1] = static_cast<char>(group >> 8);
+        out[2] = static_cast<char>(group);
+        src += 4;
+        out += 3;
+    }
+}
+
+#if defined(__x86_64__)
+bool isAvx2Supported() {
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+/**
+     * @brief Decodes blocks of 32 base64 digits into 24 bytes each, until the first block containing any other character.
+     * Digits are validated and translated with nibble lookup tables, then packed with multiply-add instructions
+     * (W. Mula, D. Lemire, Faster Base64 Encoding and Decoding Using AVX2 Instructions, 2018).
+     */
+__attribute__((target("avx2"))) void decodeBlocksAvx2(const char*& src, const char* end, char*& out) {
+    // bit sets of character classes for low and high nibble, digit is valid when they have no common bit
+    const __m256i lowNibbleClasses = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i highNibbleClasses = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // offsets from character code to digit value indexed by high nibble, index 1 is used for '/'
+    const __m256i offsets = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i slash = _mm256_set1_epi8('/');
+    const __m256i mergePairs = _mm256_set1_epi32(0x01400140);
+    const __m256i mergeQuads = _mm256_set1_epi32(0x00011000);
+    const __m256i packLanes = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i packBlock = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+    while (end - src >= 32) {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), nibbleMask);
+        const __m256i lowNibbles = _mm256_and_si256(input, nibbleMask);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lowNibbleClasses, lowNibbles), _mm256_shuffle_epi8(highNibbleClasses, highNibbles))) {
+            return;
+        }
+        const __m256i isSlash = _mm256_cmpeq_epi8(input, slash);
+        const __m256i digits = _mm256_add_epi8(input, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(isSlash, highNibbles)));
+        // 4 x 6 bit digits -> 24 bit value in each 32 bit word
+        const __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(digits, mergePairs), mergeQuads);
+        const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, packLanes), packBlock);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(packed, 1));
+        src += 32;
+        out += 24;
+    }
+}
+#endif
+}  // namespace
+
+bool decodeBase64(const char* encoded, size_t encodedSize, char* destination, size_t& decodedSize) {
+    const char* src = encoded;
+    const char* end = encoded + encodedSize;
+    char* out = destination;
+    uint32_t group = 0;
+    int groupLength = 0;
+    while (src < end) {
+        if (groupLength == 0) {
+#if defined(__x86_64__)
+            if (isAvx2Supported()) {
+                decodeBlocksAvx2(src, end, out);
+            }
+#endif
+            decodeGroups(src, end, out);
+            if (src == end) {
+                break;
+            }
+        }
+        // whitespace, padding or end of text inside a group
+        const char c = *src;
+        const uint8_t value = DECODE_TABLE[static_cast<uint8_t>(c)];
+        if (value != INVALID_DIGIT) {
+            group = (group << 6) | value;
+            if (++groupLength == 4) {
+                out[0] = static_cast<char>(group >> 16);
+                out[1] = static_cast<char>(group >> 8);
+                out[2] = static_cast<char>(group);
+                out += 3;
+                group = 0;
+                groupLength = 0;
+            }
+        } else if (c == '=') {
+            break;
+        } else if (!isWhitespace(c)) {
+            return false;
+        }
+        ++src;
+    }
+    int padding = 0;
+    for (; src < end; ++src) {
+        if (*src == '=') {
+            ++padding;
+        } else if (!isWhitespace(*src)) {
+            return false;
+        }
+    }
+    if (padding != 0 && (groupLength == 0 || padding != 4 - groupLength)) {
+        return false;
+    }
+    switch (groupLength) {
+    case 1:
+        return false;
+    case 2:
+        *out++ = static_cast<char>(group >> 4);
+        break;
+    case 3:
+        *out++ = static_cast<char>(group >> 10);
+        *out++ = static_cast<char>(group >> 2);
+        break;
+    default:
+        break;
+    }
+    decodedSize = out - destination;
+    return true;
+}
+}  // namespace ovms
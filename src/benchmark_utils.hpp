@@ -0,0 +1,38 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ovms {
+
+/**
+ * @brief Runs function given number of times
+ *
+ * @return average time of single run in milliseconds
+ */
+template <typename Function>
+double measureMilliseconds(uint32_t iterations, Function function) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1000.0 / iterations;
+}
+
+}  // namespace ovms
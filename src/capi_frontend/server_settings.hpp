@@ -24,9 +24,16 @@ struct ServerSettingsImpl {
     uint32_t grpcPort = 9178;
     uint32_t restPort = 0;
     uint32_t grpcWorkers = 1;
+    bool grpcAsync = false;
     std::string grpcBindAddress = "0.0.0.0";
+    std::string grpcUdsPath;
     std::optional<uint32_t> restWorkers;
     std::string restBindAddress = "0.0.0.0";
+    std::string restUdsPath;
+    bool restPrettyJson = false;
+    bool allowSystemSharedMemory = false;
+    std::optional<uint32_t> imageDecodingThreads;
+    bool jpegScaledDecoding = false;
     bool metricsEnabled = false;
     std::string metricsList;
     std::string cpuExtensionLibraryPath;
@@ -44,6 +44,10 @@ void CLIParser::parse(int argc, char** argv) {
                 "Network interface address to bind to for the gRPC API",
                 cxxopts::value<std::string>()->default_value("0.0.0.0"),
                 "GRPC_BIND_ADDRESS")
+            ("grpc_uds_path",
+                "Path of unix domain socket the gRPC API listens on in addition to the TCP port. Set port to 0 to listen only on the unix domain socket",
+                cxxopts::value<std::string>(),
+                "GRPC_UDS_PATH")
             ("rest_port",
                 "REST server port, the REST server will not be started if rest_port is blank or set to 0",
                 cxxopts::value<uint32_t>()->default_value("0"),
@@ -52,14 +56,38 @@ void CLIParser::parse(int argc, char** argv) {
                 "Network interface address to bind to for the REST API",
                 cxxopts::value<std::string>()->default_value("0.0.0.0"),
                 "REST_BIND_ADDRESS")
+            ("rest_uds_path",
+                "Path of unix domain socket the REST API listens on in addition to rest_port. REST server is started when either of them is set",
+                cxxopts::value<std::string>(),
+                "REST_UDS_PATH")
             ("grpc_workers",
                 "Number of gRPC servers. Default 1. Increase for multi client, high throughput scenarios",
                 cxxopts::value<uint32_t>()->default_value("1"),
                 "GRPC_WORKERS")
+            ("grpc_async",
+                "Flag enabling asynchronous handling of Predict and ModelInfer gRPC calls. Inference is started without blocking a thread and grpc_workers sets the number of completion queue threads.",
+                cxxopts::value<bool>()->default_value("false"),
+                "GRPC_ASYNC")
             ("rest_workers",
                 "Number of worker threads in REST server - has no effect if rest_port is not set. Default value depends on number of CPUs. ",
                 cxxopts::value<uint32_t>(),
                 "REST_WORKERS")
+            ("allow_system_shared_memory",
+                "Flag enabling KServe system shared memory extension. Shared memory regions can be registered only by clients running on the same host and trusted by the server.",
+                cxxopts::value<bool>()->default_value("false"),
+                "ALLOW_SYSTEM_SHARED_MEMORY")
+            ("rest_pretty_json",
+                "Flag enabling indented KServe REST inference responses. By default they are written without whitespace.",
+                cxxopts::value<bool>()->default_value("false"),
+                "REST_PRETTY_JSON")
+            ("image_decoding_threads",
+                "Number of threads decoding and resizing batch of binary images of a single input, including request thread. Threads are shared by all requests. Default value depends on number of CPUs. Set to 1 to decode images sequentially.",
+                cxxopts::value<uint32_t>(),
+                "IMAGE_DECODING_THREADS")
+            ("jpeg_scaled_decoding",
+                "Flag enabling resize mode in which JPEG images larger than input resolution are decoded at 1/2, 1/4 or 1/8 scale before the final resize. Faster and uses less memory than decoding at full resolution, but results differ slightly.",
+                cxxopts::value<bool>()->default_value("false"),
+                "JPEG_SCALED_DECODING")
             ("log_level",
                 "serving log level - one of TRACE, DEBUG, INFO, WARNING, ERROR",
                 cxxopts::value<std::string>()->default_value("INFO"), "LOG_LEVEL")
@@ -95,7 +123,7 @@ void CLIParser::parse(int argc, char** argv) {
                 cxxopts::value<bool>()->default_value("false"),
                 "METRICS")
             ("metrics_list",
-                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active.",
+                "Comma separated list of metrics. If unset, only default metrics will be enabled. Default metrics: ovms_requests_success, ovms_requests_fail, ovms_request_time_us, ovms_streams, ovms_inference_time_us, ovms_wait_for_infer_req_time_us. When set, only the listed metrics will be enabled. Optional metrics: ovms_infer_req_queue_size, ovms_infer_req_active, ovms_shape_cache_hits, ovms_shape_cache_misses.",
                 cxxopts::value<std::string>()->default_value(""),
                 "METRICS_LIST")
             ("cpu_extension",
@@ -207,10 +235,22 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("rest_bind_address"))
         serverSettings->restBindAddress = result->operator[]("rest_bind_address").as<std::string>();
 
+    if (result->count("grpc_uds_path"))
+        serverSettings->grpcUdsPath = result->operator[]("grpc_uds_path").as<std::string>();
+
+    if (result->count("rest_uds_path"))
+        serverSettings->restUdsPath = result->operator[]("rest_uds_path").as<std::string>();
+
     serverSettings->grpcWorkers = result->operator[]("grpc_workers").as<uint32_t>();
+    serverSettings->grpcAsync = result->operator[]("grpc_async").as<bool>();
 
     if (result->count("rest_workers"))
         serverSettings->restWorkers = result->operator[]("rest_workers").as<uint32_t>();
+    serverSettings->restPrettyJson = result->operator[]("rest_pretty_json").as<bool>();
+    serverSettings->allowSystemSharedMemory = result->operator[]("allow_system_shared_memory").as<bool>();
+    if (result->count("image_decoding_threads"))
+        serverSettings->imageDecodingThreads = result->operator[]("image_decoding_threads").as<uint32_t>();
+    serverSettings->jpegScaledDecoding = result->operator[]("jpeg_scaled_decoding").as<bool>();
 
     if (result->count("batch_size"))
         modelsSettings->batchSize = result->operator[]("batch_size").as<std::string>();
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "compiled_model_cache.hpp"
+
+#include <sstream>
+
+namespace ovms {
+
+std::unique_ptr<CompiledModelVariant> CompiledModelCache::take(const std::string& key) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return nullptr;
+    }
+    auto variant = std::move(it->second->second);
+    entries.erase(it->second);
+    index.erase(it);
+    return variant;
+}
+
+void CompiledModelCache::put(const std::string& key, std::unique_ptr<CompiledModelVariant> variant) {
+    if (capacity == 0 || !variant) {
+        return;
+    }
+    take(key);
+    entries.emplace_front(key, std::move(variant));
+    index[key] = entries.begin();
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+void CompiledModelCache::clear() {
+    index.clear();
+    entries.clear();
+}
+
+std::string createShapesSignature(const std::map<std::string, Shape>& shapes) {
+    std::stringstream ss;
+    for (const auto& [name, shape] : shapes) {
+        ss << name << shape.toString() << ";";
+    }
+    return ss.str();
+}
+}  // namespace ovms
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <openvino/openvino.hpp>
+
+#include "ovinferrequestsqueue.hpp"
+#include "shape.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+/**
+     * @brief Model compiled for specific input shapes together with its own inference request pool
+     */
+struct CompiledModelVariant {
+    std::shared_ptr<ov::Model> model;
+    std::shared_ptr<ov::CompiledModel> compiledModel;
+    std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
+    tensor_map_t inputsInfo;
+    tensor_map_t outputsInfo;
+};
+
+/**
+     * @brief Keeps recently used compiled model variants keyed by input shapes signature.
+     *
+     * Variant currently used by model instance is not stored in cache. It is put back
+     * when model instance switches to other shapes. Least recently used variant is evicted
+     * when capacity is exceeded.
+     */
+class CompiledModelCache {
+    using entry_t = std::pair<std::string, std::unique_ptr<CompiledModelVariant>>;
+
+    size_t capacity;
+    std::list<entry_t> entries;
+    std::unordered_map<std::string, std::list<entry_t>::iterator> index;
+
+public:
+    CompiledModelCache(size_t capacity) :
+        capacity(capacity) {}
+
+    /**
+         * @brief Removes variant from cache and returns it
+         *
+         * @return variant or nullptr if key is not present
+         */
+    std::unique_ptr<CompiledModelVariant> take(const std::string& key);
+
+    /**
+         * @brief Stores variant as the most recently used, evicting the least recently used one if needed
+         */
+    void put(const std::string& key, std::unique_ptr<CompiledModelVariant> variant);
+
+    void clear();
+
+    size_t size() const { return entries.size(); }
+    size_t getCapacity() const { return capacity; }
+    bool contains(const std::string& key) const { return index.count(key) > 0; }
+};
+
+/**
+     * @brief Creates cache key out of input names and shapes
+     */
+std::string createShapesSignature(const std::map<std::string, Shape>& shapes);
+}  // namespace ovms
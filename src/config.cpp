@@ -15,12 +15,14 @@
 //*****************************************************************************
 #include "config.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <limits>
 #include <regex>
 #include <thread>
 
 #include <spdlog/spdlog.h>
+#include <sys/un.h>
 #include <sysexits.h>
 
 #include "capi_frontend/server_settings.hpp"
@@ -35,6 +37,7 @@ const uint MAX_PORT_NUMBER = std::numeric_limits<ushort>::max();
 
 const uint64_t DEFAULT_REST_WORKERS = AVAILABLE_CORES * 4.0;
 const uint64_t MAX_REST_WORKERS = 10'000;
+const uint32_t DEFAULT_IMAGE_DECODING_THREADS = std::min(AVAILABLE_CORES, 8u);
 
 Config& Config::parse(int argc, char** argv) {
     ovms::CLIParser p;
@@ -75,6 +78,10 @@ bool Config::check_hostname_or_ip(const std::string& input) {
     }
 }
 
+bool Config::check_unix_socket_path(const std::string& input) {
+    return !input.empty() && input.front() == '/' && input.size() < sizeof(sockaddr_un::sun_path);
+}
+
 bool Config::validate() {
     if (!configPath().empty() && (!modelName().empty() || !modelPath().empty())) {
         std::cerr << "Use either config_path or model_path with model_name" << std::endl;
@@ -105,11 +112,17 @@ bool Config::validate() {
         return false;
     }
 
-    if (this->serverSettings.restWorkers.has_value() && restPort() == 0) {
+    if (this->serverSettings.restWorkers.has_value() && restPort() == 0 && restUdsPath().empty()) {
         std::cerr << "rest_workers is set but rest_port is not set. rest_port is required to start rest servers" << std::endl;
         return false;
     }
 
+    // check image_decoding_threads value
+    if ((imageDecodingThreads() > AVAILABLE_CORES) || (imageDecodingThreads() < 1)) {
+        std::cerr << "image_decoding_threads count should be from 1 to CPU core count : " << AVAILABLE_CORES << std::endl;
+        return false;
+    }
+
     if (port() && (port() > MAX_PORT_NUMBER)) {
         std::cerr << "port number out of range from 0 to " << MAX_PORT_NUMBER << std::endl;
         return false;
@@ -121,7 +134,7 @@ bool Config::validate() {
     }
 
     // metrics on rest port
-    if (metricsEnabled() && restPort() == 0) {
+    if (metricsEnabled() && restPort() == 0 && restUdsPath().empty()) {
         std::cerr << "rest_port setting is missing, metrics are enabled on rest port" << std::endl;
         return false;
     }
@@ -142,8 +155,22 @@ bool Config::validate() {
         return false;
     }
 
-    // port and rest_port cannot be the same
-    if (port() == restPort()) {
+    // check unix domain socket paths:
+    if (!grpcUdsPath().empty() && check_unix_socket_path(grpcUdsPath()) == false) {
+        std::cerr << "grpc_uds_path has invalid format: absolute path shorter than " << sizeof(sockaddr_un::sun_path) << " characters expected." << std::endl;
+        return false;
+    }
+    if (!restUdsPath().empty() && check_unix_socket_path(restUdsPath()) == false) {
+        std::cerr << "rest_uds_path has invalid format: absolute path shorter than " << sizeof(sockaddr_un::sun_path) << " characters expected." << std::endl;
+        return false;
+    }
+    if (!grpcUdsPath().empty() && grpcUdsPath() == restUdsPath()) {
+        std::cerr << "grpc_uds_path and rest_uds_path cannot have the same values" << std::endl;
+        return false;
+    }
+
+    // port and rest_port cannot be the same, port 0 is allowed when gRPC listens only on unix domain socket
+    if (port() == restPort() && !(port() == 0 && !grpcUdsPath().empty())) {
         std::cerr << "port and rest_port cannot have the same values" << std::endl;
         return false;
     }
@@ -172,10 +199,17 @@ const std::string& Config::configPath() const { return this->modelsSettings.conf
 uint32_t Config::port() const { return this->serverSettings.grpcPort; }
 const std::string Config::cpuExtensionLibraryPath() const { return this->serverSettings.cpuExtensionLibraryPath; }
 const std::string Config::grpcBindAddress() const { return this->serverSettings.grpcBindAddress; }
+const std::string& Config::grpcUdsPath() const { return this->serverSettings.grpcUdsPath; }
 uint32_t Config::restPort() const { return this->serverSettings.restPort; }
 const std::string Config::restBindAddress() const { return this->serverSettings.restBindAddress; }
+const std::string& Config::restUdsPath() const { return this->serverSettings.restUdsPath; }
 uint32_t Config::grpcWorkers() const { return this->serverSettings.grpcWorkers; }
+bool Config::grpcAsync() const { return this->serverSettings.grpcAsync; }
 uint32_t Config::restWorkers() const { return this->serverSettings.restWorkers.value_or(DEFAULT_REST_WORKERS); }
+bool Config::restPrettyJson() const { return this->serverSettings.restPrettyJson; }
+bool Config::allowSystemSharedMemory() const { return this->serverSettings.allowSystemSharedMemory; }
+uint32_t Config::imageDecodingThreads() const { return this->serverSettings.imageDecodingThreads.value_or(DEFAULT_IMAGE_DECODING_THREADS); }
+bool Config::jpegScaledDecoding() const { return this->serverSettings.jpegScaledDecoding; }
 const std::string& Config::modelName() const { return this->modelsSettings.modelName; }
 const std::string& Config::modelPath() const { return this->modelsSettings.modelPath; }
 const std::string& Config::batchSize() const {
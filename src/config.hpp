@@ -80,6 +80,13 @@ public:
          */
     static bool check_hostname_or_ip(const std::string& input);
 
+    /**
+         * @brief checks if input is an absolute path short enough to be unix domain socket address
+         *
+         * @return bool
+         */
+    static bool check_unix_socket_path(const std::string& input);
+
     /**
          * @brief Get the config path
          * 
@@ -108,6 +115,13 @@ public:
          */
     const std::string grpcBindAddress() const;
 
+    /**
+         * @brief Get the gRPC unix domain socket path, empty when gRPC listens only on TCP port
+         * 
+         * @return const std::string&
+         */
+    const std::string& grpcUdsPath() const;
+
     /**
          * @brief Gets the REST port
          * 
@@ -122,6 +136,13 @@ public:
          */
     const std::string restBindAddress() const;
 
+    /**
+         * @brief Get the REST unix domain socket path, empty when REST listens only on TCP port
+         * 
+         * @return const std::string&
+         */
+    const std::string& restUdsPath() const;
+
     /**
          * @brief Gets the gRPC workers count
          * 
@@ -129,6 +150,13 @@ public:
          */
     uint32_t grpcWorkers() const;
 
+    /**
+         * @brief Checks if Predict and ModelInfer gRPC calls are handled asynchronously
+         * 
+         * @return bool
+         */
+    bool grpcAsync() const;
+
     /**
          * @brief Gets the rest workers count
          * 
@@ -136,6 +164,34 @@ public:
          */
     uint32_t restWorkers() const;
 
+    /**
+         * @brief Checks if KServe REST inference responses are indented
+         * 
+         * @return bool
+         */
+    bool restPrettyJson() const;
+
+    /**
+         * @brief Checks if KServe system shared memory regions can be registered
+         * 
+         * @return bool
+         */
+    bool allowSystemSharedMemory() const;
+
+    /**
+         * @brief Gets the number of threads decoding binary images of a single input
+         * 
+         * @return uint
+         */
+    uint32_t imageDecodingThreads() const;
+
+    /**
+         * @brief Checks if JPEG images larger than input resolution are decoded at reduced scale before resize
+         * 
+         * @return bool
+         */
+    bool jpegScaledDecoding() const;
+
     /**
          * @brief Get the model name
          * 
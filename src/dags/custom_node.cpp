@@ -57,7 +57,7 @@ Status CustomNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSe
     auto it = nodeSessionOutputs.emplace(sessionMetadata.getSessionKey(), std::move(sessionResults));
     if (!it.second) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to put node: {} session: {} results in node session outputs",
-            getName(), nodeSession.getSessionKey());
+            getName(), nodeSession.getSessionName());
         customNodeSession.release();
         return StatusCode::INTERNAL_ERROR;
     }
@@ -80,19 +80,19 @@ Status CustomNode::fetchResults(TensorWithSourceMap& outputs, session_key_t sess
             }
             const auto& realOutputName = this->getRealOutputName(output_name);
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Getting custom node output tensor with name: {}",
-                getName(), sessionKey, realOutputName);
+                getName(), session.getSessionName(), realOutputName);
 
             ov::Tensor resultTensor;
             auto status = session.fetchResult(realOutputName, resultTensor);
             if (!status.ok()) {
                 SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} Custom node output with name {} is missing",
-                    getName(), sessionKey, realOutputName);
+                    getName(), session.getSessionName(), realOutputName);
                 return StatusCode::NODE_LIBRARY_MISSING_OUTPUT;
             }
 
             outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(resultTensor))));
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared under alias {}",
-                getName(), sessionKey, realOutputName, output_name);
+                getName(), session.getSessionName(), realOutputName, output_name);
         }
     }
 
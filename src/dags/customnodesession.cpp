@@ -75,25 +75,25 @@ Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node
     this->timer->stop(EXECUTE);
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Custom node execution processing time for node {}; session: {} - {} ms",
         this->getName(),
-        this->getSessionKey(),
+        this->getSessionName(),
         this->timer->elapsed<std::chrono::microseconds>(EXECUTE) / 1000);
 
     // If result is not 0, it means execution has failed.
     // In this case shared library is responsible for cleaning up resources (memory).
     if (result != 0) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has failed custom node execution with return code: {}", getName(), getSessionKey(), result);
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has failed custom node execution with return code: {}", getName(), getSessionName(), result);
         notifyEndQueue.push({node, getSessionKey()});
         return StatusCode::NODE_LIBRARY_EXECUTION_FAILED;
     }
     // In other cases we are responsible of cleaning whatever is possible.
     if (outputTensors == nullptr) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has corrupted outputs handle", getName(), getSessionKey());
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has corrupted outputs handle", getName(), getSessionName());
         notifyEndQueue.push({node, getSessionKey()});
         return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED;
     }
 
     if (outputTensorsCount <= 0) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has corrupted number of outputs", getName(), getSessionKey());
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; has corrupted number of outputs", getName(), getSessionName());
         library.release(outputTensors, customNodeLibraryInternalManager);
         notifyEndQueue.push({node, getSessionKey()});
         return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED_COUNT;
@@ -107,12 +107,12 @@ Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node
         ov::Tensor resultTensor;
         auto result = this->createTensor(&outputTensors[i], resultTensor, library, customNodeLibraryInternalManager);
         if (outputTensors[i].name == nullptr) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; failed tensor conversion - missing output name", getName(), getSessionKey());
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; failed tensor conversion - missing output name", getName(), getSessionName());
             status = StatusCode::NODE_LIBRARY_OUTPUT_MISSING_NAME;
             continue;
         }
         if (!result.ok()) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; failed to convert {}: to tensor", getName(), getSessionKey(), outputTensors[i].name);
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; failed to convert {}: to tensor", getName(), getSessionName(), outputTensors[i].name);
             if (status.ok()) {
                 status = result;
             }
@@ -175,7 +175,7 @@ Status CustomNodeSession::createTensor(const struct CustomNodeTensor* tensor, ov
     if (precision == ov::element::Type_t::undefined) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; Unspecified output precision:{} from custom node tensor: {}",
             this->getName(),
-            this->getSessionKey(),
+            this->getSessionName(),
             precision,
             tensor->name);
         return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
@@ -194,7 +194,7 @@ Status CustomNodeSession::createTensor(const struct CustomNodeTensor* tensor, ov
         }
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node {}; session: {}; error: {}",
             this->getName(),
-            this->getSessionKey(),
+            this->getSessionName(),
             error.str());
         return StatusCode::NODE_LIBRARY_INVALID_CONTENT_SIZE;
     }
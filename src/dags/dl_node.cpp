@@ -33,8 +33,6 @@
 
 namespace ovms {
 
-const uint WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS = 1;
-
 Status DLNode::getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const {
     auto it = nodeOutputNameAlias.find(alias);
     const auto& modelOutputName = it != nodeOutputNameAlias.end() ? it->second : alias;
@@ -62,7 +60,7 @@ DLNode::DLNode(const std::string& nodeName,
 Status DLNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
     auto& nodeSession = getNodeSession(sessionKey);
     auto& dlNodeSession = static_cast<DLNodeSession&>(nodeSession);
-    return dlNodeSession.execute(notifyEndQueue, WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS, *this);
+    return dlNodeSession.execute(notifyEndQueue, *this);
 }
 
 Status DLNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) {
@@ -72,7 +70,7 @@ Status DLNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessio
     auto it = nodeSessionOutputs.emplace(sessionMetadata.getSessionKey(), std::move(sessionResults));
     if (!it.second) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to put node: {} session: {} results in node session outputs",
-            getName(), nodeSession.getSessionKey());
+            getName(), nodeSession.getSessionName());
         return StatusCode::INTERNAL_ERROR;
     }
     auto& metadataTensorResultsPair = it.first->second;
@@ -87,28 +85,30 @@ Status DLNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessio
 }
 
 Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, session_key_t sessionKey) {
-    ReleaseSessionGuard releaseSessionGuard(this->getNodeSession(sessionKey));
+    auto& nodeSession = this->getNodeSession(sessionKey);
+    const auto& sessionName = nodeSession.getSessionName();
+    ReleaseSessionGuard releaseSessionGuard(nodeSession);
     // Wait for tensor results
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Waiting for infer request to finish", getName(), sessionKey);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Waiting for infer request to finish", getName(), sessionName);
     try {
         inferRequest.wait();
     } catch (const ov::Exception& e) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} IE exception occured during infer request wait: {}", getName(), sessionKey, e.what());
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} IE exception occured during infer request wait: {}", getName(), sessionName, e.what());
         return StatusCode::INTERNAL_ERROR;
     } catch (std::exception& e) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} exception occured during infer request wait: {}", getName(), sessionKey, e.what());
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} exception occured during infer request wait: {}", getName(), sessionName, e.what());
         return StatusCode::INTERNAL_ERROR;
     }
-    double ovInferTime = this->getNodeSession(sessionKey).getTimer().elapsed<std::chrono::microseconds>(EXECUTE);
+    double ovInferTime = nodeSession.getTimer().elapsed<std::chrono::microseconds>(EXECUTE);
     OBSERVE_IF_ENABLED(model.getMetricReporter().inferenceTime, ovInferTime);
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} infer request finished", getName(), sessionKey);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} infer request finished", getName(), sessionName);
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Inference processing time for node {}; model name: {}; session: {} - {} ms",
         this->getName(),
         model.getName(),
-        sessionKey,
+        sessionName,
         ovInferTime / 1000);
 
-    static_cast<DLNodeSession&>(this->getNodeSession(sessionKey)).clearInputs();
+    static_cast<DLNodeSession&>(nodeSession).clearInputs();
 
     // Fill outputs map with result tensors. Fetch only those that are required in following nodes.
     for (const auto& node : this->next) {
@@ -121,19 +121,20 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
             try {
                 std::string realModelOutputName;
                 if (!getRealOutputName(model, output_name, &realModelOutputName).ok()) {
-                    SPDLOG_LOGGER_WARN(dag_executor_logger, "Node: {} session: {} Cannot find real model output name for alias: {}", getName(), sessionKey, output_name);
+                    SPDLOG_LOGGER_WARN(dag_executor_logger, "Node: {} session: {} Cannot find real model output name for alias: {}", getName(), sessionName, output_name);
                     return StatusCode::INTERNAL_ERROR;
                 }
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Getting tensor from model: {}, inferRequestStreamId: {}, tensorName: {}",
-                    getName(), sessionKey, modelName, sessionKey, realModelOutputName);
+                    getName(), sessionName, modelName, sessionName, realModelOutputName);
                 const auto tensor = inferRequest.get_tensor(realModelOutputName);
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Creating copy of tensor from model: {}, tensorName: {}",
-                    getName(), sessionKey, modelName, realModelOutputName);
+                    getName(), sessionName, modelName, realModelOutputName);
                 ov::Tensor copiedTensor;
                 auto status = tensorClone(copiedTensor, tensor);
                 if (!status.ok()) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Could not clone result tensor; node: {}; session: {}; model name: {}; output: {}",
                         getName(),
+                        sessionName,
                         this->modelName,
                         realModelOutputName);
                     return status;
@@ -141,18 +142,19 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
                 outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(copiedTensor))));
             } catch (const ov::Exception& e) {
                 Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session:{} Error during getting tensor {}; exception message: {}", getName(), sessionKey, status.string(), e.what());
+                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session:{} Error during getting tensor {}; exception message: {}", getName(), sessionName, status.string(), e.what());
                 return status;
             }
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionKey, output_name);
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionName, output_name);
         }
     }
     return StatusCode::OK;
 }
 
 void DLNode::release(session_key_t sessionId) {
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Release node: {} sessionKey: {}", getName(), sessionId);
-    getNodeSession(sessionId).release();
+    auto& nodeSession = getNodeSession(sessionId);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Release node: {} session: {}", getName(), nodeSession.getSessionName());
+    nodeSession.release();
 }
 bool DLNode::tryDisarm(const session_key_t& sessionKey, const uint microseconds) {
     return getNodeSession(sessionKey).tryDisarm(microseconds);
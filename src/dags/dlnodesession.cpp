@@ -60,7 +60,7 @@ ov::InferRequest& DLNodeSession::getInferRequest(const uint microseconds) {
     auto& inferRequestsQueue = this->model->getInferRequestsQueue();
     auto streamIdOpt = this->nodeStreamIdGuard->tryGetId(microseconds);
     if (!streamIdOpt) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to get streamId on already executed node: {} model: {} session: {}", getName(), getModelName(), getSessionKey());
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to get streamId on already executed node: {} model: {} session: {}", getName(), getModelName(), getSessionName());
         throw std::logic_error("Stream id is empty on already executed node");
     }
     return inferRequestsQueue.getInferRequest(streamIdOpt.value());
@@ -75,7 +75,7 @@ Status DLNodeSession::requestExecuteRequiredResources() {
         this->modelUnloadGuard);
 
     if (!status.ok()) {
-        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Getting model: {} instance failed for node: {} session: {} with: {}", getModelName(), getName(), getSessionKey(), status.string());
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Getting model: {} instance failed for node: {} session: {} with: {}", getModelName(), getName(), getSessionName(), status.string());
         return status;
     }
 
@@ -201,7 +201,7 @@ Status DLNodeSession::validate(const ov::Tensor& tensor, const TensorInfo& tenso
     return StatusCode::OK;
 }
 
-Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForStreamIdTimeoutMicroseconds, Node& node) {
+Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node) {
     OVMS_PROFILE_FUNCTION();
     Status status;
     if (this->nodeStreamIdGuard == nullptr) {
@@ -211,9 +211,12 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
             return status;
         }
     }
-    auto streamIdOpt = this->nodeStreamIdGuard->tryGetId(waitForStreamIdTimeoutMicroseconds);
+    // when no stream is idle, pipeline gets notified once stream is assigned to this session
+    auto streamIdOpt = this->nodeStreamIdGuard->tryGetIdOrNotify([&notifyEndQueue, &node, sessionKey = getSessionKey()]() {
+        notifyEndQueue.push({node, sessionKey, PipelineEvent::Type::STREAM_ID_ASSIGNED});
+    });
     if (!streamIdOpt) {
-        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Could not acquire stream Id right away", getName());
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Could not acquire stream Id right away, waiting for stream assignment", getName());
         return StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET;
     }
     auto& inferRequestsQueue = this->model->getInferRequestsQueue();
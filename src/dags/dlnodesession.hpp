@@ -59,7 +59,7 @@ private:
 public:
     Status prepareInputsAndModelForInference();
     Status validate(const ov::Tensor& tensor, const TensorInfo& info);
-    Status execute(PipelineEventQueue& notifyEndQueue, uint waitForStreamIdTimeoutMicroseconds, Node& node);
+    Status execute(PipelineEventQueue& notifyEndQueue, Node& node);
     Status executeInference(PipelineEventQueue& notifyEndQueue, ov::InferRequest&, Node& node);
     Status setInputsForInference(ov::InferRequest& inferRequest);
     Status getRealInputName(const std::string& alias, std::string* result) const;
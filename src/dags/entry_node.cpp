@@ -45,7 +45,7 @@ const std::string ENTRY_NODE_NAME = "request";
 template <typename RequestType>
 Status EntryNode<RequestType>::execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) {
     OVMS_PROFILE_FUNCTION();
-    notifyEndQueue.push(NodeSessionKeyPair(*this, sessionId));
+    notifyEndQueue.push({*this, sessionId});
     return StatusCode::OK;
 }
 
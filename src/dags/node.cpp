@@ -60,20 +60,18 @@ Node::Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount,
 
 Status Node::fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs) {
     OVMS_PROFILE_FUNCTION();
-    auto it = nodeSessions.find(sessionId);
-
-    if (it == nodeSessions.end()) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Could not find session: {} for node: {}", sessionId, getName());
+    if (sessionId >= nodeSessions.size() || !nodeSessions[sessionId]) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Could not find session with key: {} for node: {}", sessionId, getName());
         return StatusCode::UNKNOWN_ERROR;
     }
-    auto& nodeSession = it->second;
+    auto& nodeSession = nodeSessions[sessionId];
     auto status = fetchResults(*nodeSession, nodeSessionOutputs);
     if (status.ok() && demultiplexCount) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will demultiply node: {} outputs with demultiplyCount: {}", getName(), demultiplyCountSettingToString(demultiplexCount));
         status = demultiplyOutputs(nodeSessionOutputs);
     }
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will remove node: {} session: {}", getName(), sessionId);
-    nodeSessions.erase(sessionId);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will remove node: {} session: {}", getName(), nodeSession->getSessionName());
+    nodeSessions[sessionId].reset();
     return status;
 }
 
@@ -104,7 +102,7 @@ Status Node::setInputs(const Node& dependency, TensorWithSourceMap& inputs, Node
     const auto& mapping_for_dependency = this->getMappingByDependency(dependency);
     NodeSession* nodeSession = getNodeSession(metadata);
     if (!nodeSession) {
-        SPDLOG_ERROR("Failed to get node session for node: {}, session key: {}", getName(), metadata.getSessionKey());
+        SPDLOG_ERROR("Failed to get node session for node: {}, session: {}", getName(), metadata.toString());
         return StatusCode::INTERNAL_ERROR;
     }
     session_id_t shardId;
@@ -140,16 +138,24 @@ Status Node::setInputs(const Node& dependency, TensorWithSourceMap& inputs, Node
             return status;
         }
     }
-    return nodeSession->notifyFinishedDependency();
+    auto status = nodeSession->notifyFinishedDependency();
+    if (status.ok() && nodeSession->isReady()) {
+        // dependencies counter of the session reaches zero only once
+        readySessions.emplace_back(nodeSession->getSessionKey());
+    }
+    return status;
 }
 
 NodeSession& Node::getNodeSession(const session_key_t& sessionKey) const {
-    auto it = nodeSessions.find(sessionKey);
-    if (it == nodeSessions.end()) {
-        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to get non-existing node: {} session: {}.", getName(), sessionKey);
+    if (sessionKey >= nodeSessions.size() || !nodeSessions[sessionKey]) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to get non-existing node: {} session with key: {}.", getName(), sessionKey);
         throw std::runtime_error("Tried to get non existing session");
     }
-    return *it->second;
+    return *nodeSessions[sessionKey];
+}
+
+const std::string& Node::getSessionName(const session_key_t& sessionKey) const {
+    return getNodeSession(sessionKey).getSessionName();
 }
 
 NodeSession* Node::getNodeSession(const NodeSessionMetadata& metadata) {
@@ -158,19 +164,22 @@ NodeSession* Node::getNodeSession(const NodeSessionMetadata& metadata) {
         try {
             sessionKey = metadata.getSessionKey(gatherFrom.value());
         } catch (const std::exception& e) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to create collapsed metadata session key for node: {}, incomming session key: {}",
-                getName(), metadata.getSessionKey());
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to create collapsed metadata session key for node: {}, incomming session: {}",
+                getName(), metadata.toString());
             return nullptr;
         }
     } else {
         sessionKey = metadata.getSessionKey();
     }
-    auto it = nodeSessions.find(sessionKey);
-    if (it != nodeSessions.end()) {
-        return it->second.get();
+    if (sessionKey >= nodeSessions.size()) {
+        nodeSessions.resize(sessionKey + 1);
+    } else if (nodeSessions[sessionKey]) {
+        return nodeSessions[sessionKey].get();
+    }
+    if (dag_executor_logger->level() <= spdlog::level::debug) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will create new session: {} ({}) for node: {}",
+            sessionKey, metadata.toString(), getName());
     }
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will create new session: {} for node: {}",
-        sessionKey, getName());
     NodeSessionMetadata newSessionMetadata = metadata;
     CollapseDetails collapsingDetails;
     if (gatherFrom) {
@@ -181,24 +190,18 @@ NodeSession* Node::getNodeSession(const NodeSessionMetadata& metadata) {
             return nullptr;
         }
     }
-    std::unique_ptr<NodeSession> nodeSession = createNodeSession(newSessionMetadata, collapsingDetails);
-    auto emplacePair = nodeSessions.emplace(sessionKey, std::move(nodeSession));
-    return emplacePair.first->second.get();
+    nodeSessions[sessionKey] = createNodeSession(newSessionMetadata, collapsingDetails);
+    return nodeSessions[sessionKey].get();
 }
 
 std::unique_ptr<NodeSession> Node::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) {
     return std::make_unique<NodeSession>(metadata, getName(), previous.size(), collapsingDetails);
 }
 
-std::vector<session_key_t> Node::getReadySessions() const {
-    std::vector<session_key_t> readySessions;
-    for (auto& [sessionKey, nodeSession] : nodeSessions) {
-        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Checking readiness of node: {} session: {}", getName(), nodeSession->getSessionKey());
-        if (nodeSession->isReady()) {
-            readySessions.emplace_back(sessionKey);
-        }
-    }
-    return readySessions;
+std::vector<session_key_t> Node::takeReadySessions() {
+    std::vector<session_key_t> sessions;
+    sessions.swap(readySessions);
+    return sessions;
 }
 
 Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
@@ -207,7 +210,10 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} called demultiplyOutputs but node does not have demultiplexCount set", getName());
         return StatusCode::INTERNAL_ERROR;
     }
-    auto& [metadata, tensorMap] = nodeSessionOutputs.begin()->second;
+    // session keys of subsessions may overlap with key of demultiplexed session, so it is taken out first
+    SessionResult demultiplexedResult = std::move(nodeSessionOutputs.begin()->second);
+    nodeSessionOutputs.erase(nodeSessionOutputs.begin());
+    auto& [metadata, tensorMap] = demultiplexedResult;
     auto firstTensorShape = tensorMap.begin()->second.getActualTensor().get_shape();
     uint32_t resultsDemultiplyCount = firstTensorShape[0];
     if (firstTensorShape[0] > DEMULTIPLY_LIMIT) {
@@ -223,6 +229,7 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} failed to generate subsessions due to error: {}", getName(), e.what());
         return StatusCode::INTERNAL_ERROR;
     }
+    nodeSessionOutputs.reserve(newSessionMetadatas.size());
     for (auto& [tensorName, tensorWithSource] : tensorMap) {
         auto& tensor = tensorWithSource.getActualTensor();
         OVMS_PROFILE_SCOPE("Demultiply Tensor");
@@ -239,7 +246,6 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
         }
         if (resultsDemultiplyCount == 0) {
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} has no results. Dynamic demultiplexer with demultiply == 0 is not supported yet.", this->getName());
-            nodeSessionOutputs.erase(metadata.getSessionKey());
             return StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS;
         }
 
@@ -264,7 +270,6 @@ Status Node::demultiplyOutputs(SessionResults& nodeSessionOutputs) {
             }
         }
     }
-    nodeSessionOutputs.erase(metadata.getSessionKey());
     return StatusCode::OK;
 }
 
@@ -34,7 +34,6 @@
 namespace ovms {
 
 using TensorNames = std::vector<std::string>;
-using session_key_t = std::string;
 
 class NodeSession;
 class NodeSessionMetadata;
@@ -47,8 +46,11 @@ protected:
     std::vector<std::reference_wrapper<Node>> previous;
     std::vector<std::reference_wrapper<Node>> next;
 
-    // Tensors ready and waiting for execution
-    std::unordered_map<session_key_t, std::unique_ptr<NodeSession>> nodeSessions;
+    // Tensors ready and waiting for execution, indexed by session key
+    std::vector<std::unique_ptr<NodeSession>> nodeSessions;
+
+    // Sessions which got all dependencies finished and were not taken for execution yet
+    std::vector<session_key_t> readySessions;
 
     // Input/Output name mapping and list of required inputs from previous nodes
     std::unordered_map<std::string, Aliases> tensorNamesMapping;
@@ -86,7 +88,10 @@ public:
         return tensorNamesMapping.at(dependency.getName());
     }
 
-    std::vector<session_key_t> getReadySessions() const;
+    /**
+     * @brief Returns sessions which became ready since previous call, each session is returned once
+     */
+    std::vector<session_key_t> takeReadySessions();
     const std::vector<std::reference_wrapper<Node>>& getNextNodes() {
         return next;
     }
@@ -96,6 +101,7 @@ public:
     static void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs);
 
     NodeSession* getNodeSession(const NodeSessionMetadata& metadata);
+    const std::string& getSessionName(const session_key_t& sessionKey) const;
 
 protected:
     NodeSession& getNodeSession(const session_key_t& sessionKey) const;
@@ -45,6 +45,7 @@ static std::unique_ptr<NodeInputHandler> createNodeInputHandler(uint32_t inputsC
 NodeSession::NodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails) :
     metadata(metadata),
     sessionKey(metadata.getSessionKey()),
+    sessionName(metadata.toString()),
     nodeName(nodeName),
     timer(std::make_unique<Timer<TIMER_END>>()),
     inputHandler(createNodeInputHandler(inputsCount, collapsingDetails)),
@@ -52,7 +53,7 @@ NodeSession::NodeSession(const NodeSessionMetadata& metadata, const std::string&
 
 bool NodeSession::isReady() const {
     bool isReady = inputHandler->isReady();
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "node: {} session: {} isReady: {}", getName(), getSessionKey(), isReady);
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "node: {} session: {} isReady: {}", getName(), getSessionName(), isReady);
     return isReady;
 }
 
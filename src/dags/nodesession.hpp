@@ -38,6 +38,8 @@ enum : unsigned int {
 class NodeSession {
     NodeSessionMetadata metadata;
     session_key_t sessionKey;
+    // keys are indexes unique only within a node, so logs identify sessions by name
+    const std::string sessionName;
     const std::string& nodeName;
 
 protected:
@@ -52,6 +54,7 @@ public:
     Status setInput(const std::string& inputName, TensorWithSource& tensor, session_id_t shardId);
     const NodeSessionMetadata& getNodeSessionMetadata() const;
     const session_key_t& getSessionKey() const { return sessionKey; }
+    const std::string& getSessionName() const { return sessionName; }
     bool isReady() const;
     virtual void release() {}
     virtual bool tryDisarm(uint microseconds) { return true; }
@@ -34,7 +34,8 @@ NodeSessionMetadata::NodeSessionMetadata(ExecutionContext context) :
 NodeSessionMetadata::NodeSessionMetadata(const std::unordered_map<std::string, std::tuple<session_id_t, session_id_t>>& details, const std::vector<std::string>& sessionsLevels, ExecutionContext context) :
     details(details),
     sessionsLevels(sessionsLevels),
-    context(context) {}
+    context(context),
+    sessionKey(createSessionKey()) {}
 
 std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const std::string& nodeName, session_id_t subsessionSize) const {
     if (nodeName.size() == 0) {
@@ -53,7 +54,7 @@ std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const
     for (auto& meta : metas) {
         meta.details.insert({nodeName, {counter, subsessionSize}});
         meta.sessionsLevels.push_back(nodeName);
-        meta.cached = false;
+        meta.sessionKey = this->sessionKey * subsessionSize + counter;
         ++counter;
     }
     SPDLOG_LOGGER_TRACE(dag_executor_logger, "Generated subsession levels: {}",
@@ -66,10 +67,10 @@ std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const
     return metas;
 }
 
-std::string NodeSessionMetadata::createSessionKey(const std::set<std::string>& ignoredNodeNames) const {
-    if (details.size() == 0) {
-        return "";
-    }
+// Session key is index of the session among all sessions with the same subsession levels,
+// counted as in multidimensional array with subsession sizes as dimensions. Pipeline definition
+// guarantees that sizes of subsessions are the same for all sessions on given level.
+session_key_t NodeSessionMetadata::createSessionKey(const std::set<std::string>& ignoredNodeNames) const {
     if (std::any_of(ignoredNodeNames.begin(),
             ignoredNodeNames.end(),
             [this](auto& ignoredNodeName) {
@@ -81,43 +82,37 @@ std::string NodeSessionMetadata::createSessionKey(const std::set<std::string>& i
             })) {
         throw std::logic_error("Tried to create session key ignoring non-existing subsession");
     }
-    std::stringstream ss;
-    size_t j = 0;
-    for (int32_t i = sessionsLevels.size() - 1; i >= 0; --i, ++j) {
-        if ((ignoredNodeNames.size() > 0) &&
-            (ignoredNodeNames.size() > j) &&
-            (sessionsLevels.size() >= ignoredNodeNames.size()) &&
-            (ignoredNodeNames.find(sessionsLevels[i]) == ignoredNodeNames.end())) {
+    const size_t keptLevelsCount = sessionsLevels.size() - ignoredNodeNames.size();
+    for (size_t i = keptLevelsCount; i < sessionsLevels.size(); ++i) {
+        if (ignoredNodeNames.find(sessionsLevels[i]) == ignoredNodeNames.end()) {
             SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to collapse sessions not in LIFO order. Should collapse: {} first", sessionsLevels[i]);
             throw std::logic_error("Cannot collapse sessions not in LIFO order");
-        } else {
-            if (j < ignoredNodeNames.size()) {
-                continue;
-            }
-            if (ss.tellp() > 0) {
-                ss << "_";
-            }
-            ss << sessionsLevels[i] << "_" << std::get<0>(details.at(sessionsLevels[i]));
-        }
-        if (i == 0) {
-            break;
         }
     }
-    return ss.str();
+    session_key_t key = 0;
+    for (size_t i = 0; i < keptLevelsCount; ++i) {
+        const auto& [id, sessionSize] = details.at(sessionsLevels[i]);
+        key = key * sessionSize + id;
+    }
+    return key;
 }
 
-std::string NodeSessionMetadata::getSessionKey(const std::set<std::string>& ignoredNodeNames) const {
-    // if set not empty then we need to regenerate the cache and mark it as not cached
-    // we don't want to store previous set but we want to limit recreation of the key
-    if (ignoredNodeNames.size() != 0) {
-        return createSessionKey(ignoredNodeNames);
+session_key_t NodeSessionMetadata::getSessionKey(const std::set<std::string>& ignoredNodeNames) const {
+    if (ignoredNodeNames.size() == 0) {
+        return this->sessionKey;
     }
-    if (cached) {
-        return this->cachedSessionKey;
+    return createSessionKey(ignoredNodeNames);
+}
+
+std::string NodeSessionMetadata::toString() const {
+    std::stringstream ss;
+    for (auto it = sessionsLevels.rbegin(); it != sessionsLevels.rend(); ++it) {
+        if (ss.tellp() > 0) {
+            ss << "_";
+        }
+        ss << *it << "_" << std::get<0>(details.at(*it));
     }
-    cached = true;
-    this->cachedSessionKey = createSessionKey(ignoredNodeNames);
-    return this->cachedSessionKey;
+    return ss.str();
 }
 
 std::pair<NodeSessionMetadata, CollapseDetails> NodeSessionMetadata::getCollapsedSessionMetadata(const std::set<std::string>& ignoredNodeNames) const {
@@ -161,6 +156,7 @@ std::pair<NodeSessionMetadata, CollapseDetails> NodeSessionMetadata::getCollapse
             newMeta.sessionsLevels.emplace_back(sessionLevel);
         }
     }
+    newMeta.sessionKey = createSessionKey(ignoredNodeNames);
     return {newMeta, std::move(collapsingDetails)};
 }
 
@@ -27,9 +27,6 @@
 
 namespace ovms {
 
-using session_id_t = uint32_t;
-using session_key_t = std::string;
-
 struct CollapseDetails {
     std::vector<std::string> collapsedSessionNames;
     std::vector<session_id_t> collapsedSessionSizes;
@@ -39,8 +36,7 @@ class NodeSessionMetadata {
     std::unordered_map<std::string, std::tuple<session_id_t, session_id_t>> details;
     std::vector<std::string> sessionsLevels;
     ExecutionContext context;
-    mutable std::string cachedSessionKey = "";
-    mutable bool cached = false;
+    session_key_t sessionKey = 0;
 
 protected:
     NodeSessionMetadata();
@@ -49,13 +45,17 @@ public:
     NodeSessionMetadata(const ExecutionContext context);
     NodeSessionMetadata(const std::unordered_map<std::string, std::tuple<session_id_t, session_id_t>>& details, const std::vector<std::string>& sessionLevels, const ExecutionContext context);
     std::vector<NodeSessionMetadata> generateSubsessions(const std::string& nodeName, session_id_t subsessionSize) const;
-    std::string getSessionKey(const std::set<std::string>& ignoredNodeNames = {}) const;
+    session_key_t getSessionKey(const std::set<std::string>& ignoredNodeNames = {}) const;
     std::pair<NodeSessionMetadata, CollapseDetails> getCollapsedSessionMetadata(const std::set<std::string>& ignoredNodeNames) const;
     session_id_t getSubsessionSize(const std::string& subsessionName) const;
     session_id_t getShardId(const std::set<std::string>& collapsedNames = {}) const;
     ExecutionContext getContext() const;
+    /**
+     * @brief Human readable session name built from subsession levels, intended for logging only
+     */
+    std::string toString() const;
 
 private:
-    std::string createSessionKey(const std::set<std::string>& ignoredNodeNames = {}) const;
+    session_key_t createSessionKey(const std::set<std::string>& ignoredNodeNames = {}) const;
 };
 }  // namespace ovms
@@ -15,8 +15,10 @@
 //*****************************************************************************
 #include "nodestreamidguard.hpp"
 
-#include <future>
+#include <atomic>
+#include <chrono>
 #include <optional>
+#include <utility>
 
 #include "../logging.hpp"
 #include "../model_metric_reporter.hpp"
@@ -27,44 +29,93 @@ namespace ovms {
 
 NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
     inferRequestsQueue_(inferRequestsQueue),
-    futureStreamId(inferRequestsQueue_.getIdleStream()),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
+    this->streamId = this->inferRequestsQueue_.tryToGetIdleStream();
+    if (this->streamId) {
+        INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    }
 }
 
 NodeStreamIdGuard::~NodeStreamIdGuard() {
     if (!this->disarmed) {
-        if (!this->streamId) {
-            SPDLOG_DEBUG("Trying to disarm stream Id that is not needed anymore...");
-            this->streamId = this->futureStreamId.get();
-            INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+        takeAssignedStream();
+        if (this->streamId) {
+            SPDLOG_DEBUG("Returning streamId: {}", this->streamId.value());
+            DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+            this->inferRequestsQueue_.returnStream(this->streamId.value());
         }
-        SPDLOG_DEBUG("Returning streamId: {}", this->streamId.value());
-        DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
-        this->inferRequestsQueue_.returnStream(this->streamId.value());
         DECREMENT_IF_ENABLED(this->reporter.currentRequests);
     }
 }
 
+void NodeStreamIdGuard::onStreamAssigned(int streamId) {
+    this->assignedStreamId = streamId;
+    this->streamAssigned.store(true, std::memory_order_release);
+    this->onStreamAssignedNotification();
+}
+
+void NodeStreamIdGuard::takeAssignedStream() {
+    if (!this->waiting) {
+        return;
+    }
+    // after unlinking, assigned stream id cannot change anymore
+    this->inferRequestsQueue_.removeIdleStreamWaiter(*this);
+    this->waiting = false;
+    this->onStreamAssignedNotification = nullptr;
+    if (this->assignedStreamId) {
+        this->streamId = this->assignedStreamId;
+        this->assignedStreamId = std::nullopt;
+        this->streamAssigned.store(false, std::memory_order_relaxed);
+        INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    }
+}
+
 std::optional<int> NodeStreamIdGuard::tryGetId(const uint microseconds) {
     OVMS_PROFILE_FUNCTION();
+    takeAssignedStream();
     if (!this->streamId) {
-        if (std::future_status::ready == this->futureStreamId.wait_for(std::chrono::microseconds(microseconds))) {
-            this->streamId = this->futureStreamId.get();
+        this->streamId = this->inferRequestsQueue_.tryToGetIdleStream(std::chrono::microseconds(microseconds));
+        if (this->streamId) {
             INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
         }
     }
     return this->streamId;
 }
 
+std::optional<int> NodeStreamIdGuard::tryGetIdOrNotify(std::function<void()> onStreamAssigned) {
+    OVMS_PROFILE_FUNCTION();
+    // guard which is still waiting keeps its place in line and notification registered earlier
+    if (this->waiting && !this->streamAssigned.load(std::memory_order_acquire)) {
+        return std::nullopt;
+    }
+    takeAssignedStream();
+    if (this->streamId) {
+        return this->streamId;
+    }
+    // set before linking since stream can be assigned before tryToGetIdleStream returns
+    this->onStreamAssignedNotification = std::move(onStreamAssigned);
+    this->waiting = true;
+    this->streamId = this->inferRequestsQueue_.tryToGetIdleStream(*this);
+    if (this->streamId) {
+        INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+        this->waiting = false;
+        this->onStreamAssignedNotification = nullptr;
+    }
+    return this->streamId;
+}
+
 bool NodeStreamIdGuard::tryDisarm(const uint microseconds) {
-    if (std::future_status::ready == this->futureStreamId.wait_for(std::chrono::microseconds(microseconds))) {
-        this->streamId = this->futureStreamId.get();
-        SPDLOG_DEBUG("Returning streamId:", this->streamId.value());
+    // stream is no longer needed, there is no need to wait for it
+    takeAssignedStream();
+    if (this->streamId) {
+        SPDLOG_DEBUG("Returning streamId: {}", this->streamId.value());
+        DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
         this->inferRequestsQueue_.returnStream(this->streamId.value());
-        DECREMENT_IF_ENABLED(this->reporter.currentRequests);
-        this->disarmed = true;
+        this->streamId = std::nullopt;
     }
+    DECREMENT_IF_ENABLED(this->reporter.currentRequests);
+    this->disarmed = true;
     return this->disarmed;
 }
 
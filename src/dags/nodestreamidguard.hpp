@@ -15,26 +15,39 @@
 //*****************************************************************************
 #pragma once
 
-#include <future>
+#include <atomic>
+#include <functional>
 #include <optional>
 
-namespace ovms {
-class OVInferRequestsQueue;
+#include "../queue.hpp"
 
+namespace ovms {
 class ModelMetricReporter;
 class OVInferRequestsQueue;
 
-struct NodeStreamIdGuard {
+struct NodeStreamIdGuard : private IdleStreamWaiter {
     NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
     ~NodeStreamIdGuard();
 
     std::optional<int> tryGetId(const uint microseconds = 1);
+    /**
+     * @brief Gets stream id without waiting. If none is idle, the guard is queued for the next returned stream
+     * and onStreamAssigned is called from the thread returning it, after which tryGetId returns the stream.
+     * Calling it again while still queued keeps the place in line and the notification registered first.
+     */
+    std::optional<int> tryGetIdOrNotify(std::function<void()> onStreamAssigned);
     bool tryDisarm(const uint microseconds = 1);
 
 private:
+    void onStreamAssigned(int streamId) override;
+    void takeAssignedStream();
+
     OVInferRequestsQueue& inferRequestsQueue_;
-    std::future<int> futureStreamId;
     std::optional<int> streamId = std::nullopt;
+    bool waiting = false;
+    std::function<void()> onStreamAssignedNotification;
+    std::optional<int> assignedStreamId = std::nullopt;
+    std::atomic<bool> streamAssigned{false};
     bool disarmed = false;
     ModelMetricReporter& reporter;
 };
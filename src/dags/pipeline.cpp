@@ -31,7 +31,8 @@
 
 namespace ovms {
 
-using DeferredNodeSessions = std::vector<std::pair<std::reference_wrapper<Node>, session_key_t>>;
+// Node sessions waiting for stream id assignment
+using DeferredNodeSessions = std::set<std::pair<Node*, session_key_t>>;
 
 Pipeline::~Pipeline() = default;
 
@@ -69,20 +70,11 @@ inline static void setFailIfNotFailEarlier(ovms::Status& earlierStatusCode, ovms
     }
 }
 
-#define IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE \
-    if (!firstErrorStatus.ok()) {                                                       \
-        if (finishedSessions.size() == startedSessions.size()) {                        \
-            break;                                                                      \
-        } else {                                                                        \
-            continue;                                                                   \
-        }                                                                               \
-    }
-
-#define CHECK_AND_LOG_ERROR(NODE)                                                                                                          \
+#define CHECK_AND_LOG_ERROR(NODE, SESSION_NAME)                                                                                            \
     if (!status.ok()) {                                                                                                                    \
         setFailIfNotFailEarlier(firstErrorStatus, status);                                                                                 \
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} session: {} failed with ret code: {}, error message: {}", \
-            getName(), NODE.getName(), sessionKey, status.getCode(), status.string());                                                     \
+            getName(), NODE.getName(), SESSION_NAME, status.getCode(), status.string());                                                   \
     }
 
 Status Pipeline::execute(ExecutionContext context) {
@@ -94,10 +86,11 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
 
-    PipelineEventQueue finishedNodeQueue;
+    PipelineEventQueue pipelineEventQueue;
     ovms::Status firstErrorStatus{ovms::StatusCode::OK};
-    std::set<std::string> startedSessions;
-    std::set<std::string> finishedSessions;
+    // each started node session either sends exactly one finished event or gets disarmed while deferred
+    size_t startedSessionsCount = 0;
+    size_t finishedSessionsCount = 0;
     NodeSessionMetadata meta(context);
     auto* entryNodeSession = entry.getNodeSession(meta);
     if (!entryNodeSession) {
@@ -105,176 +98,120 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
     auto entrySessionKey = meta.getSessionKey();
-    startedSessions.emplace(entry.getName() + entrySessionKey);
-    ovms::Status status = entry.execute(entrySessionKey, finishedNodeQueue);  // first node will triger first message
+    ++startedSessionsCount;
+    ovms::Status status = entry.execute(entrySessionKey, pipelineEventQueue);  // first node will triger first message
     if (!status.ok()) {
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} failed with: {}",
             getName(), entry.getName(), status.string());
         return status;
     }
     DeferredNodeSessions deferredNodeSessions;
-    const uint WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS = 5000;
-    const uint WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS = 500;
-    // process finished session nodes and if no one is finished check if any node session with deferred execution
-    // has necessary resources already
-    while (true) {
-        spdlog::trace("Pipeline: {} waiting for message that node finished.", getName());
+    // node session which cannot get stream id right away is deferred, and stream returned to the model
+    // infer requests queue is assigned to it later, what is signaled through pipeline event queue
+    auto executeNodeSession = [&](Node& node, const session_key_t& sessionKey) {
+        status = node.execute(sessionKey, pipelineEventQueue);
+        if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} deferred until stream id is assigned", node.getName(), node.getSessionName(sessionKey));
+            deferredNodeSessions.emplace(&node, sessionKey);
+            status = StatusCode::OK;
+        }
+        CHECK_AND_LOG_ERROR(node, node.getSessionName(sessionKey))
+    };
+    // stream returned to the model is assigned to deferred node session which gets notified through
+    // pipeline event queue, waiting is bounded only to retry deferred sessions if notification never arrives
+    const uint WAIT_FOR_PIPELINE_EVENT_TIMEOUT_MICROSECONDS = 100000;
+    auto retryDeferredNodeSessions = [&]() {
+        DeferredNodeSessions sessionsToRetry;
+        sessionsToRetry.swap(deferredNodeSessions);
+        for (auto& [deferredNode, deferredSessionKey] : sessionsToRetry) {
+            if (!firstErrorStatus.ok()) {
+                deferredNodeSessions.emplace(deferredNode, deferredSessionKey);
+                continue;
+            }
+            executeNodeSession(*deferredNode, deferredSessionKey);
+        }
+    };
+    while (finishedSessionsCount < startedSessionsCount) {
+        spdlog::trace("Pipeline: {} waiting for node event.", getName());
         OVMS_PROFILE_SYNC_BEGIN("PipelineEventQueue::tryPull");
-        auto optionallyFinishedNode = finishedNodeQueue.tryPull(WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS);
+        auto optionalEvent = pipelineEventQueue.tryPull(WAIT_FOR_PIPELINE_EVENT_TIMEOUT_MICROSECONDS);
         OVMS_PROFILE_SYNC_END("PipelineEventQueue::tryPull");
-        if (optionallyFinishedNode) {
-            OVMS_PROFILE_SCOPE_S("Processing Finished Node", "node_name", optionallyFinishedNode.value().first.get().getName().c_str());
+        if (!optionalEvent) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got no node event for {} us, {} of {} started node sessions not finished, {} deferred",
+                getName(), WAIT_FOR_PIPELINE_EVENT_TIMEOUT_MICROSECONDS, startedSessionsCount - finishedSessionsCount, startedSessionsCount, deferredNodeSessions.size());
+            retryDeferredNodeSessions();
+        } else if (optionalEvent.value().type == PipelineEvent::Type::STREAM_ID_ASSIGNED) {
+            Node& node = optionalEvent.value().node.get();
+            const session_key_t& sessionKey = optionalEvent.value().sessionKey;
+            OVMS_PROFILE_SCOPE_S("Processing Deferred Node", "node_name", node.getName().c_str());
+            // session could have been disarmed or retried after stream id got assigned to it
+            if (deferredNodeSessions.erase({&node, sessionKey}) == 0) {
+                continue;
+            }
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} node: {} session: {} got stream id assigned", getName(), node.getName(), node.getSessionName(sessionKey));
+            executeNodeSession(node, sessionKey);
+        } else {
+            Node& node = optionalEvent.value().node.get();
+            const session_key_t& sessionKey = optionalEvent.value().sessionKey;
+            OVMS_PROFILE_SCOPE_S("Processing Finished Node", "node_name", node.getName().c_str());
+            // session is removed once its results are fetched, so its name is kept for logging
+            const std::string sessionName = node.getSessionName(sessionKey);
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} session: {} finished.", getName(), node.getName(), sessionName);
+            ++finishedSessionsCount;
+            if (!firstErrorStatus.ok()) {
+                node.release(sessionKey);
+                continue;
+            }
             /*
                 Get results from finished node session.
             */
-            auto& [finishedNodeRef, sessionKey] = optionallyFinishedNode.value();
-            Node& finishedNode = finishedNodeRef.get();
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} session: {} finished.", getName(), finishedNode.getName(), sessionKey);
-            finishedSessions.emplace(finishedNode.getName() + sessionKey);
-            if (!firstErrorStatus.ok()) {
-                finishedNode.release(sessionKey);
-            }
-            IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
             SessionResults sessionResults;
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Fetching results of pipeline: {} node: {} session: {}", getName(), finishedNode.getName(), sessionKey);
-            status = finishedNode.fetchResults(sessionKey, sessionResults);
-            CHECK_AND_LOG_ERROR(finishedNode)
-            IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Fetching results of pipeline: {} node: {} session: {}", getName(), node.getName(), sessionName);
+            status = node.fetchResults(sessionKey, sessionResults);
+            CHECK_AND_LOG_ERROR(node, sessionName)
 
             /*
                 Feed next node sessions with results from currently finished node session.
+                Sessions of next nodes become ready when their last dependency finishes.
             */
-            auto& nextNodesFromFinished = finishedNode.getNextNodes();
+            auto& nextNodesFromFinished = node.getNextNodes();
             for (auto& nextNode : nextNodesFromFinished) {
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "setting pipeline: {} node: {} session: {} outputs as inputs for node: {}",
-                    getName(), finishedNode.getName(), sessionKey, nextNode.get().getName());
-                status = nextNode.get().setInputs(finishedNode, sessionResults);
-                CHECK_AND_LOG_ERROR(nextNode.get())
                 if (!firstErrorStatus.ok()) {
                     break;
                 }
+                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "setting pipeline: {} node: {} session: {} outputs as inputs for node: {}",
+                    getName(), node.getName(), sessionName, nextNode.get().getName());
+                status = nextNode.get().setInputs(node, sessionResults);
+                CHECK_AND_LOG_ERROR(nextNode.get(), sessionName)
             }
 
             /*
-                Try to schedule node sessions that are following the currently finished session.
-                Defer next node sessions which are ready, but stream id is not ready yet.
-                Save defered node sessions to temporary container which will be later merged into global container.
+                Schedule node sessions that became ready.
             */
             OVMS_PROFILE_SYNC_BEGIN("Try next nodes");
-            DeferredNodeSessions tmpDeferredNodeSessions;
             for (auto& nextNode : nextNodesFromFinished) {
-                auto readySessions = nextNode.get().getReadySessions();
-                for (auto& sessionKey : readySessions) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {} session: {}", getName(), nextNode.get().getName(), sessionKey);
-                    startedSessions.emplace(nextNode.get().getName() + sessionKey);
-                    status = nextNode.get().execute(sessionKey, finishedNodeQueue);
-                    if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
-                        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", nextNode.get().getName(), sessionKey);
-                        tmpDeferredNodeSessions.emplace_back(nextNode.get(), sessionKey);
-                        status = StatusCode::OK;
-                    }
-                    CHECK_AND_LOG_ERROR(nextNode.get())
+                if (!firstErrorStatus.ok()) {
+                    break;
+                }
+                for (auto& readySessionKey : nextNode.get().takeReadySessions()) {
+                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {} session: {}", getName(), nextNode.get().getName(), nextNode.get().getSessionName(readySessionKey));
+                    ++startedSessionsCount;
+                    executeNodeSession(nextNode.get(), readySessionKey);
                     if (!firstErrorStatus.ok()) {
                         break;
                     }
                 }
             }
             OVMS_PROFILE_SYNC_END("Try next nodes");
-
-            /*
-                Iterate over global container of deferred node sessions and try to schedule.
-                Keep in mind that newly deferred nodes are not iterated since those are in temporary container.
-                This is expected since newly deferred nodes were just checked for possible availability of stream ID in previous step.
-            */
-            OVMS_PROFILE_SYNC_BEGIN("Try deferred nodes");
-            for (auto it = deferredNodeSessions.begin(); it != deferredNodeSessions.end();) {
-                // Quit trying to schedule deferred nodes since handling newly finished node has bigger priority (the node can unlock stream ID or allow scheduling next nodes)
-                if (finishedNodeQueue.size() > 0) {
-                    break;
-                }
-                auto& [nodeRef, sessionKey] = *it;
-                auto& node = nodeRef.get();
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} session: {} execution", node.getName(), sessionKey);
-                status = node.execute(sessionKey, finishedNodeQueue);
-                if (status.ok()) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} is ready", node.getName(), sessionKey);
-                    it = deferredNodeSessions.erase(it);
-                    continue;
-                }
-                it++;
-                if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", node.getName(), sessionKey);
-                    status = StatusCode::OK;
-                } else {
-                    CHECK_AND_LOG_ERROR(node)
-                }
-            }
-            OVMS_PROFILE_SYNC_END("Try deferred nodes");
-
-            /*
-                Merge temporary and global deferred node session containers.
-            */
-            OVMS_PROFILE_SYNC_BEGIN("Merge deferred containers");
-            deferredNodeSessions.insert(
-                deferredNodeSessions.end(),
-                tmpDeferredNodeSessions.begin(),
-                tmpDeferredNodeSessions.end());
-            OVMS_PROFILE_SYNC_END("Merge deferred containers");
-
-            if (startedSessions.size() == finishedSessions.size()) {
-                break;
-            }
-        } else {
-            OVMS_PROFILE_SCOPE("No new finished nodes");
-            // If error occurred earlier, disarm stream id guards of all deferred nodes and exit
-            if (!firstErrorStatus.ok()) {
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will try to disarm all stream id guards of all {} deferred node sessions due to previous error in pipeline", deferredNodeSessions.size());
-                if (deferredNodeSessions.size() > 0) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to disarm {} remaining deferred node sessions ...", deferredNodeSessions.size());
-                    for (auto it = deferredNodeSessions.begin(); it != deferredNodeSessions.end();) {
-                        auto& [nodeRef, sessionKey] = *it;
-                        auto& node = nodeRef.get();
-                        if (node.tryDisarm(sessionKey, WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS)) {
-                            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Stream id guard disarm of node {} session: {} has succeeded", node.getName(), sessionKey);
-                            finishedSessions.emplace(node.getName() + sessionKey);
-                            it = deferredNodeSessions.erase(it);
-                        } else {
-                            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cannot disarm stream id guard of node: {}, session: {} yet, will try again later", node.getName(), sessionKey);
-                            it++;
-                        }
-                    }
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Disarming iteration completed, remaining deferred node sessions count: {}", deferredNodeSessions.size());
-                }
-                // Check for deferred node queue size again to indicate if all nodes got freed
-                if (deferredNodeSessions.size() > 0) {
-                    continue;
-                } else {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Disarming all stream id guards of deferred nodes completed, pipeline will shut down");
-                    IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
-                }
-            }
-            // else scope could be executed always however it seems most reasonable at the time to
-            // free blocked inferRequests from exeuction first rather than free models for reloading
-            OVMS_PROFILE_SYNC_BEGIN("Try deferred nodes");
-            for (auto it = deferredNodeSessions.begin(); it != deferredNodeSessions.end();) {
-                auto& [nodeRef, sessionKey] = *it;
-                auto& node = nodeRef.get();
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} session: {} execution", node.getName(), sessionKey);
-                status = node.execute(sessionKey, finishedNodeQueue);
-                if (status.ok()) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} is ready", node.getName(), sessionKey);
-                    it = deferredNodeSessions.erase(it);
-                    continue;
-                }
-                it++;
-                if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", node.getName(), sessionKey);
-                    status = StatusCode::OK;
-                } else {
-                    CHECK_AND_LOG_ERROR(node)
-                }
+        }
+        // If error occurred, deferred node sessions will not be executed, disarm their stream id guards
+        if (!firstErrorStatus.ok() && !deferredNodeSessions.empty()) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Disarming stream id guards of {} deferred node sessions due to previous error in pipeline", deferredNodeSessions.size());
+            for (auto& [deferredNode, deferredSessionKey] : deferredNodeSessions) {
+                deferredNode->tryDisarm(deferredSessionKey);
+                ++finishedSessionsCount;
             }
-            OVMS_PROFILE_SYNC_END("Try deferred nodes");
+            deferredNodeSessions.clear();
         }
     }
     return firstErrorStatus;
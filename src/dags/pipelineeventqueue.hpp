@@ -15,7 +15,7 @@
 //*****************************************************************************
 #pragma once
 
-#include <utility>
+#include <functional>
 
 #include "../threadsafequeue.hpp"
 #include "session_id.hpp"
@@ -24,6 +24,19 @@ namespace ovms {
 
 class Node;
 
-using NodeSessionKeyPair = std::pair<std::reference_wrapper<Node>, session_key_t>;
-using PipelineEventQueue = ThreadSafeQueue<NodeSessionKeyPair>;
+/**
+ * @brief Notification sent to pipeline by node session, either when it finished execution
+ * or when stream id it was waiting for got assigned to it and it can be executed now
+ */
+struct PipelineEvent {
+    enum class Type {
+        NODE_SESSION_FINISHED,
+        STREAM_ID_ASSIGNED
+    };
+    std::reference_wrapper<Node> node;
+    session_key_t sessionKey;
+    Type type = Type::NODE_SESSION_FINISHED;
+};
+
+using PipelineEventQueue = ThreadSafeQueue<PipelineEvent>;
 }  // namespace ovms
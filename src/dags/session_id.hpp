@@ -15,10 +15,11 @@
 //*****************************************************************************
 #pragma once
 
-#include <string>
+#include <cstdint>
 
 namespace ovms {
 
 using session_id_t = uint32_t;
-using session_key_t = std::string;
+// Session keys of sessions with the same subsession levels are dense, starting from 0
+using session_key_t = uint64_t;
 }  // namespace ovms
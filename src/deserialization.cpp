@@ -16,6 +16,9 @@
 #include "deserialization.hpp"
 
 #include "capi_frontend/buffer.hpp"
+#include "capi_frontend/capi_utils.hpp"
+#include "dags/tensormap.hpp"
+#include "precision_conversion.hpp"
 
 namespace ovms {
 
@@ -40,6 +43,12 @@ Status InputSink<ov::InferRequest&>::give(const std::string& name, ov::Tensor& t
 
     return status;
 }
+template <>
+Status InputSink<TensorMap&>::give(const std::string& name, ov::Tensor& tensor) {
+    requester[name] = tensor;
+    return StatusCode::OK;
+}
+
 ov::Tensor makeTensor(const InferenceTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo) {
     OVMS_PROFILE_FUNCTION();
@@ -87,4 +96,76 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
     return tensor;
 }
 
+static bool requiresPrecisionConversion(Precision requestPrecision, const TensorInfo& tensorInfo) {
+    return (requestPrecision != tensorInfo.getPrecision()) && (tensorInfo.getAcceptedPrecisions().count(requestPrecision) > 0);
+}
+
+bool requiresPrecisionConversion(const tensorflow::TensorProto& requestInput, const TensorInfo& tensorInfo) {
+    return requiresPrecisionConversion(TFSPrecisionToOvmsPrecision(requestInput.dtype()), tensorInfo);
+}
+
+bool requiresPrecisionConversion(const ::KFSRequest::InferInputTensor& requestInput, const TensorInfo& tensorInfo) {
+    return requiresPrecisionConversion(KFSPrecisionToOvmsPrecision(requestInput.datatype()), tensorInfo);
+}
+
+bool requiresPrecisionConversion(const InferenceTensor& requestInput, const TensorInfo& tensorInfo) {
+    return requiresPrecisionConversion(getOVMSDataTypeAsPrecision(requestInput.getDataType()), tensorInfo);
+}
+
+static ov::Tensor makeConvertedTensor(const void* data, size_t byteSize, Precision requestPrecision, const ov::Shape& shape, const TensorInfo& tensorInfo) {
+    OVMS_PROFILE_FUNCTION();
+    ov::Tensor tensor(tensorInfo.getOvPrecision(), shape);
+    if (byteSize != tensor.get_size() * ov::element::Type(ovmsPrecisionToIE2Precision(requestPrecision)).size()) {
+        SPDLOG_DEBUG("Cannot convert input: {} from precision: {}; invalid data size: {}", tensorInfo.getName(), toString(requestPrecision), byteSize);
+        return ov::Tensor();
+    }
+    if (!convertPrecision(data, requestPrecision, tensor.data(), tensorInfo.getPrecision(), tensor.get_size())) {
+        SPDLOG_DEBUG("Cannot convert input: {} from precision: {} to precision: {}", tensorInfo.getName(), toString(requestPrecision), tensorInfo.getPrecisionAsString());
+        return ov::Tensor();
+    }
+    return tensor;
+}
+
+ov::Tensor makeTensorWithPrecisionConversion(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    OVMS_PROFILE_FUNCTION();
+    ov::Shape shape;
+    for (int i = 0; i < requestInput.tensor_shape().dim_size(); i++) {
+        shape.push_back(requestInput.tensor_shape().dim(i).size());
+    }
+    return makeConvertedTensor(requestInput.tensor_content().data(), requestInput.tensor_content().size(),
+        TFSPrecisionToOvmsPrecision(requestInput.dtype()), shape, *tensorInfo);
+}
+
+ov::Tensor makeTensorWithPrecisionConversion(const ::KFSRequest::InferInputTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const std::string* buffer) {
+    OVMS_PROFILE_FUNCTION();
+    ov::Shape shape;
+    for (int i = 0; i < requestInput.shape_size(); i++) {
+        shape.push_back(requestInput.shape().at(i));
+    }
+    Precision requestPrecision = KFSPrecisionToOvmsPrecision(requestInput.datatype());
+    if (nullptr != buffer) {
+        return makeConvertedTensor(buffer->data(), buffer->size(), requestPrecision, shape, *tensorInfo);
+    }
+    // only FP32 is accepted for conversion, other typed contents are not expected here
+    if (requestPrecision != Precision::FP32) {
+        return ov::Tensor();
+    }
+    const auto& contents = requestInput.contents().fp32_contents();
+    return makeConvertedTensor(contents.data(), contents.size() * sizeof(float), requestPrecision, shape, *tensorInfo);
+}
+
+ov::Tensor makeTensorWithPrecisionConversion(const InferenceTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    OVMS_PROFILE_FUNCTION();
+    ov::Shape shape;
+    for (const auto& dim : requestInput.getShape()) {
+        shape.push_back(dim);
+    }
+    return makeConvertedTensor(requestInput.getBuffer()->data(), requestInput.getBuffer()->getByteSize(),
+        getOVMSDataTypeAsPrecision(requestInput.getDataType()), shape, *tensorInfo);
+}
+
 }  // namespace ovms
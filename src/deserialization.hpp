@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -29,6 +30,8 @@
 
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferencetensor.hpp"
+#include "element_conversion.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "profiler.hpp"
 #include "status.hpp"
@@ -57,6 +60,46 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
 ov::Tensor makeTensor(const InferenceTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo);
 
+/**
+     * @brief Checks if request data is in precision accepted by tensor info and has to be converted to tensor precision
+     */
+bool requiresPrecisionConversion(const tensorflow::TensorProto& requestInput, const TensorInfo& tensorInfo);
+bool requiresPrecisionConversion(const ::KFSRequest::InferInputTensor& requestInput, const TensorInfo& tensorInfo);
+bool requiresPrecisionConversion(const InferenceTensor& requestInput, const TensorInfo& tensorInfo);
+
+/**
+     * @brief Creates tensor in tensor info precision out of request data in accepted precision
+     *
+     * @return converted tensor or empty tensor if data size does not match shape or conversion is not supported
+     */
+ov::Tensor makeTensorWithPrecisionConversion(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo);
+ov::Tensor makeTensorWithPrecisionConversion(const ::KFSRequest::InferInputTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const std::string* buffer);
+ov::Tensor makeTensorWithPrecisionConversion(const InferenceTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo);
+
+/**
+     * @brief Fills tensor with typed contents, converting elements to tensor precision. Number of copied elements
+     * is limited by both number of contents and tensor size.
+     */
+template <typename TensorType, typename ContentType>
+void copyContents(const google::protobuf::RepeatedField<ContentType>& contents, TensorType* destination, size_t tensorSize) {
+    OVMS_PROFILE_FUNCTION();
+    size_t count = std::min(static_cast<size_t>(contents.size()), tensorSize);
+    convertElements<TensorType, ContentType>(contents.data(), destination, count);
+}
+
+template <typename TensorType, typename ContentType>
+ov::Tensor makeTensorFromContents(const ::KFSRequest::InferInputTensor& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const google::protobuf::RepeatedField<ContentType>& contents) {
+    ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
+    copyContents(contents, reinterpret_cast<TensorType*>(tensor.data()), tensor.get_size());
+    return tensor;
+}
+
 class ConcreteTensorProtoDeserializator {
 public:
     static ov::Tensor deserializeTensorProto(
@@ -64,6 +107,9 @@ public:
         const std::shared_ptr<const TensorInfo>& tensorInfo,
         const std::string* buffer) {
         OVMS_PROFILE_FUNCTION();
+        if (requiresPrecisionConversion(requestInput, *tensorInfo)) {
+            return makeTensorWithPrecisionConversion(requestInput, tensorInfo, buffer);
+        }
         if (nullptr != buffer) {
             switch (tensorInfo->getPrecision()) {
             case ovms::Precision::FP64:
@@ -92,122 +138,34 @@ public:
         } else {
             switch (tensorInfo->getPrecision()) {
                 // bool_contents
-            case ovms::Precision::BOOL: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                bool* ptr = reinterpret_cast<bool*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().bool_contents()) {
-                    ptr[i++] = *(const_cast<bool*>(reinterpret_cast<const bool*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::BOOL:
+                return makeTensorFromContents<bool>(requestInput, tensorInfo, requestInput.contents().bool_contents());
                 /// int_contents
-            case ovms::Precision::I8: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int8_t* ptr = reinterpret_cast<int8_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int8_t*>(reinterpret_cast<const int8_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::I16: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int16_t* ptr = reinterpret_cast<int16_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int16_t*>(reinterpret_cast<const int16_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::I32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int32_t* ptr = reinterpret_cast<int32_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int32_t*>(reinterpret_cast<const int32_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::I8:
+                return makeTensorFromContents<int8_t>(requestInput, tensorInfo, requestInput.contents().int_contents());
+            case ovms::Precision::I16:
+                return makeTensorFromContents<int16_t>(requestInput, tensorInfo, requestInput.contents().int_contents());
+            case ovms::Precision::I32:
+                return makeTensorFromContents<int32_t>(requestInput, tensorInfo, requestInput.contents().int_contents());
                 /// int64_contents
-            case ovms::Precision::I64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int64_t* ptr = reinterpret_cast<int64_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int64_contents()) {
-                    ptr[i++] = *(const_cast<int64_t*>(reinterpret_cast<const int64_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::I64:
+                return makeTensorFromContents<int64_t>(requestInput, tensorInfo, requestInput.contents().int64_contents());
                 // uint_contents
-            case ovms::Precision::U8: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint8_t* ptr = reinterpret_cast<uint8_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::U16: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint16_t* ptr = reinterpret_cast<uint16_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint16_t*>(reinterpret_cast<const uint16_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::U32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint32_t* ptr = reinterpret_cast<uint32_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint32_t*>(reinterpret_cast<const uint32_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::U8:
+                return makeTensorFromContents<uint8_t>(requestInput, tensorInfo, requestInput.contents().uint_contents());
+            case ovms::Precision::U16:
+                return makeTensorFromContents<uint16_t>(requestInput, tensorInfo, requestInput.contents().uint_contents());
+            case ovms::Precision::U32:
+                return makeTensorFromContents<uint32_t>(requestInput, tensorInfo, requestInput.contents().uint_contents());
                 // uint64_contents
-            case ovms::Precision::U64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint64_t* ptr = reinterpret_cast<uint64_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint64_contents()) {
-                    ptr[i++] = *(const_cast<uint64_t*>(reinterpret_cast<const uint64_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::U64:
+                return makeTensorFromContents<uint64_t>(requestInput, tensorInfo, requestInput.contents().uint64_contents());
                 // fp32_contents
-            case ovms::Precision::FP32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                float* ptr = reinterpret_cast<float*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().fp32_contents()) {
-                    ptr[i++] = *(const_cast<float*>(reinterpret_cast<const float*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::FP32:
+                return makeTensorFromContents<float>(requestInput, tensorInfo, requestInput.contents().fp32_contents());
                 // fp64_contentes
-            case ovms::Precision::FP64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                double* ptr = reinterpret_cast<double*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().fp64_contents()) {
-                    ptr[i++] = *(const_cast<double*>(reinterpret_cast<const double*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::FP64:
+                return makeTensorFromContents<double>(requestInput, tensorInfo, requestInput.contents().fp64_contents());
             case ovms::Precision::FP16:
             case ovms::Precision::U1:
             case ovms::Precision::CUSTOM:
@@ -226,6 +184,9 @@ public:
         const InferenceTensor& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo) {
         OVMS_PROFILE_FUNCTION();
+        if (requiresPrecisionConversion(requestInput, *tensorInfo)) {
+            return makeTensorWithPrecisionConversion(requestInput, tensorInfo);
+        }
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP64:
         case ovms::Precision::FP32:
@@ -256,6 +217,9 @@ public:
         const tensorflow::TensorProto& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo) {
         OVMS_PROFILE_FUNCTION();
+        if (requiresPrecisionConversion(requestInput, *tensorInfo)) {
+            return makeTensorWithPrecisionConversion(requestInput, tensorInfo);
+        }
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP32:
         case ovms::Precision::I32:
@@ -274,11 +238,7 @@ public:
             ov::Tensor tensor(ov::element::f16, shape);
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
-            uint16_t* ptr = (uint16_t*)tensor.data();
-            auto size = static_cast<size_t>(requestInput.half_val_size());
-            for (size_t i = 0; i < size; i++) {
-                ptr[i] = requestInput.half_val(i);
-            }
+            copyContents(requestInput.half_val(), reinterpret_cast<uint16_t*>(tensor.data()), tensor.get_size());
             return tensor;
         }
         case ovms::Precision::U16: {
@@ -289,11 +249,7 @@ public:
             ov::Tensor tensor(ov::element::u16, shape);
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
-            uint16_t* ptr = (uint16_t*)tensor.data();
-            auto size = static_cast<size_t>(requestInput.int_val_size());
-            for (size_t i = 0; i < size; i++) {
-                ptr[i] = requestInput.int_val(i);
-            }
+            copyContents(requestInput.int_val(), reinterpret_cast<uint16_t*>(tensor.data()), tensor.get_size());
             return tensor;
         }
         case ovms::Precision::U32:
@@ -427,9 +383,13 @@ Status deserializePredictRequest(
             ov::Tensor tensor;
 
             auto inputIndex = requestInputItr - request.inputs().begin();
-            auto bufferLocation = deserializeFromSharedInputContents ? &request.raw_input_contents()[inputIndex] : nullptr;
+            const bool inSharedMemory = usesSharedMemory(requestInputItr->parameters());
+            auto bufferLocation = (deserializeFromSharedInputContents && !inSharedMemory) ? &request.raw_input_contents()[inputIndex] : nullptr;
 
-            if (requiresPreProcessing(*requestInputItr)) {
+            if (inSharedMemory) {
+                SPDLOG_DEBUG("Request contains input in shared memory: {}", name);
+                RETURN_IF_ERR(makeTensorFromSharedMemory(*requestInputItr, *tensorInfo, tensor));
+            } else if (requiresPreProcessing(*requestInputItr)) {
                 switch (tensorInfo->getPreProcessingHint()) {
                 case TensorInfo::ProcessingHint::STRING_1D_U8:
                     SPDLOG_DEBUG("Request contains input in 1D string format: {}", name);
@@ -0,0 +1,350 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "dynamic_batching_scheduler.hpp"
+
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#include "executingstreamidguard.hpp"
+#include "logging.hpp"
+#include "model_metric_reporter.hpp"
+#include "modelinstance.hpp"
+#include "profiler.hpp"
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+struct DynamicBatchingScheduler::Batch {
+    std::vector<const TensorMap*> requestInputs;
+    std::vector<TensorMap*> requestOutputs;
+    std::vector<size_t> requestBatchSizes;
+    std::vector<std::function<void(Status)>> requestCallbacks;
+    std::vector<ov::Shape> signature;
+    size_t totalBatchSize = 0;
+    std::chrono::steady_clock::time_point deadline;
+    bool closed = false;
+    std::unique_ptr<ExecutingStreamIdGuard> executingStreamIdGuard;
+    std::chrono::steady_clock::time_point inferenceStart;
+};
+
+static void copyAlongBatchDimension(char* batched, char* single, const ov::Shape& batchedShape, size_t singleBatchSize, size_t elementSize, size_t batchIndex, size_t batchOffset, bool toBatch) {
+    const size_t outerSize = std::accumulate(batchedShape.begin(), batchedShape.begin() + batchIndex, size_t(1), std::multiplies<size_t>());
+    const size_t innerSize = std::accumulate(batchedShape.begin() + batchIndex + 1, batchedShape.end(), elementSize, std::multiplies<size_t>());
+    const size_t totalBatchSize = batchedShape[batchIndex];
+    const size_t chunkSize = singleBatchSize * innerSize;
+    for (size_t i = 0; i < outerSize; ++i) {
+        char* batchedChunk = batched + (i * totalBatchSize + batchOffset) * innerSize;
+        char* singleChunk = single + i * chunkSize;
+        if (toBatch) {
+            std::memcpy(batchedChunk, singleChunk, chunkSize);
+        } else {
+            std::memcpy(singleChunk, batchedChunk, chunkSize);
+        }
+    }
+}
+
+void copyToBatch(const ov::Tensor& source, ov::Tensor& batched, size_t batchIndex, size_t batchOffset) {
+    copyAlongBatchDimension(reinterpret_cast<char*>(batched.data()),
+        reinterpret_cast<char*>(const_cast<ov::Tensor&>(source).data()),
+        batched.get_shape(),
+        source.get_shape()[batchIndex],
+        batched.get_element_type().size(),
+        batchIndex,
+        batchOffset,
+        true);
+}
+
+void copyFromBatch(const ov::Tensor& batched, ov::Tensor& destination, size_t batchIndex, size_t batchOffset) {
+    copyAlongBatchDimension(reinterpret_cast<char*>(const_cast<ov::Tensor&>(batched).data()),
+        reinterpret_cast<char*>(destination.data()),
+        batched.get_shape(),
+        destination.get_shape()[batchIndex],
+        batched.get_element_type().size(),
+        batchIndex,
+        batchOffset,
+        false);
+}
+
+DynamicBatchingScheduler::DynamicBatchingScheduler(ModelInstance& modelInstance, uint32_t maxBatchSize, std::chrono::microseconds maxQueueDelay) :
+    modelInstance(modelInstance),
+    maxBatchSize(maxBatchSize),
+    maxQueueDelay(maxQueueDelay) {
+    // batch index presence is validated by model instance before scheduler creation
+    for (const auto& [_, tensorInfo] : modelInstance.getInputsInfo()) {
+        inputs.push_back({tensorInfo->getName(), tensorInfo->getLayout().getBatchIndex().value()});
+    }
+    for (const auto& [_, tensorInfo] : modelInstance.getOutputsInfo()) {
+        outputs.push_back({tensorInfo->getName(), tensorInfo->getLayout().getBatchIndex().value()});
+    }
+    batchingThread = std::thread(&DynamicBatchingScheduler::collectBatches, this);
+}
+
+DynamicBatchingScheduler::~DynamicBatchingScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopped = true;
+    }
+    batchesChanged.notify_all();
+    batchingThread.join();
+}
+
+Status DynamicBatchingScheduler::getBatchSignature(const TensorMap& requestInputs, std::vector<ov::Shape>& signature, size_t& requestBatchSize) const {
+    signature.clear();
+    signature.reserve(inputs.size());
+    requestBatchSize = 0;
+    for (const auto& input : inputs) {
+        auto it = requestInputs.find(input.name);
+        if (it == requestInputs.end()) {
+            SPDLOG_DEBUG("Dynamic batching of model: {} version: {} failed. Missing input: {}", modelInstance.getName(), modelInstance.getVersion(), input.name);
+            return StatusCode::INTERNAL_ERROR;
+        }
+        ov::Shape shape = it->second.get_shape();
+        if (input.batchIndex >= shape.size()) {
+            return StatusCode::INVALID_NO_OF_SHAPE_DIMENSIONS;
+        }
+        if (requestBatchSize == 0) {
+            requestBatchSize = shape[input.batchIndex];
+        } else if (requestBatchSize != shape[input.batchIndex]) {
+            SPDLOG_DEBUG("Dynamic batching of model: {} version: {} failed. Inputs have different batch sizes", modelInstance.getName(), modelInstance.getVersion());
+            return StatusCode::INVALID_BATCH_SIZE;
+        }
+        // batch dimension is excluded from compatibility check
+        shape[input.batchIndex] = 0;
+        signature.emplace_back(std::move(shape));
+    }
+    if (requestBatchSize == 0 || requestBatchSize > maxBatchSize) {
+        return StatusCode::INVALID_BATCH_SIZE;
+    }
+    return StatusCode::OK;
+}
+
+Status DynamicBatchingScheduler::scheduleAsync(const TensorMap& requestInputs, TensorMap& requestOutputs, std::function<void(Status)> onComplete) {
+    OVMS_PROFILE_FUNCTION();
+    std::vector<ov::Shape> signature;
+    size_t requestBatchSize = 0;
+    auto status = getBatchSignature(requestInputs, signature, requestBatchSize);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (stopped) {
+        return StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE;
+    }
+    bool batchesChangedForThread = false;
+    std::shared_ptr<Batch> batch;
+    if (!pendingBatches.empty() &&
+        !pendingBatches.back()->closed &&
+        (pendingBatches.back()->totalBatchSize + requestBatchSize <= maxBatchSize) &&
+        (pendingBatches.back()->signature == signature)) {
+        batch = pendingBatches.back();
+    } else {
+        if (!pendingBatches.empty()) {
+            // incompatible request arrived, do not delay currently forming batch any longer
+            pendingBatches.back()->closed = true;
+        }
+        batch = std::make_shared<Batch>();
+        batch->signature = std::move(signature);
+        batch->deadline = std::chrono::steady_clock::now() + maxQueueDelay;
+        pendingBatches.push_back(batch);
+        batchesChangedForThread = true;
+    }
+    batch->requestInputs.push_back(&requestInputs);
+    batch->requestOutputs.push_back(&requestOutputs);
+    batch->requestBatchSizes.push_back(requestBatchSize);
+    batch->requestCallbacks.push_back(std::move(onComplete));
+    batch->totalBatchSize += requestBatchSize;
+    if (batch->totalBatchSize == maxBatchSize) {
+        batch->closed = true;
+        batchesChangedForThread = true;
+    }
+    if (batchesChangedForThread) {
+        batchesChanged.notify_one();
+    }
+    return StatusCode::OK;
+}
+
+Status DynamicBatchingScheduler::schedule(const TensorMap& requestInputs, TensorMap& requestOutputs) {
+    OVMS_PROFILE_FUNCTION();
+    std::mutex finishedMutex;
+    std::condition_variable finishedCv;
+    std::optional<Status> batchStatus;
+    auto status = scheduleAsync(requestInputs, requestOutputs, [&finishedMutex, &finishedCv, &batchStatus](Status status) {
+        // notified under lock since waiting thread destroys condition variable right after wake up
+        std::lock_guard<std::mutex> lock(finishedMutex);
+        batchStatus = std::move(status);
+        finishedCv.notify_one();
+    });
+    if (!status.ok()) {
+        return status;
+    }
+    OVMS_PROFILE_SCOPE("Wait for batch inference");
+    std::unique_lock<std::mutex> lock(finishedMutex);
+    finishedCv.wait(lock, [&batchStatus]() { return batchStatus.has_value(); });
+    return batchStatus.value();
+}
+
+void DynamicBatchingScheduler::collectBatches() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        batchesChanged.wait(lock, [this]() { return stopped || !pendingBatches.empty(); });
+        if (stopped) {
+            break;
+        }
+        std::shared_ptr<Batch> batch = pendingBatches.front();
+        {
+            OVMS_PROFILE_SCOPE("Wait for batch to fill");
+            batchesChanged.wait_until(lock, batch->deadline, [this, &batch]() { return stopped || batch->closed; });
+        }
+        if (stopped) {
+            break;
+        }
+        batch->closed = true;
+        pendingBatches.pop_front();
+        lock.unlock();
+        // batch is closed so no other thread modifies it anymore, following requests form next batch meanwhile
+        execute(std::move(batch));
+        lock.lock();
+    }
+    // model is unloaded only when no request is in progress, so there should be nothing left
+    auto remainingBatches = std::move(pendingBatches);
+    pendingBatches.clear();
+    lock.unlock();
+    for (auto& batch : remainingBatches) {
+        finish(std::move(batch), StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE);
+    }
+}
+
+void DynamicBatchingScheduler::finish(std::shared_ptr<Batch> batch, const Status& status) {
+    if (batch->executingStreamIdGuard) {
+        // infer request may be reused by synchronous path which does not expect any callback, captures of the callback are destroyed here
+        batch->executingStreamIdGuard->getInferRequest().set_callback([](std::exception_ptr exceptionPtr) {});
+    }
+    // scheduler and model may be gone once last request is completed, so stream is returned first
+    batch->executingStreamIdGuard.reset();
+    auto requestCallbacks = std::move(batch->requestCallbacks);
+    batch.reset();
+    for (auto& onComplete : requestCallbacks) {
+        onComplete(status);
+    }
+}
+
+void DynamicBatchingScheduler::execute(std::shared_ptr<Batch> batch) {
+    OVMS_PROFILE_FUNCTION();
+    SPDLOG_DEBUG("Model: {} version: {} executing dynamic batch of: {} requests with batch size: {}",
+        modelInstance.getName(), modelInstance.getVersion(), batch->requestInputs.size(), batch->totalBatchSize);
+    this->executedBatchesCount.fetch_add(1, std::memory_order_relaxed);
+    // only scheduler thread waits for idle infer request, requests keep joining next batch meanwhile
+    batch->executingStreamIdGuard = std::make_unique<ExecutingStreamIdGuard>(modelInstance.getInferRequestsQueue(), modelInstance.getMetricReporter());
+    ov::InferRequest& inferRequest = batch->executingStreamIdGuard->getInferRequest();
+    try {
+        for (const auto& input : inputs) {
+            OVMS_PROFILE_SCOPE("Merge input tensors");
+            if (batch->requestInputs.size() == 1) {
+                // nothing to merge, tensor can be used directly
+                inferRequest.set_tensor(input.name, batch->requestInputs[0]->at(input.name));
+                continue;
+            }
+            const ov::Tensor& first = batch->requestInputs[0]->at(input.name);
+            ov::Shape batchedShape = first.get_shape();
+            batchedShape[input.batchIndex] = batch->totalBatchSize;
+            ov::Tensor batched(first.get_element_type(), batchedShape);
+            size_t batchOffset = 0;
+            for (size_t i = 0; i < batch->requestInputs.size(); ++i) {
+                copyToBatch(batch->requestInputs[i]->at(input.name), batched, input.batchIndex, batchOffset);
+                batchOffset += batch->requestBatchSizes[i];
+            }
+            inferRequest.set_tensor(input.name, batched);
+        }
+    } catch (const std::exception& e) {
+        Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        finish(std::move(batch), status);
+        return;
+    }
+
+    try {
+        inferRequest.set_callback([this, capturedBatch = batch](std::exception_ptr exceptionPtr) {
+            // local copy keeps batch alive after this callback is replaced
+            auto batch = capturedBatch;
+            OVMS_PROFILE_ASYNC_END("dynamic batch inference", batch.get());
+            Status status = StatusCode::OK;
+            if (exceptionPtr) {
+                status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+                try {
+                    std::rethrow_exception(exceptionPtr);
+                } catch (const std::exception& e) {
+                    SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+                } catch (...) {
+                    SPDLOG_ERROR("Async caught an exception {}", status.string());
+                }
+            } else {
+                double inferTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - batch->inferenceStart).count();
+                OBSERVE_IF_ENABLED(this->modelInstance.getMetricReporter().inferenceTime, inferTime);
+                status = splitOutputs(*batch, batch->executingStreamIdGuard->getInferRequest());
+            }
+            // captures of this lambda are destroyed in finish, so only locals are used from now on
+            finish(std::move(batch), status);
+        });
+        batch->inferenceStart = std::chrono::steady_clock::now();
+        OVMS_PROFILE_SYNC_BEGIN("ov::InferRequest::start_async");
+        inferRequest.start_async();
+        OVMS_PROFILE_SYNC_END("ov::InferRequest::start_async");
+        OVMS_PROFILE_ASYNC_BEGIN("dynamic batch inference", batch.get());
+    } catch (const std::exception& e) {
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        finish(std::move(batch), status);
+    }
+}
+
+Status DynamicBatchingScheduler::splitOutputs(Batch& batch, ov::InferRequest& inferRequest) {
+    OVMS_PROFILE_FUNCTION();
+    try {
+        for (const auto& output : outputs) {
+            ov::Tensor batched = inferRequest.get_tensor(output.name);
+            const ov::Shape& batchedShape = batched.get_shape();
+            if (output.batchIndex >= batchedShape.size() || batchedShape[output.batchIndex] != batch.totalBatchSize) {
+                SPDLOG_DEBUG("Model: {} version: {} output: {} batch dimension does not match merged batch size: {}",
+                    modelInstance.getName(), modelInstance.getVersion(), output.name, batch.totalBatchSize);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            size_t batchOffset = 0;
+            for (size_t i = 0; i < batch.requestOutputs.size(); ++i) {
+                ov::Shape shape = batchedShape;
+                shape[output.batchIndex] = batch.requestBatchSizes[i];
+                // infer request output is reused by next inference so each request receives a copy
+                ov::Tensor tensor(batched.get_element_type(), shape);
+                copyFromBatch(batched, tensor, output.batchIndex, batchOffset);
+                batchOffset += batch.requestBatchSizes[i];
+                (*batch.requestOutputs[i])[output.name] = std::move(tensor);
+            }
+        }
+    } catch (const std::exception& e) {
+        Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
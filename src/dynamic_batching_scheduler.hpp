@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "dags/tensormap.hpp"
+
+namespace ovms {
+class ModelInstance;
+class Status;
+
+/**
+     * @brief Merges concurrent requests to the same model into one inference along the batch dimension.
+     *
+     * Request joins currently forming batch if its shapes are compatible and batch size fits, otherwise it starts new batch.
+     * Batches are collected by scheduler thread, which closes each batch when it is full, when incompatible request
+     * arrives or when maxQueueDelay since batch creation passes. Closed batch is merged into single asynchronous
+     * inference and outputs are split back per request in its completion callback, so threads scheduling requests
+     * never wait for other requests to join.
+     */
+class DynamicBatchingScheduler {
+    struct Batch;
+
+    struct TensorBatchInfo {
+        std::string name;
+        size_t batchIndex;
+    };
+
+    ModelInstance& modelInstance;
+    const uint32_t maxBatchSize;
+    const std::chrono::microseconds maxQueueDelay;
+
+    std::vector<TensorBatchInfo> inputs;
+    std::vector<TensorBatchInfo> outputs;
+
+    std::mutex mtx;
+    std::condition_variable batchesChanged;
+    /**
+         * @brief Batches not started yet in order of creation, only the last one can be still open
+         */
+    std::deque<std::shared_ptr<Batch>> pendingBatches;
+    bool stopped = false;
+    std::thread batchingThread;
+
+    Status getBatchSignature(const TensorMap& requestInputs, std::vector<ov::Shape>& signature, size_t& requestBatchSize) const;
+    void collectBatches();
+    void execute(std::shared_ptr<Batch> batch);
+    Status splitOutputs(Batch& batch, ov::InferRequest& inferRequest);
+    static void finish(std::shared_ptr<Batch> batch, const Status& status);
+
+protected:
+    std::atomic<size_t> executedBatchesCount{0};
+
+public:
+    DynamicBatchingScheduler(ModelInstance& modelInstance, uint32_t maxBatchSize, std::chrono::microseconds maxQueueDelay);
+    ~DynamicBatchingScheduler();
+
+    /**
+         * @brief Adds request to the batch without waiting for its inference
+         *
+         * @param requestInputs deserialized request tensors, keyed by model input names, have to stay valid until onComplete is called
+         * @param requestOutputs filled with output tensors belonging to the request before onComplete is called, keyed by model output names
+         * @param onComplete invoked exactly once with final status if request was scheduled, from the thread finishing batch inference
+         *
+         * @return Status OK if request was scheduled, error otherwise - in such case onComplete is not called
+         */
+    Status scheduleAsync(const TensorMap& requestInputs, TensorMap& requestOutputs, std::function<void(Status)> onComplete);
+
+    /**
+         * @brief Blocks until inference of the batch containing request inputs is finished
+         *
+         * @param requestInputs deserialized request tensors, keyed by model input names
+         * @param requestOutputs filled with output tensors belonging to the request, keyed by model output names
+         *
+         * @return Status
+         */
+    Status schedule(const TensorMap& requestInputs, TensorMap& requestOutputs);
+
+    uint32_t getMaxBatchSize() const { return maxBatchSize; }
+    std::chrono::microseconds getMaxQueueDelay() const { return maxQueueDelay; }
+};
+
+/**
+     * @brief Copies tensor into batched tensor at specified offset of batch dimension
+     */
+void copyToBatch(const ov::Tensor& source, ov::Tensor& batched, size_t batchIndex, size_t batchOffset);
+
+/**
+     * @brief Copies part of batched tensor starting at specified offset of batch dimension into tensor
+     */
+void copyFromBatch(const ov::Tensor& batched, ov::Tensor& destination, size_t batchIndex, size_t batchOffset);
+}  // namespace ovms
@@ -0,0 +1,42 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace ovms {
+
+/**
+     * @brief Copies elements between buffers of possibly different arithmetic types.
+     *
+     * Same size types are copied with memcpy. Otherwise elements are widened or truncated with static_cast,
+     * which for integers keeps the lowest bytes of each value. Loop has no dependencies between iterations and
+     * buffers are not aliased so that compiler vectorizes it (packing/unpacking instructions on x86).
+     */
+template <typename DstType, typename SrcType>
+void convertElements(const SrcType* __restrict src, DstType* __restrict dst, size_t count) {
+    static_assert(std::is_arithmetic_v<DstType> && std::is_arithmetic_v<SrcType>);
+    if constexpr (sizeof(DstType) == sizeof(SrcType) && std::is_floating_point_v<DstType> == std::is_floating_point_v<SrcType>) {
+        std::memcpy(dst, src, count * sizeof(DstType));
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = static_cast<DstType>(src[i]);
+        }
+    }
+}
+}  // namespace ovms
@@ -32,7 +32,16 @@ ExecutingStreamIdGuard::CurrentRequestsMetricGuard::~CurrentRequestsMetricGuard(
 ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
     currentRequestsMetricGuard(reporter),
     inferRequestsQueue_(inferRequestsQueue),
-    id_(inferRequestsQueue_.getIdleStream().get()),
+    id_(inferRequestsQueue_.getIdleStream()),
+    inferRequest(inferRequestsQueue.getInferRequest(id_)),
+    reporter(reporter) {
+    INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+}
+
+ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, int assignedStreamId) :
+    currentRequestsMetricGuard(reporter),
+    inferRequestsQueue_(inferRequestsQueue),
+    id_(assignedStreamId),
     inferRequest(inferRequestsQueue.getInferRequest(id_)),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
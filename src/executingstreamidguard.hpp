@@ -27,6 +27,10 @@ class OVInferRequestsQueue;
 
 struct ExecutingStreamIdGuard {
     ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    /**
+     * @brief Takes over stream which was already assigned from the queue, without waiting
+     */
+    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, int assignedStreamId);
     ~ExecutingStreamIdGuard();
 
     int getId();
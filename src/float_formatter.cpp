@@ -0,0 +1,324 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "float_formatter.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace ovms {
+namespace {
+using uint128_t = unsigned __int128;
+
+constexpr int FLOAT_MANTISSA_BITS = 23;
+constexpr int FLOAT_BIAS = 127;
+constexpr int POW5_INV_BITCOUNT = 59;
+constexpr int POW5_BITCOUNT = 61;
+constexpr int POW5_INV_TABLE_SIZE = 31;
+constexpr int POW5_TABLE_SIZE = 47;
+
+// ceil(log2(5^e)) for e > 0, 1 for e == 0
+constexpr int pow5bits(int e) {
+    return static_cast<int>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e))
+constexpr int log10Pow2(int e) {
+    return static_cast<int>((static_cast<uint32_t>(e) * 78913) >> 18);
+}
+
+// floor(log10(5^e))
+constexpr int log10Pow5(int e) {
+    return static_cast<int>((static_cast<uint32_t>(e) * 732923) >> 20);
+}
+
+constexpr uint128_t pow5(int e) {
+    uint128_t result = 1;
+    for (int i = 0; i < e; ++i) {
+        result *= 5;
+    }
+    return result;
+}
+
+// floor(2^exponent / divisor) computed with binary long division
+constexpr uint128_t pow2Divide(int exponent, uint128_t divisor) {
+    uint128_t quotient = 0;
+    uint128_t remainder = 1;
+    for (int i = 0; i < exponent; ++i) {
+        remainder <<= 1;
+        quotient <<= 1;
+        if (remainder >= divisor) {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+    }
+    return quotient;
+}
+
+// Multipliers used to compute floor(m * 2^e2 / 10^q) and floor(m * 5^i / 2^j) with 64 bit products
+constexpr std::array<uint64_t, POW5_INV_TABLE_SIZE> makePow5InvSplit() {
+    std::array<uint64_t, POW5_INV_TABLE_SIZE> table{};
+    for (int q = 0; q < POW5_INV_TABLE_SIZE; ++q) {
+        table[q] = static_cast<uint64_t>(pow2Divide(pow5bits(q) - 1 + POW5_INV_BITCOUNT, pow5(q))) + 1;
+    }
+    return table;
+}
+
+constexpr std::array<uint64_t, POW5_TABLE_SIZE> makePow5Split() {
+    std::array<uint64_t, POW5_TABLE_SIZE> table{};
+    for (int i = 0; i < POW5_TABLE_SIZE; ++i) {
+        const int shift = pow5bits(i) - POW5_BITCOUNT;
+        table[i] = static_cast<uint64_t>(shift >= 0 ? pow5(i) >> shift : pow5(i) << -shift);
+    }
+    return table;
+}
+
+constexpr auto POW5_INV_SPLIT = makePow5InvSplit();
+constexpr auto POW5_SPLIT = makePow5Split();
+
+uint32_t mulShift(uint32_t m, uint64_t factor, int shift) {
+    return static_cast<uint32_t>((static_cast<uint128_t>(m) * factor) >> shift);
+}
+
+uint32_t mulPow5InvDivPow2(uint32_t m, int q, int j) {
+    return mulShift(m, POW5_INV_SPLIT[q], j);
+}
+
+uint32_t mulPow5DivPow2(uint32_t m, int i, int j) {
+    return mulShift(m, POW5_SPLIT[i], j);
+}
+
+bool multipleOfPowerOf5(uint32_t value, int p) {
+    int count = 0;
+    while (value % 5 == 0) {
+        value /= 5;
+        ++count;
+    }
+    return count >= p;
+}
+
+bool multipleOfPowerOf2(uint32_t value, int p) {
+    return (value & ((uint32_t(1) << p) - 1)) == 0;
+}
+
+int countDecimalDigits(uint32_t value) {
+    int digits = 1;
+    for (uint32_t bound = 10; digits < 10 && value >= bound; bound *= 10) {
+        ++digits;
+    }
+    return digits;
+}
+
+/**
+     * @brief Ryu algorithm (Ulf Adams, PLDI 2018) for single precision.
+     * Finds the shortest decimal in rounding interval of the value, closest to the value when there are several.
+     * Writes its digits and returns decimal exponent: value = digits * 10^exponent.
+     */
+int shortestDigits(uint32_t biasedExponent, uint32_t mantissa, char* buffer, int& length) {
+    int e2;
+    uint32_t m2;
+    if (biasedExponent == 0) {
+        e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = mantissa;
+    } else {
+        e2 = static_cast<int>(biasedExponent) - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = (uint32_t(1) << FLOAT_MANTISSA_BITS) | mantissa;
+    }
+    const bool acceptBounds = (m2 & 1) == 0;
+
+    // value and interval boundaries multiplied by 4
+    const uint32_t mv = 4 * m2;
+    const uint32_t mp = 4 * m2 + 2;
+    // lower neighbour is closer at powers of 2
+    const uint32_t mmShift = mantissa != 0 || biasedExponent <= 1;
+    const uint32_t mm = 4 * m2 - 1 - mmShift;
+
+    // scale to decimal: vr, vp, vm = floor(mv, mp, mm * 2^e2 / 10^e10)
+    uint32_t vr, vp, vm;
+    int e10;
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    uint32_t lastRemovedDigit = 0;
+    if (e2 >= 0) {
+        const int q = log10Pow2(e2);
+        e10 = q;
+        const int k = POW5_INV_BITCOUNT + pow5bits(q) - 1;
+        const int i = -e2 + q + k;
+        vr = mulPow5InvDivPow2(mv, q, i);
+        vp = mulPow5InvDivPow2(mp, q, i);
+        vm = mulPow5InvDivPow2(mm, q, i);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            // the loop below removes at most one digit, it has to be computed with one more digit of precision
+            const int l = POW5_INV_BITCOUNT + pow5bits(q - 1) - 1;
+            lastRemovedDigit = mulPow5InvDivPow2(mv, q - 1, -e2 + q - 1 + l) % 10;
+        }
+        if (q <= 9) {
+            // only one of mp, mv, mm can be a multiple of 5
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            } else if (acceptBounds) {
+                vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+            } else {
+                vp -= multipleOfPowerOf5(mp, q);
+            }
+        }
+    } else {
+        const int q = log10Pow5(-e2);
+        e10 = q + e2;
+        const int i = -e2 - q;
+        const int k = pow5bits(i) - POW5_BITCOUNT;
+        int j = q - k;
+        vr = mulPow5DivPow2(mv, i, j);
+        vp = mulPow5DivPow2(mp, i, j);
+        vm = mulPow5DivPow2(mm, i, j);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = q - 1 - (pow5bits(i + 1) - POW5_BITCOUNT);
+            lastRemovedDigit = mulPow5DivPow2(mv, i + 1, j) % 10;
+        }
+        if (q <= 1) {
+            // mv has at least q trailing zero bits, so vr is exact
+            vrIsTrailingZeros = true;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            } else {
+                --vp;
+            }
+        } else if (q < 31) {
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+        }
+    }
+
+    // remove digits as long as the interval contains a shorter decimal
+    int removed = 0;
+    uint32_t output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        // boundaries and ties are exact, they need round half to even
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            lastRemovedDigit = 4;
+        }
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    } else {
+        while (vp / 10 > vm / 10) {
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        output = vr + (vr == vm || lastRemovedDigit >= 5);
+    }
+
+    length = countDecimalDigits(output);
+    for (int i = length - 1; i >= 0; --i) {
+        buffer[i] = static_cast<char>('0' + output % 10);
+        output /= 10;
+    }
+    return e10 + removed;
+}
+
+char* writeExponent(int exponent, char* buffer) {
+    if (exponent < 0) {
+        *buffer++ = '-';
+        exponent = -exponent;
+    }
+    if (exponent >= 10) {
+        *buffer++ = static_cast<char>('0' + exponent / 10);
+        exponent %= 10;
+    }
+    *buffer++ = static_cast<char>('0' + exponent);
+    return buffer;
+}
+
+// Places decimal point or exponent in digits the same way as rapidjson writer
+char* prettify(char* buffer, int length, int k) {
+    const int kk = length + k;  // 10^(kk - 1) <= value < 10^kk
+    if (0 <= k && kk <= 21) {
+        // 1234e7 -> 12340000000.0
+        for (int i = length; i < kk; ++i) {
+            buffer[i] = '0';
+        }
+        buffer[kk] = '.';
+        buffer[kk + 1] = '0';
+        return &buffer[kk + 2];
+    }
+    if (0 < kk && kk <= 21) {
+        // 1234e-2 -> 12.34
+        std::memmove(&buffer[kk + 1], &buffer[kk], length - kk);
+        buffer[kk] = '.';
+        return &buffer[length + 1];
+    }
+    if (-6 < kk && kk <= 0) {
+        // 1234e-6 -> 0.001234
+        const int offset = 2 - kk;
+        std::memmove(&buffer[offset], &buffer[0], length);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        for (int i = 2; i < offset; ++i) {
+            buffer[i] = '0';
+        }
+        return &buffer[length + offset];
+    }
+    if (length == 1) {
+        // 1e30
+        buffer[1] = 'e';
+        return writeExponent(kk - 1, &buffer[2]);
+    }
+    // 1234e30 -> 1.234e33
+    std::memmove(&buffer[2], &buffer[1], length - 1);
+    buffer[1] = '.';
+    buffer[length + 1] = 'e';
+    return writeExponent(kk - 1, &buffer[length + 2]);
+}
+}  // namespace
+
+char* formatFloat(float value, char* buffer) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (bits >> 31) {
+        *buffer++ = '-';
+    }
+    const uint32_t biasedExponent = (bits >> 23) & 0xFF;
+    const uint32_t fraction = bits & 0x7FFFFF;
+    if (biasedExponent == 0 && fraction == 0) {
+        buffer[0] = '0';
+        buffer[1] = '.';
+        buffer[2] = '0';
+        return &buffer[3];
+    }
+    int length = 0;
+    const int k = shortestDigits(biasedExponent, fraction, buffer, length);
+    return prettify(buffer, length, k);
+}
+}  // namespace ovms
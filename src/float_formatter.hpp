@@ -0,0 +1,40 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+
+namespace ovms {
+
+/**
+     * @brief Buffer size sufficient for any value written by formatFloat
+     */
+constexpr size_t FORMATTED_FLOAT_MAX_LENGTH = 32;
+
+/**
+     * @brief Writes the shortest decimal representation of a finite float that is parsed back to the same float.
+     *
+     * Digits are generated with Ryu directly from float boundaries, so single precision values are not written
+     * with double precision noise (0.1f is written as 0.1, not as 0.10000000149011612).
+     * Notation is the same as in rapidjson writer: 1.0, 0.001, 1.5e-7, 1e30, -0.0.
+     *
+     * @param value finite float value
+     * @param buffer at least FORMATTED_FLOAT_MAX_LENGTH characters, not null terminated
+     *
+     * @return pointer past the last written character
+     */
+char* formatFloat(float value, char* buffer);
+}  // namespace ovms
@@ -0,0 +1,197 @@
+//****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "grpc_async_server.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/async_unary_call.h>
+
+#include "logging.hpp"
+#include "prediction_service.hpp"
+#include "request_arena.hpp"
+#include "worker_pool.hpp"
+
+namespace ovms {
+
+grpc::Status PredictionServiceSyncMethods::GetModelMetadata(
+    grpc::ServerContext* context,
+    const tensorflow::serving::GetModelMetadataRequest* request,
+    tensorflow::serving::GetModelMetadataResponse* response) {
+    return this->impl->GetModelMetadata(context, request, response);
+}
+
+::grpc::Status KFSInferenceServiceSyncMethods::ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) {
+    return this->impl->ServerLive(context, request, response);
+}
+::grpc::Status KFSInferenceServiceSyncMethods::ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) {
+    return this->impl->ServerReady(context, request, response);
+}
+::grpc::Status KFSInferenceServiceSyncMethods::ModelReady(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response) {
+    return this->impl->ModelReady(context, request, response);
+}
+::grpc::Status KFSInferenceServiceSyncMethods::ServerMetadata(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response) {
+    return this->impl->ServerMetadata(context, request, response);
+}
+::grpc::Status KFSInferenceServiceSyncMethods::ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) {
+    return this->impl->ModelMetadata(context, request, response);
+}
+::grpc::Status KFSInferenceServiceSyncMethods::ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<KFSStreamResponse, KFSRequest>* stream) {
+    return this->impl->ModelStreamInfer(context, stream);
+}
+
+namespace {
+// Completion queues cannot be shut down while there are calls which did not send response yet
+class InFlightCalls {
+    std::mutex mtx;
+    std::condition_variable allFinished;
+    size_t count = 0;
+
+public:
+    void begin() {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++count;
+    }
+    void end() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (--count == 0) {
+            allFinished.notify_all();
+        }
+    }
+    void waitForAll() {
+        std::unique_lock<std::mutex> lock(mtx);
+        allFinished.wait(lock, [this]() { return count == 0; });
+    }
+};
+
+class AsyncCall {
+public:
+    virtual ~AsyncCall() = default;
+    virtual void proceed(bool ok) = 0;
+};
+
+template <typename RequestType, typename ResponseType>
+struct AsyncUnaryMethod {
+    std::function<void(grpc::ServerContext*, RequestType*, grpc::ServerAsyncResponseWriter<ResponseType>*, grpc::ServerCompletionQueue*, void*)> request;
+    std::function<void(grpc::ServerContext*, const RequestType*, ResponseType*, std::function<void(grpc::Status)>)> handle;
+    InFlightCalls* inFlightCalls = nullptr;
+};
+
+template <typename RequestType, typename ResponseType>
+class AsyncUnaryCall : public AsyncCall {
+    const AsyncUnaryMethod<RequestType, ResponseType>& method;
+    grpc::ServerCompletionQueue& completionQueue;
+    grpc::ServerContext context;
+    // request and response with all their nested messages are allocated on arena of the call
+    RequestArena arena;
+    RequestType& request;
+    ResponseType& response;
+    grpc::ServerAsyncResponseWriter<ResponseType> responder;
+    bool started = false;
+
+public:
+    AsyncUnaryCall(const AsyncUnaryMethod<RequestType, ResponseType>& method, grpc::ServerCompletionQueue& completionQueue) :
+        method(method),
+        completionQueue(completionQueue),
+        request(*arena.create<RequestType>()),
+        response(*arena.create<ResponseType>()),
+        responder(&context) {
+        this->method.request(&this->context, &this->request, &this->responder, &this->completionQueue, this);
+    }
+
+    void proceed(bool ok) override {
+        if (!ok || this->started) {
+            // either response was sent or server is shutting down
+            delete this;
+            return;
+        }
+        this->started = true;
+        this->method.inFlightCalls->begin();
+        // accept next call of the same method
+        new AsyncUnaryCall(this->method, this->completionQueue);
+        this->method.handle(&this->context, &this->request, &this->response, [this, inFlightCalls = this->method.inFlightCalls](grpc::Status status) {
+            this->responder.Finish(this->response, status, this);
+            // call may be already deleted by completion queue thread
+            inFlightCalls->end();
+        });
+    }
+};
+}  // namespace
+
+struct GrpcAsyncCallsHandler::Methods {
+    AsyncUnaryMethod<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse> predict;
+    AsyncUnaryMethod<KFSRequest, KFSResponse> modelInfer;
+    InFlightCalls inFlightCalls;
+};
+
+GrpcAsyncCallsHandler::GrpcAsyncCallsHandler(AsyncPredictionService& predictionService, AsyncKFSInferenceService& kfsService, std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completionQueues) :
+    methods(std::make_unique<Methods>()),
+    completionQueues(std::move(completionQueues)),
+    blockingCallsPool(std::make_unique<WorkerPool>(std::max<size_t>(this->completionQueues.size(), 1))) {
+    WorkerPool& pool = *blockingCallsPool;
+    methods->predict.request = [&predictionService](auto* context, auto* request, auto* responder, auto* cq, void* tag) {
+        predictionService.RequestPredict(context, request, responder, cq, cq, tag);
+    };
+    methods->predict.handle = [&predictionService, &pool](auto* context, auto* request, auto* response, auto onComplete) {
+        predictionService.getImpl().PredictAsync(context, request, response, std::move(onComplete), pool);
+    };
+    methods->predict.inFlightCalls = &methods->inFlightCalls;
+    methods->modelInfer.request = [&kfsService](auto* context, auto* request, auto* responder, auto* cq, void* tag) {
+        kfsService.RequestModelInfer(context, request, responder, cq, cq, tag);
+    };
+    methods->modelInfer.handle = [&kfsService, &pool](auto* context, auto* request, auto* response, auto onComplete) {
+        kfsService.getImpl().ModelInferAsync(context, request, response, std::move(onComplete), pool);
+    };
+    methods->modelInfer.inFlightCalls = &methods->inFlightCalls;
+}
+
+GrpcAsyncCallsHandler::~GrpcAsyncCallsHandler() {
+    shutdown();
+}
+
+void GrpcAsyncCallsHandler::start() {
+    SPDLOG_DEBUG("Starting {} gRPC completion queue threads", completionQueues.size());
+    for (auto& completionQueue : completionQueues) {
+        new AsyncUnaryCall(methods->predict, *completionQueue);
+        new AsyncUnaryCall(methods->modelInfer, *completionQueue);
+        threads.emplace_back([cq = completionQueue.get()]() {
+            void* tag = nullptr;
+            bool ok = false;
+            while (cq->Next(&tag, &ok)) {
+                static_cast<AsyncCall*>(tag)->proceed(ok);
+            }
+        });
+    }
+}
+
+void GrpcAsyncCallsHandler::shutdown() {
+    // server does not accept new calls anymore, calls still in inference send response to completion queue
+    methods->inFlightCalls.waitForAll();
+    for (auto& completionQueue : completionQueues) {
+        completionQueue->Shutdown();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+    completionQueues.clear();
+}
+}  // namespace ovms
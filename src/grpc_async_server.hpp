@@ -0,0 +1,105 @@
+//****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/server_context.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+
+namespace grpc {
+class ServerCompletionQueue;
+}
+
+namespace ovms {
+class PredictionServiceImpl;
+class WorkerPool;
+
+/**
+ * Generated WithAsyncMethod_* templates require default constructible base class,
+ * so methods served synchronously are delegated to regular service implementation.
+ */
+class PredictionServiceSyncMethods : public tensorflow::serving::PredictionService::Service {
+protected:
+    PredictionServiceImpl* impl = nullptr;
+
+public:
+    grpc::Status GetModelMetadata(
+        grpc::ServerContext* context,
+        const tensorflow::serving::GetModelMetadataRequest* request,
+        tensorflow::serving::GetModelMetadataResponse* response) override;
+};
+
+class KFSInferenceServiceSyncMethods : public GRPCInferenceService::Service {
+protected:
+    KFSInferenceServiceImpl* impl = nullptr;
+
+public:
+    ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
+    ::grpc::Status ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) override;
+    ::grpc::Status ModelReady(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response) override;
+    ::grpc::Status ServerMetadata(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response) override;
+    ::grpc::Status ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) override;
+    ::grpc::Status ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<KFSStreamResponse, KFSRequest>* stream) override;
+};
+
+class AsyncPredictionService final : public tensorflow::serving::PredictionService::WithAsyncMethod_Predict<PredictionServiceSyncMethods> {
+public:
+    AsyncPredictionService(PredictionServiceImpl& impl) { this->impl = &impl; }
+    PredictionServiceImpl& getImpl() { return *this->impl; }
+};
+
+class AsyncKFSInferenceService final : public GRPCInferenceService::WithAsyncMethod_ModelInfer<KFSInferenceServiceSyncMethods> {
+public:
+    AsyncKFSInferenceService(KFSInferenceServiceImpl& impl) { this->impl = &impl; }
+    KFSInferenceServiceImpl& getImpl() { return *this->impl; }
+};
+
+/**
+ * @brief Serves Predict and ModelInfer calls from completion queues
+ *
+ * Each completion queue is polled by a single thread which only accepts calls and starts inference.
+ * Responses are sent from inference completion callbacks. Calls which would block, like pipelines,
+ * are executed on separate pool with the same number of threads as completion queues.
+ */
+class GrpcAsyncCallsHandler {
+    struct Methods;
+
+    std::unique_ptr<Methods> methods;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completionQueues;
+    std::vector<std::thread> threads;
+    std::unique_ptr<WorkerPool> blockingCallsPool;
+
+public:
+    GrpcAsyncCallsHandler(AsyncPredictionService& predictionService, AsyncKFSInferenceService& kfsService, std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completionQueues);
+    ~GrpcAsyncCallsHandler();
+
+    void start();
+
+    /**
+     * @brief Has to be called after gRPC server shutdown, waits until responses of all started calls are sent
+     */
+    void shutdown();
+};
+}  // namespace ovms
@@ -102,6 +102,14 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::BINARY_IMAGES_RESOLUTION_MISMATCH, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::STRING_VAL_EMPTY, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::BYTES_CONTENTS_EMPTY, grpc::StatusCode::INVALID_ARGUMENT},
+
+        // KServe shared memory extension
+        {StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED, grpc::StatusCode::ALREADY_EXISTS},
+        {StatusCode::SHARED_MEMORY_REGION_NOT_FOUND, grpc::StatusCode::NOT_FOUND},
+        {StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::SHARED_MEMORY_INVALID_RANGE, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::SHARED_MEMORY_DISABLED, grpc::StatusCode::FAILED_PRECONDITION},
     };
     auto it = grpcStatusMap.find(status.getCode());
     if (it != grpcStatusMap.end()) {
@@ -121,52 +121,106 @@ Status GRPCServerModule::start(const ovms::Config& config) {
         return status;
     }
 
-    ServerBuilder builder;
-    builder.SetMaxReceiveMessageSize(GIGABYTE);
-    builder.SetMaxSendMessageSize(GIGABYTE);
-    builder.AddListeningPort(config.grpcBindAddress() + ":" + std::to_string(config.port()), grpc::InsecureServerCredentials());
-    builder.RegisterService(&tfsPredictService);
-    builder.RegisterService(&tfsModelService);
-    builder.RegisterService(&kfsGrpcInferenceService);
-    for (const GrpcChannelArgument& channel_argument : channel_arguments) {
-        // gRPC accept arguments of two types, int and string. We will attempt to
-        // parse each arg as int and pass it on as such if successful. Otherwise we
-        // will pass it as a string. gRPC will log arguments that were not accepted.
-        SPDLOG_DEBUG("setting grpc channel argument {}: {}", channel_argument.key, channel_argument.value);
-        try {
-            int i = std::stoi(channel_argument.value);
-            builder.AddChannelArgument(channel_argument.key, i);
-        } catch (std::invalid_argument const& e) {
-            builder.AddChannelArgument(channel_argument.key, channel_argument.value);
-        } catch (std::out_of_range const& e) {
-            SPDLOG_WARN("Out of range parameter {} : {}", channel_argument.key, channel_argument.value);
-        }
+    // port 0 disables TCP listener only when unix domain socket replaces it
+    const bool listenOnTcp = config.port() != 0 || config.grpcUdsPath().empty();
+    if (config.grpcAsync()) {
+        asyncTfsPredictService = std::make_unique<AsyncPredictionService>(tfsPredictService);
+        asyncKfsGrpcInferenceService = std::make_unique<AsyncKFSInferenceService>(kfsGrpcInferenceService);
     }
+    // TCP port is shared by all servers, while unix domain socket can be bound by one of them only
+    auto prepareBuilder = [&](ServerBuilder& builder, bool listenOnUds) {
+        builder.SetMaxReceiveMessageSize(GIGABYTE);
+        builder.SetMaxSendMessageSize(GIGABYTE);
+        if (listenOnTcp) {
+            builder.AddListeningPort(config.grpcBindAddress() + ":" + std::to_string(config.port()), grpc::InsecureServerCredentials());
+        }
+        if (listenOnUds) {
+            builder.AddListeningPort("unix:" + config.grpcUdsPath(), grpc::InsecureServerCredentials());
+        }
+        if (config.grpcAsync()) {
+            builder.RegisterService(asyncTfsPredictService.get());
+            builder.RegisterService(&tfsModelService);
+            builder.RegisterService(asyncKfsGrpcInferenceService.get());
+        } else {
+            builder.RegisterService(&tfsPredictService);
+            builder.RegisterService(&tfsModelService);
+            builder.RegisterService(&kfsGrpcInferenceService);
+        }
+        for (const GrpcChannelArgument& channel_argument : channel_arguments) {
+            // gRPC accept arguments of two types, int and string. We will attempt to
+            // parse each arg as int and pass it on as such if successful. Otherwise we
+            // will pass it as a string. gRPC will log arguments that were not accepted.
+            SPDLOG_DEBUG("setting grpc channel argument {}: {}", channel_argument.key, channel_argument.value);
+            try {
+                int i = std::stoi(channel_argument.value);
+                builder.AddChannelArgument(channel_argument.key, i);
+            } catch (std::invalid_argument const& e) {
+                builder.AddChannelArgument(channel_argument.key, channel_argument.value);
+            } catch (std::out_of_range const& e) {
+                SPDLOG_WARN("Out of range parameter {} : {}", channel_argument.key, channel_argument.value);
+            }
+        }
+    };
+    ServerBuilder firstServerBuilder;
+    prepareBuilder(firstServerBuilder, !config.grpcUdsPath().empty());
     uint grpcServersCount = getGRPCServersCount(config);
+    // in async mode single server is polled by multiple completion queue threads
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completionQueues;
+    if (config.grpcAsync()) {
+        SPDLOG_DEBUG("Starting asynchronous gRPC server with completion queues: {}", grpcServersCount);
+        for (uint i = 0; i < grpcServersCount; ++i) {
+            completionQueues.push_back(firstServerBuilder.AddCompletionQueue());
+        }
+        grpcServersCount = 1;
+    }
+    if (!listenOnTcp && grpcServersCount > 1) {
+        SPDLOG_DEBUG("gRPC servers count: {} reduced to 1, as there is no TCP port to share", grpcServersCount);
+        grpcServersCount = 1;
+    }
     servers.reserve(grpcServersCount);
     SPDLOG_DEBUG("Starting gRPC servers: {}", grpcServersCount);
 
-    if (!isPortAvailable(config.port())) {
+    if (listenOnTcp && !isPortAvailable(config.port())) {
         std::stringstream ss;
         ss << "at " << config.grpcBindAddress() << ":" << std::to_string(config.port()) << " - port is busy";
         auto status = Status(StatusCode::FAILED_TO_START_GRPC_SERVER, ss.str());
         SPDLOG_ERROR(status.string());
         return status;
     }
+    std::unique_ptr<ServerBuilder> nextServersBuilder;
+    if (grpcServersCount > 1) {
+        nextServersBuilder = std::make_unique<ServerBuilder>();
+        prepareBuilder(*nextServersBuilder, false);
+    }
     for (uint i = 0; i < grpcServersCount; ++i) {
-        std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+        std::unique_ptr<grpc::Server> server = (i == 0) ? firstServerBuilder.BuildAndStart() : nextServersBuilder->BuildAndStart();
         if (server == nullptr) {
             std::stringstream ss;
             ss << "at " << config.grpcBindAddress() << ":" << std::to_string(config.port());
+            if (i == 0 && !config.grpcUdsPath().empty()) {
+                ss << " and unix:" << config.grpcUdsPath();
+            }
             auto status = Status(StatusCode::FAILED_TO_START_GRPC_SERVER, ss.str());
             SPDLOG_ERROR(status.string());
             return status;
         }
+        if (i == 0) {
+            udsPath = config.grpcUdsPath();
+        }
         servers.push_back(std::move(server));
     }
+    if (config.grpcAsync()) {
+        asyncCallsHandler = std::make_unique<GrpcAsyncCallsHandler>(*asyncTfsPredictService, *asyncKfsGrpcInferenceService, std::move(completionQueues));
+        asyncCallsHandler->start();
+    }
     state = ModuleState::INITIALIZED;
     SPDLOG_INFO("{} started", GRPC_SERVER_MODULE_NAME);
-    SPDLOG_INFO("Started gRPC server on port {}", config.port());
+    if (listenOnTcp) {
+        SPDLOG_INFO("Started gRPC server on port {}", config.port());
+    }
+    if (!udsPath.empty()) {
+        SPDLOG_INFO("Started gRPC server on unix domain socket {}", udsPath);
+    }
     return StatusCode::OK;
 }
 
@@ -179,7 +233,18 @@ void GRPCServerModule::shutdown() {
         server->Shutdown();
         SPDLOG_INFO("Shutdown gRPC server");
     }
+    // completion queues can be drained only after servers are shut down
+    if (asyncCallsHandler) {
+        asyncCallsHandler->shutdown();
+        asyncCallsHandler.reset();
+    }
     servers.clear();
+    if (!udsPath.empty()) {
+        unlink(udsPath.c_str());
+        udsPath.clear();
+    }
+    asyncTfsPredictService.reset();
+    asyncKfsGrpcInferenceService.reset();
     state = ModuleState::SHUTDOWN;
     SPDLOG_INFO("{} shutdown", GRPC_SERVER_MODULE_NAME);
 }
@@ -15,11 +15,13 @@
 //*****************************************************************************
 #pragma once
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <grpcpp/server.h>
 
+#include "grpc_async_server.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
 #include "model_service.hpp"
 #include "module.hpp"
@@ -34,7 +36,11 @@ class GRPCServerModule : public Module {
     PredictionServiceImpl tfsPredictService;
     ModelServiceImpl tfsModelService;
     mutable KFSInferenceServiceImpl kfsGrpcInferenceService;
+    std::unique_ptr<AsyncPredictionService> asyncTfsPredictService;
+    std::unique_ptr<AsyncKFSInferenceService> asyncKfsGrpcInferenceService;
     std::vector<std::unique_ptr<grpc::Server>> servers;
+    std::unique_ptr<GrpcAsyncCallsHandler> asyncCallsHandler;
+    std::string udsPath;
 
 public:
     GRPCServerModule(Server& server);
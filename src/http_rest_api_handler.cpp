@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "http_rest_api_handler.hpp"
 
+#include <charconv>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -28,6 +29,8 @@
 #include <rapidjson/writer.h>
 #include <spdlog/spdlog.h>
 
+#include "capi_frontend/inferencerequest.hpp"
+#include "capi_frontend/inferenceresponse.hpp"
 #include "config.hpp"
 #include "dags/pipeline.hpp"
 #include "dags/pipelinedefinition.hpp"
@@ -37,6 +40,7 @@
 #include "get_model_metadata_impl.hpp"
 #include "grpcservermodule.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "metric_module.hpp"
 #include "metric_registry.hpp"
@@ -45,8 +49,11 @@
 #include "modelinstance.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
+#include "precision.hpp"
 #include "prediction_service_utils.hpp"
+#include "request_arena.hpp"
 #include "rest_parser.hpp"
+#include "rest_url_router.hpp"
 #include "rest_utils.hpp"
 #include "servablemanagermodule.hpp"
 #include "server.hpp"
@@ -72,40 +79,7 @@ const std::string DEFAULT_VERSION = "DEFAULT";
 
 namespace ovms {
 
-const std::string HttpRestApiHandler::predictionRegexExp =
-    R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))";
-const std::string HttpRestApiHandler::modelstatusRegexExp =
-    R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata))?)";
-const std::string HttpRestApiHandler::configReloadRegexExp = R"((.?)\/v1\/config\/reload)";
-const std::string HttpRestApiHandler::configStatusRegexExp = R"((.?)\/v1\/config)";
-
-const std::string HttpRestApiHandler::kfs_modelreadyRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(ready)))";
-const std::string HttpRestApiHandler::kfs_modelmetadataRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/)?)";
-const std::string HttpRestApiHandler::kfs_inferRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(infer)))";
-const std::string HttpRestApiHandler::kfs_serverreadyRegexExp =
-    R"(/v2/health/ready)";
-const std::string HttpRestApiHandler::kfs_serverliveRegexExp =
-    R"(/v2/health/live)";
-const std::string HttpRestApiHandler::kfs_servermetadataRegexExp =
-    R"(/v2)";
-
-const std::string HttpRestApiHandler::metricsRegexExp = R"((.?)\/metrics)";
-
 HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_ms) :
-    predictionRegex(predictionRegexExp),
-    modelstatusRegex(modelstatusRegexExp),
-    configReloadRegex(configReloadRegexExp),
-    configStatusRegex(configStatusRegexExp),
-    kfs_modelreadyRegex(kfs_modelreadyRegexExp),
-    kfs_modelmetadataRegex(kfs_modelmetadataRegexExp),
-    kfs_inferRegex(kfs_inferRegexExp),
-    kfs_serverreadyRegex(kfs_serverreadyRegexExp),
-    kfs_serverliveRegex(kfs_serverliveRegexExp),
-    kfs_servermetadataRegex(kfs_servermetadataRegexExp),
-    metricsRegex(metricsRegexExp),
     timeout_in_ms(timeout_in_ms),
     ovmsServer(ovmsServer),
 
@@ -119,16 +93,18 @@ HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_
     registerAll();
 }
 
-Status HttpRestApiHandler::parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version) {
+Status HttpRestApiHandler::parseModelVersion(std::string_view model_version_str, std::optional<int64_t>& model_version) {
     if (!model_version_str.empty()) {
-        try {
-            model_version = std::stoll(model_version_str.c_str());
-        } catch (std::out_of_range const& ex) {
+        int64_t version = 0;
+        auto [ptr, ec] = std::from_chars(model_version_str.data(), model_version_str.data() + model_version_str.size(), version);
+        if (ec == std::errc::result_out_of_range) {
             return StatusCode::MODEL_VERSION_MISSING;
-        } catch (std::exception& e) {
+        }
+        if (ec != std::errc() || ptr != model_version_str.data() + model_version_str.size()) {
             SPDLOG_DEBUG("Couldn't parse model version {}", model_version_str);
             return StatusCode::REST_COULD_NOT_PARSE_VERSION;
         }
+        model_version = version;
     }
     return StatusCode::OK;
 }
@@ -180,6 +156,15 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(KFS_GetServerMetadata, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processServerMetadataKFSRequest(request_components, response, request_body);
     });
+    registerHandler(KFS_SystemSharedMemoryStatus, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
+        return processSystemSharedMemoryStatusKFSRequest(request_components, response, request_body);
+    });
+    registerHandler(KFS_SystemSharedMemoryRegister, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
+        return processSystemSharedMemoryRegisterKFSRequest(request_components, response, request_body);
+    });
+    registerHandler(KFS_SystemSharedMemoryUnregister, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
+        return processSystemSharedMemoryUnregisterKFSRequest(request_components, response, request_body);
+    });
     registerHandler(Metrics, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processMetrics(request_components, response, request_body);
     });
@@ -220,6 +205,83 @@ Status HttpRestApiHandler::processServerMetadataKFSRequest(const HttpRequestComp
     return StatusCode::OK;
 }
 
+static Status checkSystemSharedMemoryAllowed() {
+    if (!ovms::Config::instance().allowSystemSharedMemory()) {
+        SPDLOG_DEBUG("System shared memory request rejected, allow_system_shared_memory is not set");
+        return StatusCode::SHARED_MEMORY_DISABLED;
+    }
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processSystemSharedMemoryStatusKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    auto status = checkSystemSharedMemoryAllowed();
+    if (!status.ok()) {
+        return status;
+    }
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    status = SharedMemoryRegistry::instance().getRegions(request_components.shared_memory_region_name, regions);
+    if (!status.ok()) {
+        return status;
+    }
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartArray();
+    for (const auto& region : regions) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(region->getName().c_str());
+        writer.Key("key");
+        writer.String(region->getKey().c_str());
+        writer.Key("offset");
+        writer.Uint64(region->getOffset());
+        writer.Key("byte_size");
+        writer.Uint64(region->getByteSize());
+        writer.EndObject();
+    }
+    writer.EndArray();
+    response = buffer.GetString();
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processSystemSharedMemoryRegisterKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    auto status = checkSystemSharedMemoryAllowed();
+    if (!status.ok()) {
+        return status;
+    }
+    Document doc;
+    if (doc.Parse(request_body.c_str(), request_body.size()).HasParseError()) {
+        SPDLOG_DEBUG("Shared memory register request is not a valid JSON");
+        return StatusCode::JSON_INVALID;
+    }
+    if (!doc.IsObject()) {
+        SPDLOG_DEBUG("Shared memory register request body is not an object");
+        return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
+    }
+    auto keyItr = doc.FindMember("key");
+    auto byteSizeItr = doc.FindMember("byte_size");
+    auto offsetItr = doc.FindMember("offset");
+    if (keyItr == doc.MemberEnd() || !keyItr->value.IsString() ||
+        byteSizeItr == doc.MemberEnd() || !byteSizeItr->value.IsUint64() ||
+        (offsetItr != doc.MemberEnd() && !offsetItr->value.IsUint64())) {
+        SPDLOG_DEBUG("Shared memory register request requires string key, unsigned byte_size and optional unsigned offset");
+        return Status(StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, "Request requires string key, unsigned byte_size and optional unsigned offset");
+    }
+    uint64_t offset = offsetItr != doc.MemberEnd() ? offsetItr->value.GetUint64() : 0;
+    return SharedMemoryRegistry::instance().registerRegion(request_components.shared_memory_region_name, keyItr->value.GetString(), offset, byteSizeItr->value.GetUint64());
+}
+
+Status HttpRestApiHandler::processSystemSharedMemoryUnregisterKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    auto status = checkSystemSharedMemoryAllowed();
+    if (!status.ok()) {
+        return status;
+    }
+    if (request_components.shared_memory_region_name.empty()) {
+        SharedMemoryRegistry::instance().unregisterAllRegions();
+        return StatusCode::OK;
+    }
+    return SharedMemoryRegistry::instance().unregisterRegion(request_components.shared_memory_region_name);
+}
+
 void HttpRestApiHandler::parseParams(Value& scope, Document& doc) {
     Value::ConstMemberIterator itr = scope.FindMember("parameters");
     if (itr != scope.MemberEnd()) {
@@ -285,13 +347,16 @@ static size_t calculateBinaryDataSize(::KFSRequest::InferInputTensor& input) {
     return binary_data_size;
 }
 
-static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string& request_body, size_t endOfJson) {
-    const char* binary_inputs_buffer = &(request_body[endOfJson]);
+static Status handleBinaryInputs(::KFSRequest& grpc_request, std::string_view request_body, size_t endOfJson) {
+    const char* binary_inputs_buffer = request_body.data() + endOfJson;
     size_t binary_buffer_size = request_body.length() - endOfJson;
 
     size_t binary_input_offset = 0;
     for (int i = 0; i < grpc_request.mutable_inputs()->size(); i++) {
         auto input = grpc_request.mutable_inputs()->Mutable(i);
+        if (usesSharedMemory(input->parameters())) {
+            continue;
+        }
         auto binary_data_size_parameter = input->parameters().find("binary_data_size");
         size_t binary_input_size = 0;
         if (binary_data_size_parameter != input->parameters().end()) {
@@ -314,6 +379,10 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
                 binary_input_size = calculateBinaryDataSize(*input);
             }
         }
+        // raw input contents are matched with inputs by position, inputs in shared memory get empty placeholders
+        while (grpc_request.raw_input_contents_size() < i) {
+            grpc_request.add_raw_input_contents();
+        }
         auto status = handleBinaryInput(binary_input_size, binary_input_offset, binary_buffer_size, binary_inputs_buffer, *input, grpc_request.add_raw_input_contents());
         if (!status.ok())
             return status;
@@ -321,16 +390,22 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
     return StatusCode::OK;
 }
 
-Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength) {
-    KFSRestParser requestParser;
+Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, std::string_view request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength) {
+    // parsed request is swapped into grpc_request, which is cheap only for protos of the same arena
+    KFSRestParser requestParser(grpc_request.GetArena());
 
     size_t endOfJson = inferenceHeaderContentLength.value_or(request_body.length());
-    auto status = requestParser.parse(request_body.substr(0, endOfJson).c_str());
+    if (endOfJson > request_body.length()) {
+        SPDLOG_DEBUG("Inference header content length: {} exceeds request body size: {}", endOfJson, request_body.length());
+        return StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID;
+    }
+    // json part is parsed in place, parsed request is moved out of parser without copying its contents
+    auto status = requestParser.parse(request_body.data(), endOfJson);
     if (!status.ok()) {
         SPDLOG_DEBUG("Parsing http request failed");
         return status;
     }
-    grpc_request = requestParser.getProto();
+    grpc_request.Swap(&requestParser.getProto());
     status = handleBinaryInputs(grpc_request, request_body, endOfJson);
     if (!status.ok()) {
         return status;
@@ -369,6 +444,66 @@ static std::set<std::string> getRequestedBinaryOutputsNames(::KFSRequest& grpc_r
     return binaryOutputs;
 }
 
+// Outputs of precisions without JSON serialization in InferenceResponse writer are served with response proto
+static bool canInferWithTensors(const ModelInstance& modelInstance) {
+    if (modelInstance.getModelConfig().isStateful()) {
+        return false;
+    }
+    for (const auto& [name, output] : modelInstance.getOutputsInfo()) {
+        switch (output->getPrecision()) {
+        case Precision::FP64:
+        case Precision::FP32:
+        case Precision::I64:
+        case Precision::I32:
+        case Precision::I16:
+        case Precision::I8:
+        case Precision::U64:
+        case Precision::U32:
+        case Precision::U16:
+        case Precision::U8:
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HttpRestApiHandler::processSingleModelInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength, ServableMetricReporter*& reporterOut, Status& status) {
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    if (!this->modelManager.getModelInstance(request_components.model_name, request_components.model_version.value_or(0), modelInstance, modelInstanceUnloadGuard).ok() ||
+        !canInferWithTensors(*modelInstance)) {
+        return false;
+    }
+    size_t endOfJson = request_components.inferenceHeaderContentLength.value_or(request_body.length());
+    if (endOfJson > request_body.length()) {
+        return false;
+    }
+    Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
+    timer.start(PREPARE_GRPC_REQUEST);
+    InferenceRequest request(modelInstance->getName().c_str(), modelInstance->getVersion());
+    KFSRestTensorParser requestParser(request);
+    if (!requestParser.parse(request_body, endOfJson)) {
+        SPDLOG_DEBUG("Request for model: {} cannot be parsed into tensors, falling back to request proto", request_components.model_name);
+        return false;
+    }
+    timer.stop(PREPARE_GRPC_REQUEST);
+    SPDLOG_DEBUG("Preparing tensors of request time: {} ms", timer.elapsed<microseconds>(PREPARE_GRPC_REQUEST) / 1000);
+    InferenceResponse inferenceResponse(modelInstance->getName(), modelInstance->getVersion());
+    status = modelInstance->infer(&request, &inferenceResponse, modelInstanceUnloadGuard);
+    if (!status.ok()) {
+        // request is processed again with request proto to report errors the same way as before
+        SPDLOG_DEBUG("Inference of request parsed into tensors failed for model: {}, falling back to request proto", request_components.model_name);
+        return false;
+    }
+    reporterOut = &modelInstance->getMetricReporter();
+    INCREMENT_IF_ENABLED(reporterOut->getInferRequestMetric(ExecutionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelInfer}, status.ok()));
+    status = ovms::makeJsonFromPredictResponse(inferenceResponse, requestParser.getId(), &response, inferenceHeaderContentLength, requestParser.getBinaryOutputsNames(), ovms::Config::instance().restPrettyJson());
+    return true;
+}
+
 Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength) {
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
@@ -376,7 +511,21 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     std::string modelName(request_components.model_name);
     std::string modelVersionLog = request_components.model_version.has_value() ? std::to_string(request_components.model_version.value()) : DEFAULT_VERSION;
     SPDLOG_DEBUG("Processing REST request for model: {}; version: {}", modelName, modelVersionLog);
-    ::KFSRequest grpc_request;
+    if (this->modelManager.modelExists(modelName)) {
+        Status status;
+        if (processSingleModelInferKFSRequest(request_components, response, request_body, inferenceHeaderContentLength, reporter, status)) {
+            if (!status.ok()) {
+                return status;
+            }
+            timer.stop(TOTAL);
+            double totalTime = timer.elapsed<std::chrono::microseconds>(TOTAL);
+            SPDLOG_DEBUG("Total REST request processing time: {} ms", totalTime / 1000);
+            OBSERVE_IF_ENABLED(reporter->requestTimeRest, totalTime);
+            return StatusCode::OK;
+        }
+    }
+    RequestArena arena;
+    ::KFSRequest& grpc_request = *arena.create<::KFSRequest>();
     timer.start(PREPARE_GRPC_REQUEST);
     using std::chrono::microseconds;
     auto status = prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength);
@@ -391,14 +540,14 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     }
     timer.stop(PREPARE_GRPC_REQUEST);
     SPDLOG_DEBUG("Preparing grpc request time: {} ms", timer.elapsed<std::chrono::microseconds>(PREPARE_GRPC_REQUEST) / 1000);
-    ::KFSResponse grpc_response;
+    ::KFSResponse& grpc_response = *arena.create<::KFSResponse>();
     const Status gstatus = kfsGrpcImpl.ModelInferImpl(nullptr, &grpc_request, &grpc_response, executionContext, reporter);
     if (!gstatus.ok()) {
         return gstatus;
     }
     std::set<std::string> requestedBinaryOutputsNames = getRequestedBinaryOutputsNames(grpc_request);
     std::string output;
-    status = ovms::makeJsonFromPredictResponse(grpc_response, &output, inferenceHeaderContentLength, requestedBinaryOutputsNames);
+    status = ovms::makeJsonFromPredictResponse(grpc_response, &output, inferenceHeaderContentLength, requestedBinaryOutputsNames, ovms::Config::instance().restPrettyJson());
     if (!status.ok()) {
         return status;
     }
@@ -528,7 +677,7 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
     const std::string_view http_method,
     const std::string& request_path,
     const std::vector<std::pair<std::string, std::string>>& headers) {
-    std::smatch sm;
+    RestUrlComponents urlComponents;
     requestComponents.http_method = http_method;
     if (http_method != "POST" && http_method != "GET") {
         return StatusCode::REST_UNSUPPORTED_METHOD;
@@ -540,29 +689,26 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
     }
 
     if (http_method == "POST") {
-        if (std::regex_match(request_path, sm, predictionRegex)) {
+        if (matchPredictionUrl(request_path, urlComponents)) {
             requestComponents.type = Predict;
-            requestComponents.model_name = sm[2];
+            requestComponents.model_name = urlComponents.modelName;
 
-            std::string model_version_str = sm[3];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+            auto status = parseModelVersion(urlComponents.modelVersion, requestComponents.model_version);
             if (!status.ok())
                 return status;
 
-            std::string model_version_label_str = sm[4];
-            if (!model_version_label_str.empty()) {
-                requestComponents.model_version_label = model_version_label_str;
+            if (!urlComponents.modelVersionLabel.empty()) {
+                requestComponents.model_version_label = urlComponents.modelVersionLabel;
             }
 
-            requestComponents.processing_method = sm[5];
+            requestComponents.processing_method = urlComponents.processingMethod;
 
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_inferRegex, std::regex_constants::match_any)) {
+        if (matchKFSInferUrl(request_path, urlComponents)) {
             requestComponents.type = KFS_Infer;
-            requestComponents.model_name = sm[1];
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+            requestComponents.model_name = urlComponents.modelName;
+            auto status = parseModelVersion(urlComponents.modelVersion, requestComponents.model_version);
             if (!status.ok())
                 return status;
 
@@ -571,26 +717,34 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
                 return status;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, configReloadRegex)) {
+        if (matchConfigReloadUrl(request_path)) {
             requestComponents.type = ConfigReload;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, modelstatusRegex))
+        if (matchKFSSystemSharedMemoryRegisterUrl(request_path, urlComponents)) {
+            requestComponents.type = KFS_SystemSharedMemoryRegister;
+            requestComponents.shared_memory_region_name = urlComponents.sharedMemoryRegionName;
+            return StatusCode::OK;
+        }
+        if (matchKFSSystemSharedMemoryUnregisterUrl(request_path, urlComponents)) {
+            requestComponents.type = KFS_SystemSharedMemoryUnregister;
+            requestComponents.shared_memory_region_name = urlComponents.sharedMemoryRegionName;
+            return StatusCode::OK;
+        }
+        if (matchModelStatusUrl(request_path, urlComponents))
             return StatusCode::REST_UNSUPPORTED_METHOD;
     } else if (http_method == "GET") {
-        if (std::regex_match(request_path, sm, modelstatusRegex)) {
-            requestComponents.model_name = sm[2];
-            std::string model_version_str = sm[3];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+        if (matchModelStatusUrl(request_path, urlComponents)) {
+            requestComponents.model_name = urlComponents.modelName;
+            auto status = parseModelVersion(urlComponents.modelVersion, requestComponents.model_version);
             if (!status.ok())
                 return status;
 
-            std::string model_version_label_str = sm[4];
-            if (!model_version_label_str.empty()) {
-                requestComponents.model_version_label = model_version_label_str;
+            if (!urlComponents.modelVersionLabel.empty()) {
+                requestComponents.model_version_label = urlComponents.modelVersionLabel;
             }
 
-            requestComponents.model_subresource = sm[5];
+            requestComponents.model_subresource = urlComponents.modelSubresource;
             if (!requestComponents.model_subresource.empty() && requestComponents.model_subresource == "metadata") {
                 requestComponents.type = GetModelMetadata;
             } else {
@@ -598,43 +752,46 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             }
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, configStatusRegex)) {
+        if (matchConfigStatusUrl(request_path)) {
             requestComponents.type = ConfigStatus;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_serverliveRegex)) {
+        if (matchKFSServerLiveUrl(request_path)) {
             requestComponents.type = KFS_GetServerLive;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_serverreadyRegex)) {
+        if (matchKFSServerReadyUrl(request_path)) {
             requestComponents.type = KFS_GetServerReady;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_servermetadataRegex)) {
+        if (matchKFSServerMetadataUrl(request_path)) {
             requestComponents.type = KFS_GetServerMetadata;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_modelmetadataRegex)) {
-            requestComponents.model_name = sm[1];
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+        if (matchKFSSystemSharedMemoryStatusUrl(request_path, urlComponents)) {
+            requestComponents.type = KFS_SystemSharedMemoryStatus;
+            requestComponents.shared_memory_region_name = urlComponents.sharedMemoryRegionName;
+            return StatusCode::OK;
+        }
+        if (matchKFSModelMetadataUrl(request_path, urlComponents)) {
+            requestComponents.model_name = urlComponents.modelName;
+            auto status = parseModelVersion(urlComponents.modelVersion, requestComponents.model_version);
             if (!status.ok())
                 return status;
             requestComponents.type = KFS_GetModelMetadata;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, kfs_modelreadyRegex)) {
-            requestComponents.model_name = sm[1];
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+        if (matchKFSModelReadyUrl(request_path, urlComponents)) {
+            requestComponents.model_name = urlComponents.modelName;
+            auto status = parseModelVersion(urlComponents.modelVersion, requestComponents.model_version);
             if (!status.ok())
                 return status;
             requestComponents.type = KFS_GetModelReady;
             return StatusCode::OK;
         }
-        if (std::regex_match(request_path, sm, predictionRegex))
+        if (matchPredictionUrl(request_path, urlComponents))
             return StatusCode::REST_UNSUPPORTED_METHOD;
-        if (std::regex_match(request_path, sm, metricsRegex)) {
+        if (matchMetricsUrl(request_path)) {
             requestComponents.type = Metrics;
             return StatusCode::OK;
         }
@@ -650,7 +807,6 @@ Status HttpRestApiHandler::processRequest(
     std::string* response,
     HttpResponseComponents& responseComponents) {
 
-    std::smatch sm;
     std::string request_path_str(request_path);
     if (FileSystem::isPathEscaped(request_path_str)) {
         SPDLOG_DEBUG("Path {} escape with .. is forbidden.", request_path);
@@ -17,8 +17,8 @@
 
 #include <functional>
 #include <map>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -48,6 +48,9 @@ enum RequestType { Predict,
     KFS_GetServerReady,
     KFS_GetServerLive,
     KFS_GetServerMetadata,
+    KFS_SystemSharedMemoryStatus,
+    KFS_SystemSharedMemoryRegister,
+    KFS_SystemSharedMemoryUnregister,
     Metrics };
 
 struct HttpRequestComponents {
@@ -58,6 +61,7 @@ struct HttpRequestComponents {
     std::optional<std::string_view> model_version_label;
     std::string processing_method;
     std::string model_subresource;
+    std::string shared_memory_region_name;
     std::optional<int> inferenceHeaderContentLength;
 };
 
@@ -67,20 +71,6 @@ struct HttpResponseComponents {
 
 class HttpRestApiHandler {
 public:
-    static const std::string predictionRegexExp;
-    static const std::string modelstatusRegexExp;
-    static const std::string configReloadRegexExp;
-    static const std::string configStatusRegexExp;
-
-    static const std::string kfs_modelreadyRegexExp;
-    static const std::string kfs_modelmetadataRegexExp;
-    static const std::string kfs_inferRegexExp;
-
-    static const std::string metricsRegexExp;
-
-    static const std::string kfs_serverreadyRegexExp;
-    static const std::string kfs_serverliveRegexExp;
-    static const std::string kfs_servermetadataRegexExp;
     /**
      * @brief Construct a new HttpRest Api Handler
      *
@@ -93,9 +83,9 @@ public:
         const std::string& request_path,
         const std::vector<std::pair<std::string, std::string>>& headers = {});
 
-    Status parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version);
+    Status parseModelVersion(std::string_view model_version_str, std::optional<int64_t>& model_version);
     static void parseParams(rapidjson::Value&, rapidjson::Document&);
-    static Status prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength = {});
+    static Status prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, std::string_view request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength = {});
 
     void registerHandler(RequestType type, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&, HttpResponseComponents&)>);
     void registerAll();
@@ -197,28 +187,29 @@ public:
     Status processModelMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processModelReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength);
+
+    /**
+     * @brief Serves KServe inference of single model with request parsed straight into tensors and response
+     * serialized from them, without request and response protos.
+     *
+     * @return true when request was served and status holds its result, false when request must be served with request proto
+     */
+    bool processSingleModelInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength, ServableMetricReporter*& reporterOut, Status& status);
     Status processMetrics(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
     Status processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerLiveKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
-private:
-    const std::regex predictionRegex;
-    const std::regex modelstatusRegex;
-    const std::regex configReloadRegex;
-    const std::regex configStatusRegex;
-
-    const std::regex kfs_modelreadyRegex;
-    const std::regex kfs_modelmetadataRegex;
-
-    const std::regex kfs_inferRegex;
-    const std::regex kfs_serverreadyRegex;
-    const std::regex kfs_serverliveRegex;
-    const std::regex kfs_servermetadataRegex;
-
-    const std::regex metricsRegex;
+    /**
+     * @brief Process KServe system shared memory extension requests. Region name in request components is empty
+     * when status or unregister request applies to all registered regions.
+     */
+    Status processSystemSharedMemoryStatusKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+    Status processSystemSharedMemoryRegisterKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+    Status processSystemSharedMemoryUnregisterKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
+private:
     std::map<RequestType, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&, HttpResponseComponents&)>> handlers;
     int timeout_in_ms;
 
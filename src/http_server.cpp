@@ -15,6 +15,14 @@
 //*****************************************************************************
 #include "http_server.hpp"
 
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+#include <cstring>
 #include <memory>
 #include <regex>
 #include <string>
@@ -144,6 +152,14 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::INVALID_NO_OF_CHANNELS, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::BINARY_IMAGES_RESOLUTION_MISMATCH, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::STRING_VAL_EMPTY, net_http::HTTPStatusCode::BAD_REQUEST},
+
+        // KServe shared memory extension
+        {StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED, net_http::HTTPStatusCode::CONFLICT},
+        {StatusCode::SHARED_MEMORY_REGION_NOT_FOUND, net_http::HTTPStatusCode::NOT_FOUND},
+        {StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHARED_MEMORY_INVALID_RANGE, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHARED_MEMORY_DISABLED, net_http::HTTPStatusCode::NOT_FOUND},
     };
     auto it = httpStatusMap.find(status.getCode());
     if (it != httpStatusMap.end()) {
@@ -153,6 +169,29 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
     }
 }
 
+// Same as limit set with evhttp_set_max_body_size in net_http server
+static constexpr size_t MAX_REQUEST_BODY_SIZE = 1024 * 1024 * 1024;
+
+/**
+     * @brief Reads whole request body into single buffer. Its size is reserved upfront from Content-Length header,
+     * so that multi megabyte bodies are not copied on each buffer growth while chunks are appended.
+     * Handlers parse the body in place, without copying its parts.
+     */
+static void readRequestBody(net_http::ServerRequestInterface* req, std::string& body) {
+    const auto contentLength = req->GetRequestHeader("Content-Length");
+    size_t expectedSize = 0;
+    auto [end, error] = std::from_chars(contentLength.data(), contentLength.data() + contentLength.size(), expectedSize);
+    if (error == std::errc() && end == contentLength.data() + contentLength.size() && expectedSize <= MAX_REQUEST_BODY_SIZE) {
+        body.reserve(expectedSize);
+    }
+    int64_t num_bytes = 0;
+    auto request_chunk = req->ReadRequestBytes(&num_bytes);
+    while (request_chunk != nullptr) {
+        body.append(request_chunk.get(), num_bytes);
+        request_chunk = req->ReadRequestBytes(&num_bytes);
+    }
+}
+
 class RequestExecutor final : public net_http::EventExecutor {
 public:
     explicit RequestExecutor(int num_threads) :
@@ -191,12 +230,7 @@ private:
     void processRequest(net_http::ServerRequestInterface* req) {
         SPDLOG_DEBUG("REST request {}", req->uri_path());
         std::string body;
-        int64_t num_bytes = 0;
-        auto request_chunk = req->ReadRequestBytes(&num_bytes);
-        while (request_chunk != nullptr) {
-            body.append(std::string_view(request_chunk.get(), num_bytes));
-            request_chunk = req->ReadRequestBytes(&num_bytes);
-        }
+        readRequestBody(req, body);
 
         std::vector<std::pair<std::string, std::string>> headers;
         parseHeaders(req, &headers);
@@ -231,15 +265,57 @@ private:
     std::unique_ptr<HttpRestApiHandler> handler_;
 };
 
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms) {
+// Returns listening unix domain socket or -1 on failure. Ownership passes to net_http server once it starts accepting requests
+static int createUnixSocketListener(const std::string& path) {
+    struct sockaddr_un address;
+    if (path.size() >= sizeof(address.sun_path)) {
+        SPDLOG_ERROR("Unix domain socket path {} is too long", path);
+        return -1;
+    }
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+
+    // socket left by previous server instance would make bind fail
+    struct stat pathStat;
+    if (stat(path.c_str(), &pathStat) == 0 && S_ISSOCK(pathStat.st_mode)) {
+        unlink(path.c_str());
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        SPDLOG_ERROR("Failed to create unix domain socket: {}", std::strerror(errno));
+        return -1;
+    }
+    if (bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        SPDLOG_ERROR("Failed to listen on unix domain socket {}: {}", path, std::strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, const std::string& uds_path, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms) {
     auto options = std::make_unique<net_http::ServerOptions>();
-    options->AddPort(static_cast<uint32_t>(port));
-    options->SetAddress(address);
+    if (port != 0) {
+        options->AddPort(static_cast<uint32_t>(port));
+        options->SetAddress(address);
+    }
+    int udsFd = -1;
+    if (!uds_path.empty()) {
+        udsFd = createUnixSocketListener(uds_path);
+        if (udsFd < 0) {
+            return nullptr;
+        }
+        options->SetListeningSocket(udsFd);
+    }
     options->SetExecutor(std::make_unique<RequestExecutor>(num_threads));
 
     auto server = net_http::CreateEvHTTPServer(std::move(options));
     if (server == nullptr) {
         SPDLOG_ERROR("Failed to create http server");
+        if (udsFd >= 0) {
+            close(udsFd);
+        }
         return nullptr;
     }
 
@@ -254,7 +330,12 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
         handler_options);
 
     if (server->StartAcceptingRequests()) {
-        SPDLOG_INFO("REST server listening on port {} with {} threads", port, num_threads);
+        if (port != 0) {
+            SPDLOG_INFO("REST server listening on port {} with {} threads", port, num_threads);
+        }
+        if (!uds_path.empty()) {
+            SPDLOG_INFO("REST server listening on unix domain socket {} with {} threads", uds_path, num_threads);
+        }
         return server;
     }
 
@@ -31,11 +31,12 @@ using http_server = tensorflow::serving::net_http::HTTPServerInterface;
 /**
  * @brief Creates a and starts Http Server
  * 
- * @param port 
+ * @param port TCP port, 0 when server listens only on unix domain socket
+ * @param uds_path unix domain socket path, empty when server listens only on TCP port
  * @param num_threads 
  * @param timeout_in_m not implemented
  *  
  * @return std::unique_ptr<http_server> 
  */
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms = -1);
+std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, const std::string& uds_path, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms = -1);
 }  // namespace ovms
@@ -15,6 +15,8 @@
 //*****************************************************************************
 #include "httpservermodule.hpp"
 
+#include <unistd.h>
+
 #include <sstream>
 #include <string>
 #include <utility>
@@ -31,11 +33,17 @@ HTTPServerModule::HTTPServerModule(ovms::Server& ovmsServer) :
 Status HTTPServerModule::start(const ovms::Config& config) {
     state = ModuleState::STARTED_INITIALIZE;
     SPDLOG_INFO("{} starting", HTTP_SERVER_MODULE_NAME);
-    const std::string server_address = config.restBindAddress() + ":" + std::to_string(config.restPort());
+    std::string server_address;
+    if (config.restPort() != 0) {
+        server_address = config.restBindAddress() + ":" + std::to_string(config.restPort());
+    }
+    if (!config.restUdsPath().empty()) {
+        server_address += (server_address.empty() ? "unix:" : " and unix:") + config.restUdsPath();
+    }
     int workers = config.restWorkers() ? config.restWorkers() : 10;
 
     SPDLOG_INFO("Will start {} REST workers", workers);
-    server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, this->ovmsServer);
+    server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), config.restUdsPath(), workers, this->ovmsServer);
     if (server == nullptr) {
         std::stringstream ss;
         ss << "at " << server_address;
@@ -43,6 +51,7 @@ Status HTTPServerModule::start(const ovms::Config& config) {
         SPDLOG_ERROR(status.string());
         return status;
     }
+    udsPath = config.restUdsPath();
     state = ModuleState::INITIALIZED;
     SPDLOG_INFO("{} started", HTTP_SERVER_MODULE_NAME);
     SPDLOG_INFO("Started REST server at {}", server_address);
@@ -56,6 +65,9 @@ void HTTPServerModule::shutdown() {
     server->Terminate();
     server->WaitForTermination();
     server.reset();
+    if (!udsPath.empty()) {
+        unlink(udsPath.c_str());
+    }
     SPDLOG_INFO("Shutdown HTTP server");
     state = ModuleState::SHUTDOWN;
 }
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "http_server.hpp"
@@ -27,6 +28,7 @@ class Server;
 class HTTPServerModule : public Module {
     std::unique_ptr<ovms::http_server> server;
     Server& ovmsServer;
+    std::string udsPath;
 
 public:
     HTTPServerModule(Server& ovmsServer);
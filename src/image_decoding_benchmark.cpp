@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <opencv2/opencv.hpp>
+#include <sysexits.h>
+
+#include "worker_pool.hpp"
+
+// Measures time of decoding, converting and resizing images of a batched binary input request,
+// with images processed one by one and in parallel by worker pool, the way tensor conversion does it.
+namespace {
+
+bool convertImage(const std::string& encoded, int decodingFlags, cv::Mat& slot) {
+    cv::Mat image = cv::imdecode(cv::Mat(1, encoded.size(), CV_8U, const_cast<char*>(encoded.data())), decodingFlags);
+    if (image.data == nullptr || image.channels() != slot.channels()) {
+        return false;
+    }
+    cv::Mat converted;
+    image.convertTo(converted, CV_32F);
+    cv::resize(converted, slot, slot.size());
+    return slot.data != nullptr;
+}
+
+double measureMilliseconds(uint32_t iterations, ovms::WorkerPool& pool, size_t maxParallelism, const std::string& encoded, int decodingFlags, std::vector<cv::Mat>& slots, bool& failed) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        std::vector<char> results(slots.size());
+        pool.parallelFor(slots.size(), maxParallelism, [&](size_t index) {
+            results[index] = convertImage(encoded, decodingFlags, slots[index]);
+        });
+        failed |= std::find(results.begin(), results.end(), false) != results.end();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1000.0 / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "Batched binary input images decoding benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("image",
+            "path to encoded image used for each batch element",
+            cxxopts::value<std::string>()->default_value("src/test/binaryutils/rgb4x4.jpg"),
+            "IMAGE")
+        ("batch_size",
+            "number of images in request",
+            cxxopts::value<uint32_t>()->default_value("32"),
+            "BATCH_SIZE")
+        ("height",
+            "target height of images",
+            cxxopts::value<uint32_t>()->default_value("224"),
+            "HEIGHT")
+        ("width",
+            "target width of images",
+            cxxopts::value<uint32_t>()->default_value("224"),
+            "WIDTH")
+        ("threads",
+            "number of threads decoding images of request, including request thread",
+            cxxopts::value<uint32_t>()->default_value(std::to_string(std::max(1u, std::min(std::thread::hardware_concurrency(), 8u)))),
+            "THREADS")
+        ("jpeg_scale_denominator",
+            "additionally measure parallel conversion of JPEG color image decoded at 1/2, 1/4 or 1/8 scale, 1 skips it",
+            cxxopts::value<uint32_t>()->default_value("1"),
+            "JPEG_SCALE_DENOMINATOR")
+        ("niter",
+            "number of requests processed in each measurement",
+            cxxopts::value<uint32_t>()->default_value("100"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const std::string imagePath = result->operator[]("image").as<std::string>();
+    const uint32_t batchSize = result->operator[]("batch_size").as<uint32_t>();
+    const uint32_t height = result->operator[]("height").as<uint32_t>();
+    const uint32_t width = result->operator[]("width").as<uint32_t>();
+    const uint32_t threads = result->operator[]("threads").as<uint32_t>();
+    const uint32_t jpegScaleDenominator = result->operator[]("jpeg_scale_denominator").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0 || batchSize == 0 || threads == 0 || height == 0 || width == 0) {
+        std::cerr << "niter, batch_size, threads, height and width have to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+    int reducedDecodingFlags = cv::IMREAD_UNCHANGED;
+    switch (jpegScaleDenominator) {
+    case 1:
+        break;
+    case 2:
+        reducedDecodingFlags = cv::IMREAD_REDUCED_COLOR_2 | cv::IMREAD_IGNORE_ORIENTATION;
+        break;
+    case 4:
+        reducedDecodingFlags = cv::IMREAD_REDUCED_COLOR_4 | cv::IMREAD_IGNORE_ORIENTATION;
+        break;
+    case 8:
+        reducedDecodingFlags = cv::IMREAD_REDUCED_COLOR_8 | cv::IMREAD_IGNORE_ORIENTATION;
+        break;
+    default:
+        std::cerr << "jpeg_scale_denominator has to be 1, 2, 4 or 8" << std::endl;
+        return EX_USAGE;
+    }
+    std::ifstream file(imagePath, std::ios::binary);
+    if (!file) {
+        std::cerr << "could not open image " << imagePath << std::endl;
+        return EX_NOINPUT;
+    }
+    const std::string encoded((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    cv::Mat firstImage = cv::imdecode(cv::Mat(1, encoded.size(), CV_8U, const_cast<char*>(encoded.data())), cv::IMREAD_UNCHANGED);
+    if (firstImage.data == nullptr) {
+        std::cerr << "could not decode image " << imagePath << std::endl;
+        return EX_DATAERR;
+    }
+    // slots of the batch tensor, images are written directly into them
+    const int type = CV_MAKETYPE(CV_32F, firstImage.channels());
+    cv::Mat batch(batchSize * height, width, type);
+    std::vector<cv::Mat> slots;
+    for (uint32_t i = 0; i < batchSize; ++i) {
+        slots.push_back(batch.rowRange(i * height, (i + 1) * height));
+    }
+
+    ovms::WorkerPool pool(threads - 1);
+    bool failed = false;
+    std::cout << "image: " << imagePath << " (" << firstImage.cols << "x" << firstImage.rows << "), batch size: " << batchSize
+              << ", target: " << width << "x" << height << ", iterations: " << niter << std::endl;
+    double sequential = measureMilliseconds(niter, pool, 1, encoded, cv::IMREAD_UNCHANGED, slots, failed);
+    std::cout << "sequential: " << sequential << " ms per request" << std::endl;
+    double parallel = measureMilliseconds(niter, pool, threads, encoded, cv::IMREAD_UNCHANGED, slots, failed);
+    std::cout << threads << " threads: " << parallel << " ms per request, speedup " << sequential / parallel << std::endl;
+    if (jpegScaleDenominator > 1) {
+        if (firstImage.channels() != 3) {
+            std::cerr << "JPEG scaled decoding is measured for color images only" << std::endl;
+            return EX_DATAERR;
+        }
+        double reduced = measureMilliseconds(niter, pool, threads, encoded, reducedDecodingFlags, slots, failed);
+        std::cout << threads << " threads, JPEG decoded at 1/" << jpegScaleDenominator << " scale: " << reduced << " ms per request, speedup " << sequential / reduced << std::endl;
+    }
+    if (failed) {
+        std::cerr << "image conversion failed" << std::endl;
+        return EX_SOFTWARE;
+    }
+    return EX_OK;
+}
@@ -15,10 +15,15 @@
 //*****************************************************************************
 #include "kfs_grpc_inference_service.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -29,6 +34,7 @@
 #include "../deserialization.hpp"
 #include "../execution_context.hpp"
 #include "../grpc_utils.hpp"
+#include "../kfs_frontend/kfs_shared_memory.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
 #if (MEDIAPIPE_DISABLE == 0)
 #include "../mediapipe_internal/mediapipegraphdefinition.hpp"
@@ -48,6 +54,7 @@
 #include "../tensorinfo.hpp"
 #include "../timer.hpp"
 #include "../version.hpp"
+#include "../worker_pool.hpp"
 
 namespace {
 enum : unsigned int {
@@ -60,7 +67,8 @@ namespace ovms {
 
 Status KFSInferenceServiceImpl::getModelInstance(const KFSRequest* request,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+    bool waitIfLoading) {
     OVMS_PROFILE_FUNCTION();
     model_version_t requestedVersion = 0;
     if (!request->model_version().empty()) {
@@ -72,6 +80,9 @@ Status KFSInferenceServiceImpl::getModelInstance(const KFSRequest* request,
             return StatusCode::MODEL_VERSION_INVALID_FORMAT;
         }
     }
+    if (!waitIfLoading) {
+        return this->modelManager.getModelInstance(request->model_name(), requestedVersion, modelInstance, modelInstanceUnloadGuardPtr, 0);
+    }
     return this->modelManager.getModelInstance(request->model_name(), requestedVersion, modelInstance, modelInstanceUnloadGuardPtr);
 }
 
@@ -274,6 +285,213 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
     return grpc(status);
 }
 
+// starts inference on resolved model instance, onComplete is called exactly once
+static void startModelInferAsync(const std::shared_ptr<ModelInstance>& modelInstance, std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuard, const KFSRequest* request, KFSResponse* response, Timer<TIMER_END> timer, const std::function<void(::grpc::Status)>& onComplete) {
+    auto status = prepareSharedMemoryOutputs(*request, *response);
+    if (!status.ok()) {
+        onComplete(grpc(status));
+        return;
+    }
+    ExecutionContext executionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer};
+    status = modelInstance->inferAsync(request, response, modelInstanceUnloadGuard,
+        [modelInstance, executionContext, timer, request, response, onComplete](Status status) mutable {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
+            if (!status.ok()) {
+                onComplete(grpc(status));
+                return;
+            }
+            response->set_id(request->id());
+            timer.stop(TOTAL);
+            double requestTotal = timer.elapsed<std::chrono::microseconds>(TOTAL);
+            SPDLOG_DEBUG("Total gRPC request processing time: {} ms", requestTotal / 1000);
+            OBSERVE_IF_ENABLED(modelInstance->getMetricReporter().requestTimeGrpc, requestTotal);
+            onComplete(grpc(status));
+        });
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+        onComplete(grpc(status));
+    }
+}
+
+void KFSInferenceServiceImpl::ModelInferAsync(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, std::function<void(::grpc::Status)> onComplete, WorkerPool& blockingCallsPool) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    timer.start(TOTAL);
+    SPDLOG_DEBUG("Processing async gRPC request for model: {}; version: {}",
+        request->model_name(),
+        request->model_version());
+    const std::string servableName = request->model_name();
+    try {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+        // completion queue thread does not wait for model version which is still loading
+        auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard, false);
+        if (status == StatusCode::MODEL_NAME_MISSING ||
+            status == StatusCode::MODEL_VERSION_NOT_LOADED_YET ||
+            (status.ok() && modelInstance->mayBlockAsyncInference())) {
+            // pipelines, mediapipe graphs, waiting for model version to load, stateful models and reloads would block completion queue thread
+            modelInstanceUnloadGuard.reset();
+            blockingCallsPool.submit([this, context, request, response, onComplete]() {
+                onComplete(ModelInfer(context, request, response));
+            });
+            return;
+        }
+        if (!status.ok()) {
+            if (modelInstance) {
+                INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailGrpcModelInfer);
+            }
+            SPDLOG_DEBUG("Getting modelInstance failed. {}", status.string());
+            onComplete(grpc(status));
+            return;
+        }
+        startModelInferAsync(modelInstance, modelInstanceUnloadGuard, request, response, timer, onComplete);
+    } catch (const std::exception& e) {
+        SPDLOG_ERROR("Caught exception in InferenceServiceImpl for servable: {} exception: {}", servableName, e.what());
+        onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR, e.what())));
+    } catch (...) {
+        SPDLOG_ERROR("Caught unknown exception in InferenceServiceImpl for servable: {}", servableName);
+        onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR)));
+    }
+}
+
+namespace {
+// bounds memory used by responses waiting for earlier requests of the same stream
+const size_t MAX_STREAM_REQUESTS_IN_FLIGHT = 16;
+
+struct StreamInferEntry {
+    KFSRequest request;
+    KFSStreamResponse response;
+    bool completed = false;
+};
+}  // namespace
+
+::grpc::Status KFSInferenceServiceImpl::ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<KFSStreamResponse, KFSRequest>* stream) {
+    OVMS_PROFILE_FUNCTION();
+    SPDLOG_DEBUG("Processing gRPC inference stream");
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<StreamInferEntry>> entries;  // in order of requests, guarded by mtx
+    bool readingFinished = false;
+    bool writeFailed = false;
+
+    // responses are written in order of requests, while later requests may already be in inference
+    std::thread writer([&]() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            cv.wait(lock, [&]() { return (!entries.empty() && entries.front()->completed) || (readingFinished && entries.empty()); });
+            if (entries.empty()) {
+                return;
+            }
+            auto entry = std::move(entries.front());
+            entries.pop_front();
+            cv.notify_all();
+            if (writeFailed) {
+                continue;
+            }
+            lock.unlock();
+            bool written = stream->Write(entry->response);
+            lock.lock();
+            if (!written) {
+                SPDLOG_DEBUG("Writing to gRPC inference stream failed, remaining responses are dropped");
+                writeFailed = true;
+            }
+        }
+    });
+
+    // model instance resolved by previous request of the stream, unload guard is taken by each request
+    std::string streamModelName;
+    std::string streamModelVersion;
+    std::shared_ptr<ModelInstance> streamModelInstance;
+    auto getStreamModelInstance = [&](const KFSRequest* request, std::shared_ptr<ModelInstance>& modelInstance, std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuard) -> Status {
+        if (streamModelInstance && request->model_name() == streamModelName && request->model_version() == streamModelVersion) {
+            modelInstanceUnloadGuard = std::make_unique<ModelInstanceUnloadGuard>(*streamModelInstance);
+            if (streamModelInstance->getStatus().getState() == ModelVersionState::AVAILABLE) {
+                modelInstance = streamModelInstance;
+                return StatusCode::OK;
+            }
+            // model is reloaded or unloaded, let it proceed
+            modelInstanceUnloadGuard.reset();
+        }
+        streamModelInstance.reset();
+        auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
+        if (!status.ok()) {
+            return status;
+        }
+        streamModelName = request->model_name();
+        streamModelVersion = request->model_version();
+        streamModelInstance = modelInstance;
+        return status;
+    };
+
+    while (true) {
+        auto entry = std::make_shared<StreamInferEntry>();
+        if (!stream->Read(&entry->request)) {
+            break;
+        }
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]() { return entries.size() < MAX_STREAM_REQUESTS_IN_FLIGHT || writeFailed; });
+            if (writeFailed) {
+                break;
+            }
+            entries.push_back(entry);
+        }
+        // notification is sent under lock since stream state is destroyed once writer finishes
+        auto onComplete = [&mtx, &cv, entry](::grpc::Status status) {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!status.ok()) {
+                entry->response.set_error_message(status.error_message());
+                entry->response.mutable_infer_response()->Clear();
+                entry->response.mutable_infer_response()->set_model_name(entry->request.model_name());
+                entry->response.mutable_infer_response()->set_model_version(entry->request.model_version());
+                entry->response.mutable_infer_response()->set_id(entry->request.id());
+            }
+            entry->completed = true;
+            cv.notify_all();
+        };
+        const KFSRequest* request = &entry->request;
+        KFSResponse* response = entry->response.mutable_infer_response();
+        Timer<TIMER_END> timer;
+        timer.start(TOTAL);
+        SPDLOG_DEBUG("Processing gRPC stream request for model: {}; version: {}",
+            request->model_name(),
+            request->model_version());
+        try {
+            std::shared_ptr<ModelInstance> modelInstance;
+            std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+            auto status = getStreamModelInstance(request, modelInstance, modelInstanceUnloadGuard);
+            if (status == StatusCode::MODEL_NAME_MISSING) {
+                // pipelines and mediapipe graphs are executed in reading thread
+                onComplete(ModelInfer(context, request, response));
+                continue;
+            }
+            if (!status.ok()) {
+                if (modelInstance) {
+                    INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailGrpcModelInfer);
+                }
+                SPDLOG_DEBUG("Getting modelInstance failed. {}", status.string());
+                onComplete(grpc(status));
+                continue;
+            }
+            startModelInferAsync(modelInstance, modelInstanceUnloadGuard, request, response, timer, onComplete);
+        } catch (const std::exception& e) {
+            SPDLOG_ERROR("Caught exception in InferenceServiceImpl for servable: {} exception: {}", request->model_name(), e.what());
+            onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR, e.what())));
+        } catch (...) {
+            SPDLOG_ERROR("Caught unknown exception in InferenceServiceImpl for servable: {}", request->model_name());
+            onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR)));
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        readingFinished = true;
+        cv.notify_all();
+    }
+    writer.join();
+    SPDLOG_DEBUG("Finished processing gRPC inference stream");
+    return grpc(Status(StatusCode::OK));
+}
+
 Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
     OVMS_PROFILE_FUNCTION();
     std::shared_ptr<ovms::ModelInstance> modelInstance;
@@ -306,6 +524,10 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
         SPDLOG_DEBUG("Getting modelInstance or pipeline failed. {}", status.string());
         return status;
     }
+    status = prepareSharedMemoryOutputs(*request, *response);
+    if (!status.ok()) {
+        return status;
+    }
     if (pipelinePtr) {
         reporterOut = &pipelinePtr->getMetricReporter();
         status = pipelinePtr->execute(executionContext);
@@ -15,11 +15,13 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/sync_stream.h>
 
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
 #include "src/kfserving_api/grpc_predict_v2.pb.h"
@@ -31,6 +33,7 @@ using KFSModelMetadataRequest = inference::ModelMetadataRequest;
 using KFSModelMetadataResponse = inference::ModelMetadataResponse;
 using KFSRequest = inference::ModelInferRequest;
 using KFSResponse = inference::ModelInferResponse;
+using KFSStreamResponse = inference::ModelStreamInferResponse;
 using KFSTensorInputProto = inference::ModelInferRequest::InferInputTensor;
 using KFSTensorOutputProto = inference::ModelInferResponse::InferOutputTensor;
 using KFSShapeType = google::protobuf::RepeatedField<int64_t>;
@@ -53,6 +56,7 @@ class Server;
 class Status;
 class TensorInfo;
 class PipelineDefinition;
+class WorkerPool;
 
 class KFSInferenceServiceImpl final : public GRPCInferenceService::Service {
     const Server& ovmsServer;
@@ -70,6 +74,21 @@ public:
     ::grpc::Status ServerMetadata(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response) override;
     ::grpc::Status ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) override;
     ::grpc::Status ModelInfer(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response) override;
+    /**
+     * @brief Starts ModelInfer call processing without waiting for inference to complete
+     *
+     * onComplete is invoked exactly once, possibly from inference completion callback thread.
+     * Pipelines and mediapipe graphs block until executed, so they are run on blockingCallsPool instead of calling thread.
+     */
+    void ModelInferAsync(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, std::function<void(::grpc::Status)> onComplete, WorkerPool& blockingCallsPool);
+    /**
+     * @brief Serves stream of inference requests, responses are written in order of requests
+     *
+     * Model instance is resolved once and reused while the stream requests the same servable.
+     * Each request holds its own unload guard only until its response is queued, so idle stream
+     * does not block model unload or reload.
+     */
+    ::grpc::Status ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<KFSStreamResponse, KFSRequest>* stream) override;
     static Status buildResponse(Model& model, ModelInstance& instance, KFSModelMetadataResponse* response);
     static Status buildResponse(PipelineDefinition& pipelineDefinition, KFSModelMetadataResponse* response);
     static Status buildResponse(std::shared_ptr<ModelInstance> instance, KFSGetModelStatusResponse* response);
@@ -82,7 +101,8 @@ public:
 protected:
     Status getModelInstance(const KFSRequest* request,
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
-        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr);
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+        bool waitIfLoading = true);
     Status getPipeline(const KFSRequest* request,
         KFSResponse* response,
         std::unique_ptr<ovms::Pipeline>& pipelinePtr);
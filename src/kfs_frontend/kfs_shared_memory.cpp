@@ -0,0 +1,313 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "kfs_shared_memory.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#include "../status.hpp"
+#include "../tensorinfo.hpp"
+#include "kfs_utils.hpp"
+
+namespace ovms {
+
+const std::string SHARED_MEMORY_REGION_PARAMETER = "shared_memory_region";
+const std::string SHARED_MEMORY_BYTE_SIZE_PARAMETER = "shared_memory_byte_size";
+const std::string SHARED_MEMORY_OFFSET_PARAMETER = "shared_memory_offset";
+
+SharedMemoryRegion::SharedMemoryRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize) :
+    name(name),
+    key(key),
+    offset(offset),
+    byteSize(byteSize) {}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (mapping != nullptr && munmap(mapping, mappingSize) != 0) {
+        SPDLOG_ERROR("Failed to unmap shared memory region: {}; key: {}; error: {}", name, key, std::strerror(errno));
+    }
+    if (fd != -1) {
+        close(fd);
+    }
+}
+
+Status SharedMemoryRegion::map() {
+    fd = shm_open(key.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+        std::stringstream ss;
+        ss << "Could not open shared memory object: " << key << "; error: " << std::strerror(errno);
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, ss.str());
+    }
+    auto status = validateObjectSize();
+    if (!status.ok()) {
+        return status;
+    }
+    // mapping has to start at page boundary, so region offset is applied to mapped address
+    void* address = mmap(nullptr, offset + byteSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        std::stringstream ss;
+        ss << "Could not map shared memory object: " << key << "; error: " << std::strerror(errno);
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, ss.str());
+    }
+    mapping = address;
+    mappingSize = offset + byteSize;
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegion::validateObjectSize() const {
+    struct stat objectStat;
+    if (fstat(fd, &objectStat) != 0) {
+        std::stringstream ss;
+        ss << "Could not get size of shared memory object: " << key << "; error: " << std::strerror(errno);
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, ss.str());
+    }
+    const size_t objectSize = static_cast<size_t>(objectStat.st_size);
+    if (offset > objectSize || byteSize > objectSize - offset) {
+        std::stringstream ss;
+        ss << "Region offset: " << offset << " and byte size: " << byteSize << " exceed shared memory object: " << key << " size: " << objectSize;
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::SHARED_MEMORY_INVALID_RANGE, ss.str());
+    }
+    return StatusCode::OK;
+}
+
+SharedMemoryRegistry& SharedMemoryRegistry::instance() {
+    static SharedMemoryRegistry instance;
+    return instance;
+}
+
+Status SharedMemoryRegistry::registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize) {
+    if (name.empty() || key.empty() || byteSize == 0) {
+        SPDLOG_DEBUG("Shared memory region requires name, key and byte size greater than 0");
+        return StatusCode::SHARED_MEMORY_INVALID_PARAMETERS;
+    }
+    {
+        std::shared_lock lock(mutex);
+        if (regions.count(name) > 0) {
+            SPDLOG_DEBUG("Shared memory region: {} is already registered", name);
+            return StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED;
+        }
+    }
+    // object is mapped without holding the lock, so that requests are not blocked by registration
+    auto region = std::make_shared<SharedMemoryRegion>(name, key, offset, byteSize);
+    auto status = region->map();
+    if (!status.ok()) {
+        return status;
+    }
+    std::unique_lock lock(mutex);
+    if (!regions.emplace(name, std::move(region)).second) {
+        SPDLOG_DEBUG("Shared memory region: {} is already registered", name);
+        return StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED;
+    }
+    SPDLOG_DEBUG("Registered shared memory region: {}; key: {}; offset: {}; byte size: {}", name, key, offset, byteSize);
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegistry::unregisterRegion(const std::string& name) {
+    std::unique_lock lock(mutex);
+    if (regions.erase(name) == 0) {
+        SPDLOG_DEBUG("Shared memory region: {} is not registered", name);
+        return StatusCode::SHARED_MEMORY_REGION_NOT_FOUND;
+    }
+    SPDLOG_DEBUG("Unregistered shared memory region: {}", name);
+    return StatusCode::OK;
+}
+
+void SharedMemoryRegistry::unregisterAllRegions() {
+    std::unique_lock lock(mutex);
+    regions.clear();
+    SPDLOG_DEBUG("Unregistered all shared memory regions");
+}
+
+Status SharedMemoryRegistry::getRegions(const std::string& name, std::vector<std::shared_ptr<const SharedMemoryRegion>>& regionsOut) const {
+    std::shared_lock lock(mutex);
+    if (name.empty()) {
+        for (const auto& [regionName, region] : regions) {
+            regionsOut.push_back(region);
+        }
+        return StatusCode::OK;
+    }
+    auto it = regions.find(name);
+    if (it == regions.end()) {
+        SPDLOG_DEBUG("Shared memory region: {} is not registered", name);
+        return StatusCode::SHARED_MEMORY_REGION_NOT_FOUND;
+    }
+    regionsOut.push_back(it->second);
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegistry::getMemory(const SharedMemoryReference& reference, std::shared_ptr<const SharedMemoryRegion>& regionOut, char*& dataOut) const {
+    std::shared_ptr<const SharedMemoryRegion> region;
+    {
+        std::shared_lock lock(mutex);
+        auto it = regions.find(reference.regionName);
+        if (it == regions.end()) {
+            std::stringstream ss;
+            ss << "Shared memory region: " << reference.regionName << " is not registered";
+            SPDLOG_DEBUG(ss.str());
+            return Status(StatusCode::SHARED_MEMORY_REGION_NOT_FOUND, ss.str());
+        }
+        region = it->second;
+    }
+    if (reference.offset > region->getByteSize() || reference.byteSize > region->getByteSize() - reference.offset) {
+        std::stringstream ss;
+        ss << "Offset: " << reference.offset << " and byte size: " << reference.byteSize
+           << " exceed shared memory region: " << reference.regionName << " byte size: " << region->getByteSize();
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::SHARED_MEMORY_INVALID_RANGE, ss.str());
+    }
+    auto status = region->validateObjectSize();
+    if (!status.ok()) {
+        return status;
+    }
+    dataOut = region->data() + reference.offset;
+    regionOut = std::move(region);
+    return StatusCode::OK;
+}
+
+bool usesSharedMemory(const google::protobuf::Map<std::string, ::inference::InferParameter>& parameters) {
+    return parameters.count(SHARED_MEMORY_REGION_PARAMETER) > 0;
+}
+
+static Status getSizeParameter(const google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, const std::string& name, bool required, size_t& value) {
+    auto it = parameters.find(name);
+    if (it == parameters.end()) {
+        if (required) {
+            SPDLOG_DEBUG("Missing shared memory parameter: {}", name);
+            return Status(StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, "Missing parameter: " + name);
+        }
+        return StatusCode::OK;
+    }
+    if (it->second.parameter_choice_case() != ::inference::InferParameter::ParameterChoiceCase::kInt64Param || it->second.int64_param() < 0) {
+        SPDLOG_DEBUG("Shared memory parameter: {} has to be non negative int64", name);
+        return Status(StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, "Parameter: " + name + " has to be non negative int64");
+    }
+    value = static_cast<size_t>(it->second.int64_param());
+    return StatusCode::OK;
+}
+
+Status getSharedMemoryReference(const google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, SharedMemoryReference& reference) {
+    auto it = parameters.find(SHARED_MEMORY_REGION_PARAMETER);
+    if (it == parameters.end() || it->second.parameter_choice_case() != ::inference::InferParameter::ParameterChoiceCase::kStringParam) {
+        SPDLOG_DEBUG("Shared memory parameter: {} has to be string", SHARED_MEMORY_REGION_PARAMETER);
+        return Status(StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, "Parameter: " + SHARED_MEMORY_REGION_PARAMETER + " has to be string");
+    }
+    reference.regionName = it->second.string_param();
+    auto status = getSizeParameter(parameters, SHARED_MEMORY_BYTE_SIZE_PARAMETER, true, reference.byteSize);
+    if (!status.ok()) {
+        return status;
+    }
+    return getSizeParameter(parameters, SHARED_MEMORY_OFFSET_PARAMETER, false, reference.offset);
+}
+
+namespace {
+/**
+     * @brief Provides tensor with memory of shared memory region. Region is kept mapped as long as tensor uses it.
+     */
+class SharedMemoryAllocator {
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data;
+
+public:
+    SharedMemoryAllocator(std::shared_ptr<const SharedMemoryRegion> region, char* data) :
+        region(std::move(region)),
+        data(data) {}
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) {
+        return data;
+    }
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t)) {}
+    bool is_equal(const SharedMemoryAllocator& other) const {
+        return data == other.data;
+    }
+};
+}  // namespace
+
+Status makeTensorFromSharedMemory(const ::KFSRequest::InferInputTensor& requestInput, const TensorInfo& tensorInfo, ov::Tensor& tensor) {
+    SharedMemoryReference reference;
+    auto status = getSharedMemoryReference(requestInput.parameters(), reference);
+    if (!status.ok()) {
+        return status;
+    }
+    // memory is used by inference as it is, so data cannot be converted to other precision
+    if (KFSPrecisionToOvmsPrecision(requestInput.datatype()) != tensorInfo.getPrecision()) {
+        std::stringstream ss;
+        ss << "Shared memory input: " << requestInput.name() << " datatype: " << requestInput.datatype()
+           << " has to match input precision: " << tensorInfo.getPrecisionAsString();
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::INVALID_PRECISION, ss.str());
+    }
+    ov::Shape shape;
+    for (int i = 0; i < requestInput.shape_size(); i++) {
+        shape.push_back(requestInput.shape(i));
+    }
+    const ov::element::Type precision = tensorInfo.getOvPrecision();
+    if (ov::shape_size(shape) * precision.size() != reference.byteSize) {
+        std::stringstream ss;
+        ss << "Expected: " << ov::shape_size(shape) * precision.size() << " bytes; Actual: " << reference.byteSize << " bytes; input name: " << requestInput.name();
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::INVALID_CONTENT_SIZE, ss.str());
+    }
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data = nullptr;
+    status = SharedMemoryRegistry::instance().getMemory(reference, region, data);
+    if (!status.ok()) {
+        return status;
+    }
+    tensor = ov::Tensor(precision, shape, SharedMemoryAllocator(std::move(region), data));
+    return StatusCode::OK;
+}
+
+Status prepareSharedMemoryOutputs(const ::KFSRequest& request, ::KFSResponse& response) {
+    for (const auto& requestedOutput : request.outputs()) {
+        if (!usesSharedMemory(requestedOutput.parameters())) {
+            continue;
+        }
+        SharedMemoryReference reference;
+        auto status = getSharedMemoryReference(requestedOutput.parameters(), reference);
+        if (!status.ok()) {
+            return status;
+        }
+        // region is checked before inference, size of output is checked when it is known
+        std::shared_ptr<const SharedMemoryRegion> region;
+        char* data = nullptr;
+        status = SharedMemoryRegistry::instance().getMemory(reference, region, data);
+        if (!status.ok()) {
+            return status;
+        }
+        auto* output = response.add_outputs();
+        output->set_name(requestedOutput.name());
+        for (const auto* name : {&SHARED_MEMORY_REGION_PARAMETER, &SHARED_MEMORY_BYTE_SIZE_PARAMETER, &SHARED_MEMORY_OFFSET_PARAMETER}) {
+            auto it = requestedOutput.parameters().find(*name);
+            if (it != requestedOutput.parameters().end()) {
+                (*output->mutable_parameters())[*name] = it->second;
+            }
+        }
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "kfs_grpc_inference_service.hpp"
+
+namespace ovms {
+class Status;
+class TensorInfo;
+
+extern const std::string SHARED_MEMORY_REGION_PARAMETER;
+extern const std::string SHARED_MEMORY_BYTE_SIZE_PARAMETER;
+extern const std::string SHARED_MEMORY_OFFSET_PARAMETER;
+
+/**
+     * @brief POSIX shared memory object registered by client, mapped into server address space for its whole lifetime.
+     *
+     * Object stays open, so that its size can be checked again before each use. Client truncating the object
+     * below region size after registration would otherwise crash the server with SIGBUS on access.
+     */
+class SharedMemoryRegion {
+    const std::string name;
+    const std::string key;
+    const size_t offset;
+    const size_t byteSize;
+    int fd = -1;
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+
+public:
+    SharedMemoryRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize);
+    ~SharedMemoryRegion();
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    Status map();
+
+    /**
+     * @brief Checks that shared memory object was not truncated below region size since it was mapped
+     */
+    Status validateObjectSize() const;
+
+    const std::string& getName() const { return name; }
+    const std::string& getKey() const { return key; }
+    size_t getOffset() const { return offset; }
+    size_t getByteSize() const { return byteSize; }
+    char* data() const { return static_cast<char*>(mapping) + offset; }
+};
+
+/**
+     * @brief Tensor memory in shared memory region, referenced by request input or requested output parameters.
+     */
+struct SharedMemoryReference {
+    std::string regionName;
+    size_t byteSize = 0;
+    size_t offset = 0;
+};
+
+/**
+     * @brief Keeps system shared memory regions registered through KServe shared memory extension.
+     *
+     * Regions are shared with requests using them, so unregistering region does not unmap memory
+     * used by inference in progress.
+     */
+class SharedMemoryRegistry {
+    mutable std::shared_mutex mutex;
+    std::map<std::string, std::shared_ptr<const SharedMemoryRegion>> regions;
+
+public:
+    static SharedMemoryRegistry& instance();
+
+    Status registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize);
+    Status unregisterRegion(const std::string& name);
+    void unregisterAllRegions();
+
+    /**
+     * @brief Lists registered regions, all of them when name is empty
+     */
+    Status getRegions(const std::string& name, std::vector<std::shared_ptr<const SharedMemoryRegion>>& regionsOut) const;
+
+    /**
+     * @brief Gets memory referenced by request, validating that it fits in registered region and in shared memory object
+     */
+    Status getMemory(const SharedMemoryReference& reference, std::shared_ptr<const SharedMemoryRegion>& regionOut, char*& dataOut) const;
+};
+
+bool usesSharedMemory(const google::protobuf::Map<std::string, ::inference::InferParameter>& parameters);
+Status getSharedMemoryReference(const google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, SharedMemoryReference& reference);
+
+/**
+     * @brief Wraps memory of shared memory input as tensor without copying. Tensor keeps region mapped until it is released.
+     */
+Status makeTensorFromSharedMemory(const ::KFSRequest::InferInputTensor& requestInput, const TensorInfo& tensorInfo, ov::Tensor& tensor);
+
+/**
+     * @brief Adds outputs requested in shared memory to response, before inference, so that serialization writes them
+     * into client regions instead of response contents.
+     */
+Status prepareSharedMemoryOutputs(const ::KFSRequest& request, ::KFSResponse& response);
+}  // namespace ovms
@@ -26,6 +26,7 @@
 #include "../profiler.hpp"
 #include "../status.hpp"
 #include "../tensorinfo.hpp"
+#include "kfs_shared_memory.hpp"
 
 namespace ovms {
 Precision KFSPrecisionToOvmsPrecision(const KFSDataType& datatype) {
@@ -121,15 +122,25 @@ std::string tensorShapeToString(const KFSShapeType& shape) {
 
 Status prepareConsolidatedTensorImpl(KFSResponse* response, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape, char*& bufferOut, size_t size) {
     OVMS_PROFILE_FUNCTION();
+    int outputIndex = response->outputs_size();
     for (int i = 0; i < response->outputs_size(); i++) {
         if (response->mutable_outputs(i)->name() == name) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to prepare consolidated tensor, tensor with name {} already prepared", name);
-            return StatusCode::INTERNAL_ERROR;
+            // output requested in shared memory is gathered into response contents and copied to region during serialization
+            if (!usesSharedMemory(response->outputs(i).parameters())) {
+                SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to prepare consolidated tensor, tensor with name {} already prepared", name);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            outputIndex = i;
+            break;
         }
     }
-    auto* proto = response->add_outputs();
-    proto->set_name(name);
-    auto* content = response->add_raw_output_contents();
+    if (outputIndex == response->outputs_size()) {
+        response->add_outputs()->set_name(name);
+    }
+    while (response->raw_output_contents_size() <= outputIndex) {
+        response->add_raw_output_contents();
+    }
+    auto* content = response->mutable_raw_output_contents(outputIndex);
     content->resize(size);
     bufferOut = content->data();
     return StatusCode::OK;
@@ -39,6 +39,9 @@ const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE = "ovms_infer_req_queue_size"
 
 const std::string METRIC_NAME_INFER_REQ_ACTIVE = "ovms_infer_req_active";
 
+const std::string METRIC_NAME_SHAPE_CACHE_HITS = "ovms_shape_cache_hits";
+const std::string METRIC_NAME_SHAPE_CACHE_MISSES = "ovms_shape_cache_misses";
+
 const std::string METRIC_NAME_INFERENCE_TIME = "ovms_inference_time_us";
 const std::string METRIC_NAME_CURRENT_REQUESTS = "ovms_current_requests";
 const std::string METRIC_NAME_REQUEST_TIME = "ovms_request_time_us";
@@ -31,6 +31,9 @@ extern const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE;
 
 extern const std::string METRIC_NAME_INFER_REQ_ACTIVE;
 
+extern const std::string METRIC_NAME_SHAPE_CACHE_HITS;
+extern const std::string METRIC_NAME_SHAPE_CACHE_MISSES;
+
 extern const std::string METRIC_NAME_INFERENCE_TIME;
 extern const std::string METRIC_NAME_CURRENT_REQUESTS;
 extern const std::string METRIC_NAME_REQUEST_TIME;
@@ -74,7 +77,9 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {METRIC_NAME_INFER_REQ_QUEUE_SIZE},
-        {METRIC_NAME_INFER_REQ_ACTIVE}};
+        {METRIC_NAME_INFER_REQ_ACTIVE},
+        {METRIC_NAME_SHAPE_CACHE_HITS},
+        {METRIC_NAME_SHAPE_CACHE_MISSES}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {METRIC_NAME_CURRENT_REQUESTS},
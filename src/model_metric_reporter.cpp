@@ -321,6 +321,26 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_SHAPE_CACHE_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of batch size or shape changes served by previously compiled model.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeCacheHits = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeCacheHits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_CACHE_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of batch size or shape changes which required model compilation.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeCacheMisses = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeCacheMisses, "cannot create metric");
+    }
 }
 
 }  // namespace ovms
@@ -148,6 +148,9 @@ public:
     std::unique_ptr<MetricGauge> inferReqActive;
     std::unique_ptr<MetricGauge> currentRequests;
 
+    std::unique_ptr<MetricCounter> shapeCacheHits;
+    std::unique_ptr<MetricCounter> shapeCacheMisses;
+
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 };
 
@@ -120,6 +120,22 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to nireq mismatch", this->name);
         return true;
     }
+    if (this->maxBatchSize != rhs.maxBatchSize) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to maxBatchSize mismatch", this->name);
+        return true;
+    }
+    if (this->maxQueueDelayUs != rhs.maxQueueDelayUs) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to maxQueueDelayUs mismatch", this->name);
+        return true;
+    }
+    if (this->shapeCacheSize != rhs.shapeCacheSize) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shapeCacheSize mismatch", this->name);
+        return true;
+    }
+    if (this->acceptPrecisions != rhs.acceptPrecisions) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to acceptPrecisions mismatch", this->name);
+        return true;
+    }
     if (this->pluginConfig != rhs.pluginConfig) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to plugin config mismatch", this->name);
         return true;
@@ -283,6 +299,39 @@ Status ModelConfig::parseModelVersionPolicy(std::string command) {
     return StatusCode::MODEL_VERSION_POLICY_UNSUPPORTED_KEY;
 }
 
+Status ModelConfig::parseAcceptPrecisions(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        SPDLOG_ERROR("accept_precisions parameter has to be an object mapping input name to precision or list of precisions");
+        return StatusCode::INVALID_ACCEPT_PRECISIONS;
+    }
+    accept_precisions_map_t acceptPrecisions;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        std::vector<const rapidjson::Value*> values;
+        if (it->value.IsArray()) {
+            for (const auto& value : it->value.GetArray()) {
+                values.push_back(&value);
+            }
+        } else {
+            values.push_back(&it->value);
+        }
+        auto& precisions = acceptPrecisions[it->name.GetString()];
+        for (const auto* value : values) {
+            if (!value->IsString()) {
+                SPDLOG_ERROR("accept_precisions value for input: {} has to be a precision name", it->name.GetString());
+                return StatusCode::INVALID_ACCEPT_PRECISIONS;
+            }
+            Precision precision = fromString(value->GetString());
+            if (precision == Precision::UNDEFINED) {
+                SPDLOG_ERROR("accept_precisions value: {} for input: {} is not a valid precision", value->GetString(), it->name.GetString());
+                return StatusCode::INVALID_ACCEPT_PRECISIONS;
+            }
+            precisions.insert(precision);
+        }
+    }
+    this->acceptPrecisions = std::move(acceptPrecisions);
+    return StatusCode::OK;
+}
+
 Status ModelConfig::parsePluginConfig(const rapidjson::Value& node) {
     if (!node.IsObject()) {
         return StatusCode::PLUGIN_CONFIG_WRONG_FORMAT;
@@ -605,6 +654,13 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         }
     }
 
+    if (v.HasMember("accept_precisions")) {
+        auto status = parseAcceptPrecisions(v["accept_precisions"]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
     if (v.HasMember("plugin_config")) {
         auto status = parsePluginConfig(v["plugin_config"]);
         if (!status.ok()) {
@@ -647,6 +703,30 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         this->setMaxSequenceNumber(v["max_sequence_number"].GetUint());
     }
 
+    if (v.HasMember("max_batch_size")) {
+        if (!v["max_batch_size"].IsUint()) {
+            SPDLOG_ERROR("Max batch size parameter was set above unsigned int value for model {}.", v["name"].GetString());
+            return StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER;
+        }
+        this->setMaxBatchSize(v["max_batch_size"].GetUint());
+    }
+
+    if (v.HasMember("max_queue_delay_us")) {
+        if (!this->isDynamicBatchingEnabled()) {
+            SPDLOG_ERROR("Max queue delay parameter was set for model {} without max_batch_size.", v["name"].GetString());
+            return StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER;
+        }
+        this->setMaxQueueDelayUs(v["max_queue_delay_us"].GetUint64());
+    }
+
+    if (v.HasMember("shape_cache_size")) {
+        if (!v["shape_cache_size"].IsUint()) {
+            SPDLOG_ERROR("Shape cache size parameter was set above unsigned int value for model {}.", v["name"].GetString());
+            return StatusCode::INVALID_SHAPE_CACHE_SIZE;
+        }
+        this->setShapeCacheSize(v["shape_cache_size"].GetUint());
+    }
+
     if (v.HasMember("model_version_policy")) {
         rapidjson::StringBuffer buffer;
         buffer.Clear();
@@ -695,6 +775,27 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         setBatchSize(std::nullopt);
     }
 
+    if (isDynamicBatchingEnabled()) {
+        SPDLOG_DEBUG("max_batch_size: {}", getMaxBatchSize());
+        SPDLOG_DEBUG("max_queue_delay_us: {}", getMaxQueueDelayUs());
+        if (isStateful() || getBatchingMode() == AUTO || getBatchSize().has_value() || anyShapeSetToAuto()) {
+            SPDLOG_ERROR("Dynamic batching for model {} cannot be combined with stateful, batch_size or shape auto parameters.", getName());
+            return StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER;
+        }
+    }
+
+    if (getShapeCacheSize() > 0) {
+        SPDLOG_DEBUG("shape_cache_size: {}", getShapeCacheSize());
+    }
+    if (!getAcceptPrecisions().empty()) {
+        SPDLOG_DEBUG("accept_precisions:");
+        for (auto& [inputName, precisions] : getAcceptPrecisions()) {
+            for (auto precision : precisions) {
+                SPDLOG_DEBUG("  {}: {}", inputName, toString(precision));
+            }
+        }
+    }
+
     SPDLOG_DEBUG("stateful: {}", isStateful());
     if (isStateful()) {
         SPDLOG_DEBUG("idle_sequence_cleanup: {}", getIdleSequenceCleanup());
@@ -28,6 +28,7 @@
 
 #include "layout_configuration.hpp"
 #include "modelversion.hpp"
+#include "precision.hpp"
 #include "shape.hpp"
 #include "status.hpp"
 
@@ -37,10 +38,12 @@ class ModelVersionPolicy;
 using mapping_config_t = std::unordered_map<std::string, std::string>;
 using plugin_config_t = std::map<std::string, ov::Any>;
 using custom_loader_options_config_t = std::map<std::string, std::string>;
+using accept_precisions_map_t = std::map<std::string, std::set<Precision>>;
 
 extern const std::string ANONYMOUS_INPUT_NAME;
 extern const std::string MAPPING_CONFIG_JSON;
 const uint32_t DEFAULT_MAX_SEQUENCE_NUMBER = 500;
+const uint64_t DEFAULT_MAX_QUEUE_DELAY_US = 500;
 
 /**
      * @brief This class represents model configuration
@@ -112,6 +115,26 @@ private:
          */
     uint32_t maxSequenceNumber;
 
+    /**
+         * @brief Maximum batch size of merged requests, 0 disables dynamic batching
+         */
+    uint32_t maxBatchSize = 0;
+
+    /**
+         * @brief Maximum time the first request of a batch waits for other requests to join
+         */
+    uint64_t maxQueueDelayUs = DEFAULT_MAX_QUEUE_DELAY_US;
+
+    /**
+         * @brief Number of previously compiled shape variants kept for batch size or shape auto, 0 disables caching
+         */
+    uint32_t shapeCacheSize = 0;
+
+    /**
+         * @brief Request precisions converted to model input precision during deserialization, per input name
+         */
+    accept_precisions_map_t acceptPrecisions;
+
     /**
          * @brief Model cache directory
          */
@@ -585,6 +608,96 @@ public:
         this->maxSequenceNumber = maxSequenceNumber;
     }
 
+    /**
+     * @brief Get max batch size of requests merged by dynamic batching
+     *
+     * @return uint
+     */
+    uint32_t getMaxBatchSize() const {
+        return this->maxBatchSize;
+    }
+
+    /**
+     * @brief Set max batch size of requests merged by dynamic batching
+     *
+     * @param maxBatchSize
+     */
+    void setMaxBatchSize(const uint32_t maxBatchSize) {
+        this->maxBatchSize = maxBatchSize;
+    }
+
+    /**
+     * @brief Check if requests should be merged by dynamic batching
+     *
+     * @return bool
+     */
+    bool isDynamicBatchingEnabled() const {
+        return this->maxBatchSize > 0;
+    }
+
+    /**
+     * @brief Get max time in microseconds request waits in dynamic batching queue
+     *
+     * @return uint
+     */
+    uint64_t getMaxQueueDelayUs() const {
+        return this->maxQueueDelayUs;
+    }
+
+    /**
+     * @brief Set max time in microseconds request waits in dynamic batching queue
+     *
+     * @param maxQueueDelayUs
+     */
+    void setMaxQueueDelayUs(const uint64_t maxQueueDelayUs) {
+        this->maxQueueDelayUs = maxQueueDelayUs;
+    }
+
+    /**
+     * @brief Get number of previously compiled shape variants kept in memory
+     *
+     * @return uint
+     */
+    uint32_t getShapeCacheSize() const {
+        return this->shapeCacheSize;
+    }
+
+    /**
+     * @brief Set number of previously compiled shape variants kept in memory
+     *
+     * @param shapeCacheSize
+     */
+    void setShapeCacheSize(const uint32_t shapeCacheSize) {
+        this->shapeCacheSize = shapeCacheSize;
+    }
+
+    /**
+     * @brief Get request precisions accepted for model inputs
+     *
+     * @return const accept_precisions_map_t&
+     */
+    const accept_precisions_map_t& getAcceptPrecisions() const {
+        return this->acceptPrecisions;
+    }
+
+    /**
+     * @brief Set request precisions accepted for model inputs
+     *
+     * @param acceptPrecisions
+     */
+    void setAcceptPrecisions(const accept_precisions_map_t& acceptPrecisions) {
+        this->acceptPrecisions = acceptPrecisions;
+    }
+
+    /**
+         * @brief Parses json node for input names and precisions accepted in requests
+         *
+         * @param json node representing accept_precisions
+         *
+         * @return status
+         */
+    Status parseAcceptPrecisions(const rapidjson::Value& node);
+
     /**
      * @brief Get stateful sequence timeout
      *
@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <thread>
@@ -31,10 +32,13 @@
 
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferenceresponse.hpp"
+#include "compiled_model_cache.hpp"
 #include "config.hpp"
 #include "customloaderinterface.hpp"
 #include "customloaders.hpp"
+#include "dags/tensormap.hpp"
 #include "deserialization.hpp"
+#include "dynamic_batching_scheduler.hpp"
 #include "executingstreamidguard.hpp"
 #include "filesystem.hpp"
 #include "layout.hpp"
@@ -44,6 +48,7 @@
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "ov_utils.hpp"
+#include "precision_conversion.hpp"
 #include "predict_request_validation_utils.hpp"
 #include "prediction_service_utils.hpp"
 #include "profiler.hpp"
@@ -429,6 +434,14 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
 
     configureBatchSize(this->config, parameter);
 
+    for (const auto& [acceptPrecisionsInputName, acceptedPrecisions] : config.getAcceptPrecisions()) {
+        if (modelShapes.count(acceptPrecisionsInputName) == 0 && modelShapes.count(config.getRealInputNameByValue(acceptPrecisionsInputName)) == 0) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Input: {} from accept_precisions parameter not found in model: {}; version: {}",
+                acceptPrecisionsInputName, getName(), getVersion());
+            return StatusCode::INVALID_ACCEPT_PRECISIONS;
+        }
+    }
+
     for (const ov::Output<ov::Node>& input : this->model->inputs()) {
         try {
             std::string name = input.get_any_name();
@@ -443,13 +456,33 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
                 return StatusCode::LAYOUT_INCOMPATIBLE_WITH_SHAPE;
             }
 
-            std::shared_ptr<const TensorInfo> info = std::make_shared<TensorInfo>(
+            auto info = std::make_shared<TensorInfo>(
                 name,
                 mappingName,
                 precision,
                 shape,
                 layout);
 
+            auto acceptPrecisionsIt = config.getAcceptPrecisions().find(name);
+            if (acceptPrecisionsIt == config.getAcceptPrecisions().end()) {
+                acceptPrecisionsIt = config.getAcceptPrecisions().find(mappingName);
+            }
+            if (acceptPrecisionsIt != config.getAcceptPrecisions().end()) {
+                std::set<Precision> acceptedPrecisions;
+                for (auto acceptedPrecision : acceptPrecisionsIt->second) {
+                    if (acceptedPrecision == precision) {
+                        continue;
+                    }
+                    if (!isPrecisionConversionSupported(acceptedPrecision, precision)) {
+                        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Conversion from precision: {} to input: {} precision: {} is not supported",
+                            toString(acceptedPrecision), name, toString(precision));
+                        return StatusCode::INVALID_ACCEPT_PRECISIONS;
+                    }
+                    acceptedPrecisions.insert(acceptedPrecision);
+                }
+                info->setAcceptedPrecisions(acceptedPrecisions);
+            }
+
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Input {}", info->asString());
             this->inputsInfo[info->getMappedName()] = std::move(info);
         } catch (const ov::Exception& e) {
@@ -709,9 +742,6 @@ Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
         return status;
     }
 
-    uint32_t numberOfStreams = getNumOfStreams();
-    SET_IF_ENABLED(getMetricReporter().streams, numberOfStreams);
-
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Plugin config for device: {}", targetDevice);
     for (const auto& pair : pluginConfig) {
         const auto& key = pair.first;
@@ -800,21 +830,143 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
         return Status(StatusCode::INVALID_NIREQ, "Exceeded allowed nireq value");
     }
     inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
-    SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, numberOfParallelInferRequests);
+    return StatusCode::OK;
+}
+
+void ModelInstance::setCompiledModelAvailable() {
+    SET_IF_ENABLED(getMetricReporter().streams, getNumOfStreams());
+    SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, inferRequestsQueue->getSize());
     auto batchSize = getBatchSize();
     SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
         getName(),
         getVersion(),
         batchSize.has_value() ? batchSize.value().toString() : std::string{"none"},
-        numberOfParallelInferRequests);
+        inferRequestsQueue->getSize());
+    try {
+        bool isModelLoadedFromCache = compiledModel->get_property(ov::loaded_from_cache);
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Is model loaded from cache: {}", isModelLoadedFromCache);
+    } catch (...) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Unable to get information if model was loaded from cache; model: {}; version: {}; device: {}", getName(), getVersion(), config.getTargetDevice());
+    }
+    this->status.setAvailable();
+    modelLoadedNotify.notify_all();
+}
+
+Status ModelInstance::prepareDynamicBatchingScheduler(const ModelConfig& config) {
+    if (!config.isDynamicBatchingEnabled()) {
+        return StatusCode::OK;
+    }
+    for (const auto* tensorsInfo : {&getInputsInfo(), &getOutputsInfo()}) {
+        for (const auto& [name, tensorInfo] : *tensorsInfo) {
+            if (!tensorInfo->getLayout().getBatchIndex().has_value()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Dynamic batching for model: {}; version: {}; requires batch dimension in layout of tensor: {}",
+                    getName(), getVersion(), name);
+                return StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER;
+            }
+        }
+    }
+    dynamicBatchingScheduler = std::make_unique<DynamicBatchingScheduler>(*this, config.getMaxBatchSize(), std::chrono::microseconds(config.getMaxQueueDelayUs()));
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Dynamic batching enabled for model: {}; version: {}; max batch size: {}; max queue delay: {} us",
+        getName(), getVersion(), config.getMaxBatchSize(), config.getMaxQueueDelayUs());
     return StatusCode::OK;
 }
 
+void ModelInstance::prepareShapeCache(const ModelConfig& config) {
+    if (this->shapeCache || config.getShapeCacheSize() == 0) {
+        return;
+    }
+    if (config.getBatchingMode() != Mode::AUTO && !config.anyShapeSetToAuto()) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Shape cache for model: {}; version: {}; is not used since neither batch size nor shape is set to auto",
+            getName(), getVersion());
+        return;
+    }
+    this->shapeCache = std::make_unique<CompiledModelCache>(config.getShapeCacheSize());
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Shape cache enabled for model: {}; version: {}; size: {}",
+        getName(), getVersion(), config.getShapeCacheSize());
+}
+
+std::string ModelInstance::createShapeCacheKey(const DynamicModelParameter& parameter) const {
+    std::map<std::string, Shape> shapes;
+    for (const auto& [name, tensorInfo] : getInputsInfo()) {
+        Shape shape = tensorInfo->getShape();
+        if (parameter.isBatchSizeRequested()) {
+            const auto& batchIndex = tensorInfo->getLayout().getBatchIndex();
+            if (batchIndex.has_value() && batchIndex.value() < shape.size()) {
+                shape[batchIndex.value()] = Dimension(parameter.getBatchSize());
+            }
+        } else if (config.isShapeAuto(name) && parameter.isShapeRequested(name)) {
+            shape = Shape(parameter.getShape(name));
+        }
+        shapes.emplace(name, std::move(shape));
+    }
+    return createShapesSignature(shapes);
+}
+
+std::unique_ptr<CompiledModelVariant> ModelInstance::detachShapeVariant() {
+    auto variant = std::make_unique<CompiledModelVariant>();
+    variant->model = std::move(this->model);
+    variant->compiledModel = std::move(this->compiledModel);
+    variant->inferRequestsQueue = std::move(this->inferRequestsQueue);
+    variant->inputsInfo = std::move(this->inputsInfo);
+    variant->outputsInfo = std::move(this->outputsInfo);
+    this->inputsInfo.clear();
+    this->outputsInfo.clear();
+    return variant;
+}
+
+void ModelInstance::attachShapeVariant(std::unique_ptr<CompiledModelVariant> variant) {
+    this->model = std::move(variant->model);
+    this->compiledModel = std::move(variant->compiledModel);
+    this->inferRequestsQueue = std::move(variant->inferRequestsQueue);
+    this->inputsInfo = std::move(variant->inputsInfo);
+    this->outputsInfo = std::move(variant->outputsInfo);
+}
+
+bool ModelInstance::switchToCachedShapeVariant(const DynamicModelParameter& parameter) {
+    OVMS_PROFILE_FUNCTION();
+    const std::string requestedKey = createShapeCacheKey(parameter);
+    auto variant = this->shapeCache->take(requestedKey);
+    if (!variant) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Shape cache miss for model: {}; version: {}; shapes: {}", getName(), getVersion(), requestedKey);
+        INCREMENT_IF_ENABLED(this->getMetricReporter().shapeCacheMisses);
+        return false;
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Shape cache hit for model: {}; version: {}; shapes: {}", getName(), getVersion(), requestedKey);
+    INCREMENT_IF_ENABLED(this->getMetricReporter().shapeCacheHits);
+    subscriptionManager.notifySubscribers();
+    const std::string currentKey = createShapeCacheKey();
+    this->shapeCache->put(currentKey, detachShapeVariant());
+    attachShapeVariant(std::move(variant));
+    setCompiledModelAvailable();
+    return true;
+}
+
+Status ModelInstance::loadShapeVariant(const ModelConfig& config, const DynamicModelParameter& parameter) {
+    OVMS_PROFILE_FUNCTION();
+    const std::string currentKey = createShapeCacheKey();
+    auto current = detachShapeVariant();
+    // model is reshaped in place during load, cached variant keeps its own copy
+    if (current->model) {
+        this->model = current->model->clone();
+    }
+    auto status = loadModelImpl(config, parameter);
+    if (!status.ok()) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Restoring previously used compiled model for model: {}; version: {}; shapes: {}", getName(), getVersion(), currentKey);
+        attachShapeVariant(std::move(current));
+        return status;
+    }
+    this->shapeCache->put(currentKey, std::move(current));
+    return status;
+}
+
 void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicModelParameter& parameter) {
     if (parameter.isBatchSizeRequested()) {
         ov::set_batch(model, parameter.getBatchSize());
     } else if (config.getBatchSize().has_value()) {
         ov::set_batch(model, config.getBatchSize().value().createPartialDimension());
+    } else if (config.isDynamicBatchingEnabled()) {
+        // requests of any batch size up to max_batch_size are accepted and merged
+        ov::set_batch(model, ov::Dimension(1, config.getMaxBatchSize()));
     }
 }
 
@@ -868,6 +1020,12 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        status = prepareDynamicBatchingScheduler(this->config);
+        if (!status.ok()) {
+            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+            return status;
+        }
+        prepareShapeCache(this->config);
     } catch (const ov::Exception& e) {
         SPDLOG_ERROR("exception occurred while loading model: {}", e.what());
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -877,14 +1035,7 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
         return StatusCode::MODEL_NOT_LOADED;
     }
-    try {
-        bool isModelLoadedFromCache = compiledModel->get_property(ov::loaded_from_cache);
-        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Is model loaded from cache: {}", isModelLoadedFromCache);
-    } catch (...) {
-        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Unable to get information if model was loaded from cache; model: {}; version: {}; device: {}", getName(), getVersion(), config.getTargetDevice());
-    }
-    this->status.setAvailable();
-    modelLoadedNotify.notify_all();
+    setCompiledModelAvailable();
     return status;
 }
 
@@ -932,6 +1083,15 @@ Status ModelInstance::reloadModel(const ModelConfig& config, const DynamicModelP
         isCustomLoaderConfigChanged = false;
         retireModel(isCustomLoaderConfigChanged);
     }
+    if (!parameter.isAnyRequested()) {
+        // compiled variants are not valid for new configuration
+        this->shapeCache.reset();
+    } else if (this->shapeCache) {
+        if (switchToCachedShapeVariant(parameter)) {
+            return StatusCode::OK;
+        }
+        return loadShapeVariant(config, parameter);
+    }
     return loadModelImpl(config, parameter);
 }
 
@@ -1100,6 +1260,8 @@ void ModelInstance::unloadModelComponents() {
     }
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
+    dynamicBatchingScheduler.reset();
+    shapeCache.reset();
     inferRequestsQueue.reset();
     compiledModel.reset();
     model.reset();
@@ -1172,15 +1334,11 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
 }
 
 template <typename RequestType, typename ResponseType>
-Status ModelInstance::infer(const RequestType* requestProto,
-    ResponseType* responseProto,
+Status ModelInstance::prepareRequestProcessing(const RequestType* requestProto,
+    RequestProcessor<RequestType, ResponseType>& requestProcessor,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
     OVMS_PROFILE_FUNCTION();
-    Timer<TIMER_END> timer;
-    using std::chrono::microseconds;
-
-    auto requestProcessor = createRequestProcessor(requestProto, responseProto);  // request, response passed only to deduce type
-    auto status = requestProcessor->extractRequestParameters(requestProto);
+    auto status = requestProcessor.extractRequestParameters(requestProto);
     if (!status.ok())
         return status;
     status = validate(requestProto);
@@ -1193,9 +1351,24 @@ Status ModelInstance::infer(const RequestType* requestProto,
     }
     if (!status.ok())
         return status;
-    status = requestProcessor->prepare();
+    return requestProcessor.prepare();
+}
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::infer(const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
+
+    auto requestProcessor = createRequestProcessor(requestProto, responseProto);  // request, response passed only to deduce type
+    auto status = prepareRequestProcessing(requestProto, *requestProcessor, modelUnloadGuardPtr);
     if (!status.ok())
         return status;
+    if (this->dynamicBatchingScheduler) {
+        return inferWithDynamicBatching(requestProto, responseProto, *requestProcessor);
+    }
 
     timer.start(GET_INFER_REQUEST);
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
@@ -1227,6 +1400,10 @@ Status ModelInstance::infer(const RequestType* requestProto,
     SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
 
+    // outputs are written directly to response, original tensors are restored before infer request is returned
+    OutputBinding outputBinding(inferRequest);
+    outputBinding.bindOutputs(getOutputsInfo(), responseProto, useSharedOutputContentFn(requestProto));
+
     timer.start(PREDICTION);
     status = performInference(inferRequest);
     timer.stop(PREDICTION);
@@ -1258,6 +1435,318 @@ Status ModelInstance::infer(const RequestType* requestProto,
     status = requestProcessor->release();
     return status;
 }
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::inferWithDynamicBatching(const RequestType* requestProto,
+    ResponseType* responseProto,
+    RequestProcessor<RequestType, ResponseType>& requestProcessor) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
+
+    timer.start(DESERIALIZE);
+    TensorMap inputs;
+    InputSink<TensorMap&> inputSink(inputs);
+    bool isPipeline = false;
+    auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    timer.stop(DESERIALIZE);
+    if (!status.ok())
+        return status;
+    SPDLOG_DEBUG("Deserialization duration in model {}, version {}: {:.3f} ms",
+        getName(), getVersion(), timer.elapsed<microseconds>(DESERIALIZE) / 1000);
+
+    timer.start(PREDICTION);
+    TensorMap outputs;
+    status = this->dynamicBatchingScheduler->schedule(inputs, outputs);
+    timer.stop(PREDICTION);
+    if (!status.ok())
+        return status;
+    SPDLOG_DEBUG("Prediction duration (including dynamic batching queue) in model {}, version {}: {:.3f} ms",
+        getName(), getVersion(), timer.elapsed<microseconds>(PREDICTION) / 1000);
+
+    timer.start(SERIALIZE);
+    OutputGetter<const TensorMap&> outputGetter(outputs);
+    status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    timer.stop(SERIALIZE);
+    if (!status.ok())
+        return status;
+    SPDLOG_DEBUG("Serialization duration in model {}, version {}: {:.3f} ms",
+        getName(), getVersion(), timer.elapsed<microseconds>(SERIALIZE) / 1000);
+
+    return requestProcessor.release();
+}
+
+/**
+ * @brief State of asynchronous inference of model with dynamic batching, kept alive by the batch it joined
+ */
+template <typename RequestType, typename ResponseType>
+struct DynamicBatchingInferenceContext {
+    const RequestType* requestProto;
+    ResponseType* responseProto;
+    std::unique_ptr<RequestProcessor<RequestType, ResponseType>> requestProcessor;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelUnloadGuard;
+    TensorMap inputs;
+    TensorMap outputs;
+    InferenceCompletionCallback onComplete;
+    Timer<TIMER_END> timer;
+};
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::inferAsyncWithDynamicBatching(const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    InferenceCompletionCallback onComplete) {
+    OVMS_PROFILE_FUNCTION();
+    using std::chrono::microseconds;
+    auto context = std::make_shared<DynamicBatchingInferenceContext<RequestType, ResponseType>>();
+    context->requestProto = requestProto;
+    context->responseProto = responseProto;
+    context->requestProcessor = createRequestProcessor(requestProto, responseProto);  // request, response passed only to deduce type
+    auto status = prepareRequestProcessing(requestProto, *context->requestProcessor, modelUnloadGuardPtr);
+    if (!status.ok())
+        return status;
+
+    context->timer.start(DESERIALIZE);
+    InputSink<TensorMap&> inputSink(context->inputs);
+    bool isPipeline = false;
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    context->timer.stop(DESERIALIZE);
+    if (!status.ok())
+        return status;
+    SPDLOG_DEBUG("Deserialization duration in model {}, version {}: {:.3f} ms",
+        getName(), getVersion(), context->timer.template elapsed<microseconds>(DESERIALIZE) / 1000);
+
+    // from now on model cannot be unloaded until the batch request joined is finished
+    context->modelUnloadGuard = std::move(modelUnloadGuardPtr);
+    context->onComplete = std::move(onComplete);
+    context->timer.start(PREDICTION);
+    status = this->dynamicBatchingScheduler->scheduleAsync(context->inputs, context->outputs, [this, context](Status status) mutable {
+        context->timer.stop(PREDICTION);
+        if (status.ok()) {
+            SPDLOG_DEBUG("Prediction duration (including dynamic batching queue) in model {}, version {}: {:.3f} ms",
+                getName(), getVersion(), context->timer.template elapsed<microseconds>(PREDICTION) / 1000);
+            OutputGetter<const TensorMap&> outputGetter(context->outputs);
+            status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), context->responseProto, getTensorInfoName, useSharedOutputContentFn(context->requestProto));
+        }
+        if (status.ok()) {
+            status = context->requestProcessor->release();
+        }
+        auto onComplete = std::move(context->onComplete);
+        auto modelUnloadGuard = std::move(context->modelUnloadGuard);
+        context.reset();
+        onComplete(status);
+        // model cannot be unloaded while this callback still runs, so guard is released last
+        modelUnloadGuard.reset();
+    });
+    if (!status.ok()) {
+        modelUnloadGuardPtr = std::move(context->modelUnloadGuard);
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+/**
+ * @brief State of asynchronous inference. While waiting for idle infer request it is linked into
+ * the line of infer requests queue and keeps itself alive, then it is resumed by the thread returning the stream.
+ */
+template <typename RequestType, typename ResponseType>
+struct AsyncInferenceContext : public IdleStreamWaiter {
+    AsyncInferenceContext(ModelInstance& modelInstance) :
+        IdleStreamWaiter(true),
+        modelInstance(modelInstance) {}
+    void onStreamAssigned(int streamId) override {
+        this->assignedStreamId = streamId;
+    }
+    void resume() override;
+
+    ModelInstance& modelInstance;
+    const RequestType* requestProto;
+    ResponseType* responseProto;
+    std::unique_ptr<RequestProcessor<RequestType, ResponseType>> requestProcessor;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelUnloadGuard;
+    std::optional<int> assignedStreamId;
+    std::shared_ptr<AsyncInferenceContext> waitingSelf;
+    std::unique_ptr<ExecutingStreamIdGuard> executingStreamIdGuard;
+    std::unique_ptr<OutputBinding> outputBinding;
+    InferenceCompletionCallback onComplete;
+    Timer<TIMER_END> timer;
+};
+
+/**
+ * @brief Restores infer request of the context, so it can be reused by synchronous path which does not expect
+ * any callback. Captures of the completion callback are destroyed here.
+ */
+template <typename RequestType, typename ResponseType>
+static void releaseInferRequest(AsyncInferenceContext<RequestType, ResponseType>& context) {
+    if (context.executingStreamIdGuard) {
+        context.executingStreamIdGuard->getInferRequest().set_callback([](std::exception_ptr exceptionPtr) {});
+    }
+    context.outputBinding.reset();
+}
+
+/**
+ * @brief Finishes asynchronous inference which was already accepted, calling onComplete exactly once.
+ * Stream is returned after onComplete so next request resumed on this thread does not delay the response,
+ * and model cannot be unloaded until everything is released, so unload guard is released last.
+ */
+template <typename RequestType, typename ResponseType>
+static void completeAsyncInference(std::shared_ptr<AsyncInferenceContext<RequestType, ResponseType>> context, const Status& status) {
+    releaseInferRequest(*context);
+    auto onComplete = std::move(context->onComplete);
+    auto executingStreamIdGuard = std::move(context->executingStreamIdGuard);
+    auto modelUnloadGuard = std::move(context->modelUnloadGuard);
+    context.reset();
+    onComplete(status);
+    executingStreamIdGuard.reset();
+    modelUnloadGuard.reset();
+}
+
+template <typename RequestType, typename ResponseType>
+void AsyncInferenceContext<RequestType, ResponseType>::resume() {
+    // context is kept alive by local reference from now on
+    auto context = std::move(this->waitingSelf);
+    auto status = this->modelInstance.startAsyncInference(context);
+    if (!status.ok()) {
+        completeAsyncInference(std::move(context), status);
+    }
+}
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::startAsyncInference(const std::shared_ptr<AsyncInferenceContext<RequestType, ResponseType>>& context) {
+    OVMS_PROFILE_FUNCTION();
+    using std::chrono::microseconds;
+    context->timer.stop(GET_INFER_REQUEST);
+    OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, context->timer.template elapsed<microseconds>(GET_INFER_REQUEST));
+    context->executingStreamIdGuard = std::make_unique<ExecutingStreamIdGuard>(getInferRequestsQueue(), this->getMetricReporter(), context->assignedStreamId.value());
+    ov::InferRequest& inferRequest = context->executingStreamIdGuard->getInferRequest();
+
+    auto status = context->requestProcessor->preInferenceProcessing(inferRequest);
+    if (!status.ok())
+        return status;
+    InputSink<ov::InferRequest&> inputSink(inferRequest);
+    bool isPipeline = false;
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*context->requestProto, getInputsInfo(), inputSink, isPipeline);
+    if (!status.ok())
+        return status;
+    try {
+        context->outputBinding = std::make_unique<OutputBinding>(inferRequest);
+        context->outputBinding->bindOutputs(getOutputsInfo(), context->responseProto, useSharedOutputContentFn(context->requestProto));
+        inferRequest.set_callback([this, capturedContext = context](std::exception_ptr exceptionPtr) {
+            // local copy keeps context alive after this callback is replaced
+            auto context = capturedContext;
+            OVMS_PROFILE_ASYNC_END("async inference", context.get());
+            context->timer.stop(PREDICTION);
+            auto& completedInferRequest = context->executingStreamIdGuard->getInferRequest();
+            Status status = StatusCode::OK;
+            if (exceptionPtr) {
+                status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+                try {
+                    std::rethrow_exception(exceptionPtr);
+                } catch (const std::exception& e) {
+                    SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+                } catch (...) {
+                    SPDLOG_ERROR("Async caught an exception {}", status.string());
+                }
+            } else {
+                double inferTime = context->timer.template elapsed<microseconds>(PREDICTION);
+                OBSERVE_IF_ENABLED(this->getMetricReporter().inferenceTime, inferTime);
+                SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
+                    getName(), getVersion(), context->executingStreamIdGuard->getId(), inferTime / 1000);
+                OutputGetter<ov::InferRequest&> outputGetter(completedInferRequest);
+                status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), context->responseProto, getTensorInfoName, useSharedOutputContentFn(context->requestProto));
+                if (status.ok()) {
+                    status = context->requestProcessor->postInferenceProcessing(context->responseProto, completedInferRequest);
+                }
+                if (status.ok()) {
+                    status = context->requestProcessor->release();
+                }
+            }
+            // captures of this lambda are destroyed when callback is replaced, so only locals are used from now on
+            completeAsyncInference(std::move(context), status);
+        });
+        context->timer.start(PREDICTION);
+        OVMS_PROFILE_SYNC_BEGIN("ov::InferRequest::start_async");
+        inferRequest.start_async();
+        OVMS_PROFILE_SYNC_END("ov::InferRequest::start_async");
+        OVMS_PROFILE_ASYNC_BEGIN("async inference", context.get());
+    } catch (const std::exception& e) {
+        // callback captures the context, it has to be replaced to not keep it alive
+        releaseInferRequest(*context);
+        status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        return status;
+    } catch (...) {
+        releaseInferRequest(*context);
+        status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}", status.string());
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+bool ModelInstance::mayBlockAsyncInference() const {
+    return getModelConfig().isStateful() || getModelConfig().isDynamicParameterEnabled();
+}
+
+template <typename RequestType, typename ResponseType>
+Status ModelInstance::inferAsync(const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    InferenceCompletionCallback onComplete) {
+    OVMS_PROFILE_FUNCTION();
+    if (getModelConfig().isStateful()) {
+        // sequence locks are bound to calling thread
+        auto status = infer(requestProto, responseProto, modelUnloadGuardPtr);
+        if (status.ok()) {
+            onComplete(status);
+        }
+        return status;
+    }
+    if (this->dynamicBatchingScheduler) {
+        return inferAsyncWithDynamicBatching(requestProto, responseProto, modelUnloadGuardPtr, std::move(onComplete));
+    }
+
+    auto context = std::make_shared<AsyncInferenceContext<RequestType, ResponseType>>(*this);
+    context->requestProto = requestProto;
+    context->responseProto = responseProto;
+    context->requestProcessor = createRequestProcessor(requestProto, responseProto);  // request, response passed only to deduce type
+    auto status = prepareRequestProcessing(requestProto, *context->requestProcessor, modelUnloadGuardPtr);
+    if (!status.ok())
+        return status;
+
+    // from now on model cannot be unloaded until the context is finished
+    context->modelUnloadGuard = std::move(modelUnloadGuardPtr);
+    context->onComplete = std::move(onComplete);
+    context->timer.start(GET_INFER_REQUEST);
+    // context has to be complete before it is linked, since it can be resumed by other thread right away
+    context->waitingSelf = context;
+    auto streamId = getInferRequestsQueue().tryToGetIdleStream(*context);
+    if (!streamId) {
+        SPDLOG_DEBUG("No idle infer request in model {}, version {}, request waits in line", getName(), getVersion());
+        return StatusCode::OK;
+    }
+    context->waitingSelf.reset();
+    context->assignedStreamId = streamId;
+    status = startAsyncInference(context);
+    if (!status.ok()) {
+        releaseInferRequest(*context);
+        context->executingStreamIdGuard.reset();
+        modelUnloadGuardPtr = std::move(context->modelUnloadGuard);
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+template Status ModelInstance::inferAsync<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>(const tensorflow::serving::PredictRequest* requestProto,
+    tensorflow::serving::PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    InferenceCompletionCallback onComplete);
+template Status ModelInstance::inferAsync(const ::KFSRequest* requestProto,
+    ::KFSResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    InferenceCompletionCallback onComplete);
+template Status ModelInstance::inferAsync<InferenceRequest, InferenceResponse>(InferenceRequest const*, InferenceResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, InferenceCompletionCallback);
+
 template Status ModelInstance::infer<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>(const tensorflow::serving::PredictRequest* requestProto,
     tensorflow::serving::PredictResponse* responseProto,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
@@ -37,6 +37,9 @@
 #include "tfs_frontend/tfs_utils.hpp"
 
 namespace ovms {
+class CompiledModelCache;
+struct CompiledModelVariant;
+class DynamicBatchingScheduler;
 class MetricRegistry;
 class ModelInstanceUnloadGuard;
 class InferenceRequest;
@@ -45,6 +48,10 @@ class PipelineDefinition;
 class Status;
 template <typename T1, typename T2>
 struct RequestProcessor;
+template <typename T1, typename T2>
+struct AsyncInferenceContext;
+
+using InferenceCompletionCallback = std::function<void(Status)>;
 
 class DynamicModelParameter {
 public:
@@ -60,6 +67,7 @@ public:
 
     bool isBatchSizeRequested() const { return batchSize > 0; }
     bool isShapeRequested(const std::string& name) const { return shapes.count(name) && shapes.at(name).size() > 0; }
+    bool isAnyRequested() const { return isBatchSizeRequested() || !shapes.empty(); }
 
     int getBatchSize() const { return batchSize; }
     const shape_t& getShape(const std::string& name) const { return shapes.at(name); }
@@ -210,6 +218,48 @@ protected:
          */
     Status prepareInferenceRequestsQueue(const ModelConfig& config);
 
+    /**
+         * @brief Reports metrics of compiled model and inference requests queue in use and marks model as available
+         *
+         * Shared by model compilation and switching to compiled variant from shape cache.
+         */
+    void setCompiledModelAvailable();
+
+    /**
+         * @brief Prepares scheduler merging requests if dynamic batching is enabled
+         */
+    Status prepareDynamicBatchingScheduler(const ModelConfig& config);
+
+    /**
+         * @brief Creates cache of compiled shape variants if enabled for batch size or shape auto
+         */
+    void prepareShapeCache(const ModelConfig& config);
+
+    /**
+         * @brief Puts currently used compiled model into shape cache and switches to previously compiled one matching requested shapes
+         *
+         * @return true if matching variant was found in cache, otherwise currently used compiled model is left in place
+         */
+    bool switchToCachedShapeVariant(const DynamicModelParameter& parameter);
+
+    /**
+         * @brief Compiles model for requested shapes and puts previously used compiled model into shape cache once it succeeds.
+         * On failure previously used compiled model is restored.
+         *
+         * @return Status
+         */
+    Status loadShapeVariant(const ModelConfig& config, const DynamicModelParameter& parameter);
+
+    /**
+         * @brief Moves currently used model, compiled model, inference requests queue and tensors info out of model instance
+         */
+    std::unique_ptr<CompiledModelVariant> detachShapeVariant();
+
+    /**
+         * @brief Makes variant currently used model, compiled model, inference requests queue and tensors info
+         */
+    void attachShapeVariant(std::unique_ptr<CompiledModelVariant> variant);
+
     /**
          * @brief Fetch model file paths
          *
@@ -257,6 +307,21 @@ private:
          */
     std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
 
+    /**
+         * @brief Merges concurrent requests into single inference, set only if dynamic batching is enabled
+         */
+    std::unique_ptr<DynamicBatchingScheduler> dynamicBatchingScheduler;
+
+    /**
+         * @brief Recently used compiled models for other shapes, set only if shape cache is enabled
+         */
+    std::unique_ptr<CompiledModelCache> shapeCache;
+
+    /**
+         * @brief Creates shape cache key of inputs shapes after applying dynamic parameter to current ones
+         */
+    std::string createShapeCacheKey(const DynamicModelParameter& parameter = DynamicModelParameter()) const;
+
     /**
          * @brief Holds current usage count in predict requests
          * 
@@ -290,6 +355,35 @@ private:
       */
     bool cacheDisabled = false;
 
+    template <typename RequestType, typename ResponseType>
+    Status prepareRequestProcessing(const RequestType* requestProto,
+        RequestProcessor<RequestType, ResponseType>& requestProcessor,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+
+    template <typename RequestType, typename ResponseType>
+    Status inferWithDynamicBatching(const RequestType* requestProto,
+        ResponseType* responseProto,
+        RequestProcessor<RequestType, ResponseType>& requestProcessor);
+
+    template <typename RequestType, typename ResponseType>
+    Status inferAsyncWithDynamicBatching(const RequestType* requestProto,
+        ResponseType* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        InferenceCompletionCallback onComplete);
+
+    template <typename RequestType, typename ResponseType>
+    friend struct AsyncInferenceContext;
+
+    /**
+         * @brief Fills infer request of stream assigned to asynchronous inference and starts it
+         *
+         * @param context asynchronous inference context with assigned stream
+         *
+         * @return Status OK if inference was started, error otherwise - in such case context still holds the stream
+         */
+    template <typename RequestType, typename ResponseType>
+    Status startAsyncInference(const std::shared_ptr<AsyncInferenceContext<RequestType, ResponseType>>& context);
+
     /**
          * @brief Configures batchsize
          */
@@ -572,6 +666,35 @@ public:
         ResponseType* responseProto,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
 
+    /**
+         * @brief Starts inference without waiting for its completion
+         *
+         * Response is serialized in OpenVINO completion callback which then invokes onComplete.
+         * Unload guard ownership is taken over until the completion callback finishes.
+         * If no infer request is idle, request waits in line and is started by the thread returning infer request,
+         * so calling thread does not block on it.
+         * With dynamic batching request joins the batch and is completed when batch inference finishes.
+         * Stateful models fall back to synchronous inference.
+         *
+         * @param requestProto request, has to stay valid until onComplete is called
+         * @param responseProto response, has to stay valid until onComplete is called
+         * @param modelUnloadGuardPtr unload guard, left untouched if inference could not be started
+         * @param onComplete invoked exactly once with final status if OK was returned
+         *
+         * @return Status OK if inference was started or queued, error otherwise - in such case onComplete is not called
+         */
+    template <typename RequestType, typename ResponseType>
+    Status inferAsync(const RequestType* requestProto,
+        ResponseType* responseProto,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        InferenceCompletionCallback onComplete);
+
+    /**
+         * @brief Checks if inferAsync may block calling thread for long time, since stateful models fall back
+         * to synchronous inference and models with batch size or shape set to auto may be reloaded by the request
+         */
+    bool mayBlockAsyncInference() const;
+
     ModelMetricReporter& getMetricReporter() const { return *this->reporter; }
 
     uint32_t getOptimalNumberOfInferRequests() const;
@@ -690,7 +690,7 @@ Status ModelManager::loadMetricsConfig(rapidjson::Document& configJson) {
         }
         const auto& metrics = itr2->value.GetObject();
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Parsing monitoring metrics config settings.");
-        bool forceFailureIfMetricsAreEnabled = ovms::Config::instance().restPort() == 0;
+        bool forceFailureIfMetricsAreEnabled = config.restPort() == 0 && config.restUdsPath().empty();
         return this->metricConfig.parseMetricsConfig(metrics, forceFailureIfMetricsAreEnabled);
     }
 }
@@ -1548,6 +1548,14 @@ Status ModelManager::getModelInstance(const std::string& modelName,
     ovms::model_version_t modelVersionId,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const {
+    return getModelInstance(modelName, modelVersionId, modelInstance, modelInstanceUnloadGuardPtr, waitForModelLoadedTimeoutMs);
+}
+
+Status ModelManager::getModelInstance(const std::string& modelName,
+    ovms::model_version_t modelVersionId,
+    std::shared_ptr<ovms::ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+    uint32_t loadedTimeoutMs) const {
     SPDLOG_DEBUG("Requesting model: {}; version: {}.", modelName, modelVersionId);
 
     auto model = findModelByName(modelName);
@@ -1566,7 +1574,7 @@ Status ModelManager::getModelInstance(const std::string& modelName,
         }
     }
 
-    return modelInstance->waitForLoaded(waitForModelLoadedTimeoutMs, modelInstanceUnloadGuardPtr);
+    return modelInstance->waitForLoaded(loadedTimeoutMs, modelInstanceUnloadGuardPtr);
 }
 
 const CustomNodeLibraryManager& ModelManager::getCustomNodeLibraryManager() const {
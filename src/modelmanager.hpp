@@ -330,6 +330,19 @@ public:
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const;
 
+    /**
+     * @brief Gets model instance waiting at most given time for the version to load
+     *
+     * @param loadedTimeoutMs with 0 returns MODEL_VERSION_NOT_LOADED_YET right away if version is still loading
+     *
+     * @return Status
+     */
+    Status getModelInstance(const std::string& modelName,
+        ovms::model_version_t modelVersionId,
+        std::shared_ptr<ovms::ModelInstance>& modelInstance,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+        uint32_t loadedTimeoutMs) const;
+
     const bool modelExists(const std::string& name) const {
         if (findModelByName(name) == nullptr)
             return false;
@@ -17,7 +17,6 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <future>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -36,10 +35,11 @@ public:
     OVInferRequestsQueue(ov::CompiledModel& compiledModel, int streamsLength) :
         Queue(streamsLength) {
         for (int i = 0; i < streamsLength; ++i) {
-            streams[i] = i;
             inferRequests.push_back(compiledModel.create_infer_request());
         }
     }
+
+    size_t getSize() const { return inferRequests.size(); }
 };
 
 }  // namespace ovms
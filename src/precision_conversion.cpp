@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "precision_conversion.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "profiler.hpp"
+
+namespace ovms {
+
+bool isPrecisionConversionSupported(Precision source, Precision target) {
+    if (source != Precision::FP32) {
+        return false;
+    }
+    switch (target) {
+    case Precision::FP16:
+    case Precision::BF16:
+    case Precision::I8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool convertPrecision(const void* source, Precision sourcePrecision, void* target, Precision targetPrecision, size_t count) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isPrecisionConversionSupported(sourcePrecision, targetPrecision)) {
+        return false;
+    }
+    const float* fp32Source = reinterpret_cast<const float*>(source);
+    switch (targetPrecision) {
+    case Precision::FP16:
+        convertFp32ToFp16(fp32Source, reinterpret_cast<uint16_t*>(target), count);
+        return true;
+    case Precision::BF16:
+        convertFp32ToBf16(fp32Source, reinterpret_cast<uint16_t*>(target), count);
+        return true;
+    case Precision::I8:
+        convertFp32ToI8(fp32Source, reinterpret_cast<int8_t*>(target), count);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static inline uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void convertFp32ToFp16(const float* __restrict source, uint16_t* __restrict target, size_t count) {
+    // both normal and subnormal paths are computed and selected so that loop body has no branches
+    constexpr uint32_t FP32_INFINITY = 255u << 23;
+    constexpr uint32_t FP16_OVERFLOW = (127u + 16u) << 23;
+    constexpr uint32_t FP16_MIN_NORMAL = 113u << 23;
+    constexpr uint32_t DENORM_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    const float denormMagic = bitsFloat(DENORM_MAGIC);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t bits = floatBits(source[i]);
+        uint32_t sign = bits & 0x80000000u;
+        uint32_t magnitude = bits ^ sign;
+        // subnormal result: magic addition aligns mantissa bits with FP rounding to nearest even
+        uint32_t subnormal = floatBits(bitsFloat(magnitude) + denormMagic) - DENORM_MAGIC;
+        // normal result: rebias exponent and round to nearest even
+        uint32_t mantissaOdd = (magnitude >> 13) & 1u;
+        uint32_t normal = (magnitude + ((uint32_t)(15 - 127) << 23) + 0xfffu + mantissaOdd) >> 13;
+        uint32_t infOrNan = (magnitude > FP32_INFINITY) ? 0x7e00u : 0x7c00u;
+        uint32_t result = (magnitude >= FP16_OVERFLOW) ? infOrNan : ((magnitude < FP16_MIN_NORMAL) ? subnormal : normal);
+        target[i] = static_cast<uint16_t>(result | (sign >> 16));
+    }
+}
+
+void convertFp32ToBf16(const float* __restrict source, uint16_t* __restrict target, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t bits = floatBits(source[i]);
+        uint32_t rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+        // NaN must stay NaN after rounding, so quiet bit is set instead
+        uint32_t nan = (bits >> 16) | 0x40u;
+        bool isNan = (bits & 0x7fffffffu) > 0x7f800000u;
+        target[i] = static_cast<uint16_t>(isNan ? nan : rounded);
+    }
+}
+
+void convertFp32ToI8(const float* __restrict source, int8_t* __restrict target, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        // argument order makes NaN saturate to lower bound
+        float value = std::min(127.0f, std::max(-128.0f, source[i]));
+        value += (value >= 0.0f) ? 0.5f : -0.5f;
+        target[i] = static_cast<int8_t>(std::min(127.0f, std::max(-128.0f, value)));
+    }
+}
+}  // namespace ovms
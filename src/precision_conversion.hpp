@@ -0,0 +1,42 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "precision.hpp"
+
+namespace ovms {
+
+/**
+     * @brief Checks if request data in source precision can be converted to model input precision during deserialization
+     */
+bool isPrecisionConversionSupported(Precision source, Precision target);
+
+/**
+     * @brief Converts elements between precisions supported by isPrecisionConversionSupported
+     *
+     * @return false if conversion is not supported
+     */
+bool convertPrecision(const void* source, Precision sourcePrecision, void* target, Precision targetPrecision, size_t count);
+
+// Conversion kernels are branchless so that compiler vectorizes them. Rounding is to nearest even for
+// floating point targets, INT8 is rounded half away from zero and saturated, NaN is converted to -128.
+void convertFp32ToFp16(const float* source, uint16_t* target, size_t count);
+void convertFp32ToBf16(const float* source, uint16_t* target, size_t count);
+void convertFp32ToI8(const float* source, int8_t* target, size_t count);
+}  // namespace ovms
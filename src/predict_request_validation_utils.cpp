@@ -32,6 +32,7 @@
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferencetensor.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "modelconfig.hpp"
 #include "profiler.hpp"
@@ -756,7 +757,21 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     for (int i = 0; i < proto.shape().size(); i++) {
         expectedValueCount *= proto.shape()[i];
     }
-    if (request.raw_input_contents().size()) {
+    if (usesSharedMemory(proto.parameters())) {
+        SharedMemoryReference reference;
+        auto status = getSharedMemoryReference(proto.parameters(), reference);
+        if (!status.ok()) {
+            return status;
+        }
+        size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+        if (expectedContentSize != reference.byteSize) {
+            std::stringstream ss;
+            ss << "Expected: " << expectedContentSize << " bytes; Actual: " << reference.byteSize << " bytes in shared memory; input name: " << getCurrentlyValidatedInputName();
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("[servable name: {} version: {}] Invalid content size of tensor proto - {}", servableName, servableVersion, details);
+            return Status(StatusCode::INVALID_CONTENT_SIZE, details);
+        }
+    } else if (request.raw_input_contents().size()) {
         size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
         if (expectedContentSize != request.raw_input_contents()[bufferId].size()) {
             std::stringstream ss;
@@ -857,9 +872,21 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
     return StatusCode::OK;
 }
 
+static Precision getRequestPrecision(const TFSInputTensorType& proto) {
+    return TFSPrecisionToOvmsPrecision(proto.dtype());
+}
+
+static Precision getRequestPrecision(const KFSTensorInputProto& proto) {
+    return KFSPrecisionToOvmsPrecision(proto.datatype());
+}
+
+static Precision getRequestPrecision(const InferenceTensor& tensor) {
+    return getOVMSDataTypeAsPrecision(tensor.getDataType());
+}
+
 template <>
 Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validatePrecision(const ovms::TensorInfo& inputInfo, const TFSInputTensorType& proto) const {
-    if (proto.dtype() != getPrecisionAsDataType(inputInfo.getPrecision())) {
+    if (proto.dtype() != getPrecisionAsDataType(inputInfo.getPrecision()) && !inputInfo.isPrecisionAccepted(getRequestPrecision(proto))) {
         std::stringstream ss;
         ss << "Expected: " << inputInfo.getPrecisionAsString()
            << "; Actual: " << getDataTypeAsString(proto.dtype())
@@ -872,7 +899,7 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 }
 template <>
 Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validatePrecision(const ovms::TensorInfo& inputInfo, const KFSTensorInputProto& proto) const {
-    if (proto.datatype() != ovmsPrecisionToKFSPrecision(inputInfo.getPrecision())) {
+    if (proto.datatype() != ovmsPrecisionToKFSPrecision(inputInfo.getPrecision()) && !inputInfo.isPrecisionAccepted(getRequestPrecision(proto))) {
         std::stringstream ss;
         ss << "Expected: " << inputInfo.getPrecisionAsString()
            << "; Actual: " << proto.datatype()
@@ -885,7 +912,7 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
 }
 template <>
 Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validatePrecision(const ovms::TensorInfo& inputInfo, const InferenceTensor& tensor) const {
-    if (tensor.getDataType() != getPrecisionAsOVMSDataType(inputInfo.getPrecision())) {
+    if (tensor.getDataType() != getPrecisionAsOVMSDataType(inputInfo.getPrecision()) && !inputInfo.isPrecisionAccepted(getRequestPrecision(tensor))) {
         std::stringstream ss;
         ss << "Expected: " << inputInfo.getPrecisionAsString()
            << "; Actual: " << tensor.getDataType()
@@ -923,6 +950,18 @@ static bool dataInRawInputContents(const KFSRequest& request) {
     return request.raw_input_contents().size() > 0;
 }
 
+static bool dataInSharedMemory(const ovms::InferenceTensor& tensor) {
+    return false;
+}
+
+static bool dataInSharedMemory(const TFSInputTensorType& proto) {
+    return false;
+}
+
+static bool dataInSharedMemory(const KFSTensorInputProto& proto) {
+    return usesSharedMemory(proto.parameters());
+}
+
 static const std::string* getRawInputContents(const ovms::InferenceRequest& request, size_t bufferId) {
     SPDLOG_DEBUG("Raw input contents is not supported for C-API");
     throw std::runtime_error("Raw input contents used in C-API flow.");
@@ -971,7 +1010,8 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
 
         Mode shapeMode = getShapeMode(shapeInfo, name);
 
-        if (requiresPreProcessing(proto)) {
+        // shared memory is used by inference as it is, without preprocessing
+        if (requiresPreProcessing(proto) && !dataInSharedMemory(proto)) {
             const auto processingHint = inputInfo->getPreProcessingHint();
             int32_t inputBatchSize = 0;
             size_t inputWidth = 0;
@@ -1013,7 +1053,9 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
         RETURN_IF_ERR(validateNumberOfShapeDimensions(*inputInfo, proto));
         RETURN_IF_ERR(checkBatchSizeMismatch(proto, inputInfo->getBatchSize(), batchIndex, finalStatus, batchingMode, shapeMode));
         RETURN_IF_ERR(checkShapeMismatch(proto, *inputInfo, batchIndex, finalStatus, batchingMode, shapeMode));
-        RETURN_IF_ERR(validateTensorContent(proto, inputInfo->getPrecision(), bufferId));
+        // request data in accepted precision is converted during deserialization
+        const Precision requestPrecision = getRequestPrecision(proto);
+        RETURN_IF_ERR(validateTensorContent(proto, inputInfo->getAcceptedPrecisions().count(requestPrecision) ? requestPrecision : inputInfo->getPrecision(), bufferId));
     }
     return finalStatus;
 }
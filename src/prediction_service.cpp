@@ -16,6 +16,7 @@
 #include "prediction_service.hpp"
 
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -41,6 +42,7 @@
 #include "server.hpp"
 #include "status.hpp"
 #include "timer.hpp"
+#include "worker_pool.hpp"
 
 using grpc::ServerContext;
 
@@ -72,8 +74,12 @@ PredictionServiceImpl::PredictionServiceImpl(ovms::Server& ovmsServer) :
 
 Status PredictionServiceImpl::getModelInstance(const PredictRequest* request,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+    bool waitIfLoading) {
     OVMS_PROFILE_FUNCTION();
+    if (!waitIfLoading) {
+        return this->modelManager.getModelInstance(request->model_spec().name(), request->model_spec().version().value(), modelInstance, modelInstanceUnloadGuardPtr, 0);
+    }
     return this->modelManager.getModelInstance(request->model_spec().name(), request->model_spec().version().value(), modelInstance, modelInstanceUnloadGuardPtr);
 }
 
@@ -142,6 +148,82 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     return grpc::Status::OK;
 }
 
+void PredictionServiceImpl::PredictAsync(
+    ServerContext* context,
+    const PredictRequest* request,
+    PredictResponse* response,
+    std::function<void(grpc::Status)> onComplete,
+    WorkerPool& blockingCallsPool) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    timer.start(TOTAL);
+    SPDLOG_DEBUG("Processing async gRPC request for model: {}; version: {}",
+        request->model_spec().name(),
+        request->model_spec().version().value());
+    const std::string servableName = request->model_spec().name();
+    try {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+        // completion queue thread does not wait for model version which is still loading
+        auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard, false);
+        if (status == StatusCode::MODEL_NAME_MISSING ||
+            status == StatusCode::MODEL_VERSION_NOT_LOADED_YET ||
+            (status.ok() && modelInstance->mayBlockAsyncInference())) {
+            // pipelines, waiting for model version to load, stateful models and reloads would block completion queue thread
+            modelInstanceUnloadGuard.reset();
+            blockingCallsPool.submit([this, context, request, response, onComplete, servableName]() {
+                grpc::Status grpcStatus;
+                try {
+                    grpcStatus = Predict(context, request, response);
+                } catch (const std::exception& e) {
+                    SPDLOG_ERROR("Caught exception in PredictionServiceImpl for servable: {} exception: {}", servableName, e.what());
+                    grpcStatus = grpc(Status(StatusCode::UNKNOWN_ERROR, e.what()));
+                } catch (...) {
+                    SPDLOG_ERROR("Caught unknown exception in PredictionServiceImpl for servable: {}", servableName);
+                    grpcStatus = grpc(Status(StatusCode::UNKNOWN_ERROR));
+                }
+                onComplete(grpcStatus);
+            });
+            return;
+        }
+        if (!status.ok()) {
+            if (modelInstance) {
+                INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailGrpcPredict);
+            }
+            SPDLOG_DEBUG("Getting modelInstance failed. {}", status.string());
+            onComplete(grpc(status));
+            return;
+        }
+
+        ExecutionContext executionContext{
+            ExecutionContext::Interface::GRPC,
+            ExecutionContext::Method::Predict};
+        status = modelInstance->inferAsync(request, response, modelInstanceUnloadGuard,
+            [modelInstance, executionContext, timer, onComplete](Status status) mutable {
+                INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
+                if (!status.ok()) {
+                    onComplete(grpc(status));
+                    return;
+                }
+                timer.stop(TOTAL);
+                double requestTotal = timer.elapsed<std::chrono::microseconds>(TOTAL);
+                OBSERVE_IF_ENABLED(modelInstance->getMetricReporter().requestTimeGrpc, requestTotal);
+                SPDLOG_DEBUG("Total gRPC request processing time: {} ms", requestTotal / 1000);
+                onComplete(grpc::Status::OK);
+            });
+        if (!status.ok()) {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, false));
+            onComplete(grpc(status));
+        }
+    } catch (const std::exception& e) {
+        SPDLOG_ERROR("Caught exception in PredictionServiceImpl for servable: {} exception: {}", servableName, e.what());
+        onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR, e.what())));
+    } catch (...) {
+        SPDLOG_ERROR("Caught unknown exception in PredictionServiceImpl for servable: {}", servableName);
+        onComplete(grpc(Status(StatusCode::UNKNOWN_ERROR)));
+    }
+}
+
 grpc::Status PredictionServiceImpl::GetModelMetadata(
     grpc::ServerContext* context,
     const tensorflow::serving::GetModelMetadataRequest* request,
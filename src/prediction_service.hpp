@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <grpcpp/server_context.h>
@@ -33,6 +34,7 @@ class ModelManager;
 class Pipeline;
 class Server;
 class Status;
+class WorkerPool;
 
 class PredictionServiceImpl final : public tensorflow::serving::PredictionService::Service {
     ovms::Server& ovmsServer;
@@ -46,6 +48,19 @@ public:
         const tensorflow::serving::PredictRequest* request,
         tensorflow::serving::PredictResponse* response) override;
 
+    /**
+     * @brief Starts Predict call processing without waiting for inference to complete
+     *
+     * onComplete is invoked exactly once, possibly from inference completion callback thread.
+     * Pipelines block until executed, so they are run on blockingCallsPool instead of calling thread.
+     */
+    void PredictAsync(
+        grpc::ServerContext* context,
+        const tensorflow::serving::PredictRequest* request,
+        tensorflow::serving::PredictResponse* response,
+        std::function<void(grpc::Status)> onComplete,
+        WorkerPool& blockingCallsPool);
+
     grpc::Status GetModelMetadata(
         grpc::ServerContext* context,
         const tensorflow::serving::GetModelMetadataRequest* request,
@@ -56,7 +71,8 @@ public:
 protected:
     Status getModelInstance(const tensorflow::serving::PredictRequest* request,
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
-        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr);
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr,
+        bool waitIfLoading = true);
     Status getPipeline(const tensorflow::serving::PredictRequest* request,
         tensorflow::serving::PredictResponse* response,
         std::unique_ptr<ovms::Pipeline>& pipelinePtr);
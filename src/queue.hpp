@@ -16,91 +16,213 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <future>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <queue>
-#include <thread>
-#include <utility>
 #include <vector>
 
 // #include "profiler.hpp"
 
 namespace ovms {
 
+/**
+* @brief Entry of the line waiting for idle stream in Queue. It is owned by the waiting party, e.g. placed
+* on the stack of blocked thread, and linked into the line directly so waiting does not allocate.
+*/
+class IdleStreamWaiter {
+public:
+    /**
+    * @brief Resumable waiter additionally gets resumed after internal lock of the queue is released,
+    * so it has to keep itself alive until then
+    */
+    explicit IdleStreamWaiter(bool resumable = false) :
+        resumable(resumable) {}
+    IdleStreamWaiter(const IdleStreamWaiter&) = delete;
+    IdleStreamWaiter& operator=(const IdleStreamWaiter&) = delete;
+    virtual ~IdleStreamWaiter() = default;
+
+    /**
+    * @brief Called from the thread returning the stream, with internal lock of the queue held,
+    * so it should only store the stream and pass the notification further
+    */
+    virtual void onStreamAssigned(int streamId) = 0;
+
+    /**
+    * @brief Called for resumable waiter from the thread returning the stream, after onStreamAssigned
+    * and without any lock held, so it can continue processing with assigned stream
+    */
+    virtual void resume() {}
+
+private:
+    template <typename T>
+    friend class Queue;
+
+    /**
+    * @brief Resumed waiter may return stream right away and resume next one, such waiters are resumed
+    * in a loop of the outermost call instead of recursively to keep stack depth bounded
+    */
+    static void resumeInOrder(IdleStreamWaiter& waiter) {
+        thread_local IdleStreamWaiter* firstPending = nullptr;
+        thread_local IdleStreamWaiter* lastPending = nullptr;
+        thread_local bool resuming = false;
+        waiter.next = nullptr;
+        if (lastPending != nullptr) {
+            lastPending->next = &waiter;
+        } else {
+            firstPending = &waiter;
+        }
+        lastPending = &waiter;
+        if (resuming) {
+            return;
+        }
+        resuming = true;
+        while (firstPending != nullptr) {
+            IdleStreamWaiter* resumed = firstPending;
+            firstPending = resumed->next;
+            if (firstPending == nullptr) {
+                lastPending = nullptr;
+            }
+            resumed->next = nullptr;
+            resumed->resume();
+        }
+        resuming = false;
+    }
+
+    const bool resumable;
+    IdleStreamWaiter* previous = nullptr;
+    IdleStreamWaiter* next = nullptr;
+    bool queued = false;
+};
+
 template <typename T>
 class Queue {
 public:
     /**
-    * @brief Allocating idle stream for execution
+    * @brief Allocating idle stream for execution, blocks until any stream is available
+    */
+    int getIdleStream() {
+        // OVMS_PROFILE_FUNCTION();
+        auto streamId = tryToGetIdleStream();
+        if (streamId.has_value()) {
+            return streamId.value();
+        }
+        BlockedThread waiter;
+        std::unique_lock<std::mutex> lk(waitMutex);
+        streamId = takeOrEnqueue(waiter);
+        if (streamId.has_value()) {
+            return streamId.value();
+        }
+        waiter.streamAssigned.wait(lk, [&waiter] { return waiter.assignedStreamId.has_value(); });
+        return waiter.assignedStreamId.value();
+    }
+
+    /**
+    * @brief Allocating idle stream for execution, waits up to timeout for any stream to be available
     */
-    std::future<int> getIdleStream() {
+    std::optional<int> tryToGetIdleStream(std::chrono::microseconds timeout) {
         // OVMS_PROFILE_FUNCTION();
-        int value;
-        std::promise<int> idleStreamPromise;
-        std::future<int> idleStreamFuture = idleStreamPromise.get_future();
-        std::unique_lock<std::mutex> lk(front_mut);
-        if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
-            std::unique_lock<std::mutex> queueLock(queue_mutex);
-            promises.push(std::move(idleStreamPromise));
-        } else {  // we can give idle stream right away
-            value = streams[front_idx];
-            streams[front_idx] = -1;  // negative value indicate consumed vector index
-            front_idx = (front_idx + 1) % streams.size();
-            lk.unlock();
-            idleStreamPromise.set_value(value);
-        }
-        return idleStreamFuture;
+        auto streamId = tryToGetIdleStream();
+        if (streamId.has_value() || timeout.count() <= 0) {
+            return streamId;
+        }
+        BlockedThread waiter;
+        std::unique_lock<std::mutex> lk(waitMutex);
+        streamId = takeOrEnqueue(waiter);
+        if (streamId.has_value()) {
+            return streamId;
+        }
+        if (!waiter.streamAssigned.wait_for(lk, timeout, [&waiter] { return waiter.assignedStreamId.has_value(); })) {
+            removeWaiter(waiter);
+        }
+        return waiter.assignedStreamId;
     }
 
+    /**
+    * @brief Allocating idle stream for execution without waiting. Fails if there are threads or waiters
+    * already waiting for stream, since returned streams are assigned to them first.
+    */
     std::optional<int> tryToGetIdleStream() {
         // OVMS_PROFILE_FUNCTION();
-        int value;
-        std::unique_lock<std::mutex> lk(front_mut);
-        if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
+        // sequentially consistent load pairs with the one in returnStream
+        if (waitingCount.load(std::memory_order_seq_cst) > 0) {
             return std::nullopt;
-        } else {  // we can give idle stream right away
-            value = streams[front_idx];
-            streams[front_idx] = -1;  // negative value indicate consumed vector index
-            front_idx = (front_idx + 1) % streams.size();
-            lk.unlock();
-            return value;
         }
+        return popIdleStream();
     }
 
     /**
-    * @brief Release stream after execution
+    * @brief Allocating idle stream for execution without waiting. If there is no idle stream, waiter is linked
+    * at the end of the line and gets stream assigned when any is returned, in order of registration together
+    * with blocked threads. Waiter has to stay alive until it gets stream assigned or is removed.
+    * Resumable waiter is resumed only when stream is assigned later, not when it is returned right away.
+    */
+    std::optional<int> tryToGetIdleStream(IdleStreamWaiter& waiter) {
+        // OVMS_PROFILE_FUNCTION();
+        auto streamId = tryToGetIdleStream();
+        if (streamId.has_value()) {
+            return streamId;
+        }
+        std::lock_guard<std::mutex> lk(waitMutex);
+        return takeOrEnqueue(waiter);
+    }
+
+    /**
+    * @brief Unlink waiter which did not get stream assigned yet. After return waiter is guaranteed not to be called.
+    */
+    void removeIdleStreamWaiter(IdleStreamWaiter& waiter) {
+        std::lock_guard<std::mutex> lk(waitMutex);
+        removeWaiter(waiter);
+    }
+
+    /**
+    * @brief Release stream after execution. If any thread or waiter is waiting, stream is assigned to the one waiting longest.
     */
     void returnStream(int streamID) {
         // OVMS_PROFILE_FUNCTION();
-        std::unique_lock<std::mutex> lk(queue_mutex);
-        if (promises.size()) {
-            std::promise<int> promise = std::move(promises.front());
-            promises.pop();
-            lk.unlock();
-            promise.set_value(streamID);
+        std::uint64_t oldHead = head.load(std::memory_order_relaxed);
+        do {
+            nextIdle[streamID].store(headIndex(oldHead), std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(oldHead, makeHead(streamID, headTag(oldHead) + 1),
+            std::memory_order_seq_cst, std::memory_order_relaxed));
+        if (waitingCount.load(std::memory_order_seq_cst) == 0) {
             return;
         }
-        std::uint32_t old_back = back_idx.load();
-        while (!back_idx.compare_exchange_weak(
-            old_back,
-            (old_back + 1) % streams.size(),
-            std::memory_order_relaxed)) {
+        IdleStreamWaiter* resumedWaiter = nullptr;
+        {
+            // taking the mutex ensures waiter is either before its last check or already registered
+            std::lock_guard<std::mutex> lk(waitMutex);
+            if (firstWaiter == nullptr) {
+                return;
+            }
+            // stream could have been taken by other thread in the meantime, it will be assigned when that thread returns it
+            auto streamId = popIdleStream();
+            if (!streamId.has_value()) {
+                return;
+            }
+            IdleStreamWaiter& waiter = *firstWaiter;
+            removeWaiter(waiter);
+            // waiter which is not resumable may be gone as soon as the lock is released
+            if (waiter.resumable) {
+                resumedWaiter = &waiter;
+            }
+            waiter.onStreamAssigned(streamId.value());
+        }
+        if (resumedWaiter != nullptr) {
+            IdleStreamWaiter::resumeInOrder(*resumedWaiter);
         }
-        streams[old_back] = streamID;
     }
 
     /**
     * @brief Constructor with initialization
     */
     Queue(int streamsLength) :
-        streams(streamsLength),
-        front_idx{0},
-        back_idx{0} {
+        nextIdle(std::make_unique<std::atomic<int>[]>(streamsLength)),
+        head(makeHead(streamsLength > 0 ? 0 : EMPTY, 0)) {
         for (int i = 0; i < streamsLength; ++i) {
-            streams[i] = i;
+            nextIdle[i].store(i + 1 < streamsLength ? i + 1 : EMPTY, std::memory_order_relaxed);
         }
     }
 
@@ -112,30 +234,119 @@ public:
     }
 
 protected:
+    static constexpr int EMPTY = -1;
+
+    std::optional<int> popIdleStream() {
+        std::uint64_t oldHead = head.load(std::memory_order_seq_cst);
+        while (true) {
+            const int streamId = headIndex(oldHead);
+            if (streamId == EMPTY) {
+                return std::nullopt;
+            }
+            // next link may be stale if other thread took the stream in the meantime,
+            // in such case tag of the head changed and compare_exchange fails
+            const int next = nextIdle[streamId].load(std::memory_order_relaxed);
+            if (head.compare_exchange_weak(oldHead, makeHead(next, headTag(oldHead) + 1),
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return streamId;
+            }
+        }
+    }
+
     /**
-    * @brief Vector representing circular buffer for infer queue
+    * @brief Blocked thread waiting for stream assignment, placed on its own stack
     */
-    std::vector<int> streams;
+    struct BlockedThread final : IdleStreamWaiter {
+        void onStreamAssigned(int streamId) override {
+            assignedStreamId = streamId;
+            streamAssigned.notify_one();
+        }
+        std::optional<int> assignedStreamId;
+        std::condition_variable streamAssigned;
+    };
 
     /**
-    * @brief Index of the front of the idle streams list
+    * @brief Takes idle stream if nobody waits already, otherwise links waiter at the end of the line. Requires waitMutex.
     */
-    std::uint32_t front_idx;
+    std::optional<int> takeOrEnqueue(IdleStreamWaiter& waiter) {
+        waitingCount.fetch_add(1, std::memory_order_seq_cst);
+        if (firstWaiter == nullptr) {
+            auto streamId = popIdleStream();
+            if (streamId.has_value()) {
+                waitingCount.fetch_sub(1, std::memory_order_seq_cst);
+                return streamId;
+            }
+        }
+        waiter.previous = lastWaiter;
+        waiter.next = nullptr;
+        if (lastWaiter != nullptr) {
+            lastWaiter->next = &waiter;
+        } else {
+            firstWaiter = &waiter;
+        }
+        lastWaiter = &waiter;
+        waiter.queued = true;
+        return std::nullopt;
+    }
 
     /**
-    * @brief Index of the back of the idle streams list
+    * @brief Unlinks waiter which did not get stream assigned yet. Requires waitMutex.
     */
-    std::atomic<std::uint32_t> back_idx;
+    void removeWaiter(IdleStreamWaiter& waiter) {
+        if (!waiter.queued) {
+            return;
+        }
+        if (waiter.previous != nullptr) {
+            waiter.previous->next = waiter.next;
+        } else {
+            firstWaiter = waiter.next;
+        }
+        if (waiter.next != nullptr) {
+            waiter.next->previous = waiter.previous;
+        } else {
+            lastWaiter = waiter.previous;
+        }
+        waiter.previous = nullptr;
+        waiter.next = nullptr;
+        waiter.queued = false;
+        waitingCount.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    static std::uint64_t makeHead(int streamId, std::uint32_t tag) {
+        return (static_cast<std::uint64_t>(tag) << 32) | static_cast<std::uint32_t>(streamId);
+    }
+    static int headIndex(std::uint64_t head) {
+        return static_cast<int>(static_cast<std::uint32_t>(head));
+    }
+    static std::uint32_t headTag(std::uint64_t head) {
+        return static_cast<std::uint32_t>(head >> 32);
+    }
 
     /**
-    * @brief Vector representing OV streams and used for notification about completed inference operations
+    * @brief Links of the idle streams list, valid only for streams that are idle
     */
-    std::mutex front_mut;
-    std::mutex queue_mutex;
+    std::unique_ptr<std::atomic<int>[]> nextIdle;
+
+    /**
+    * @brief Top of the idle streams list together with modification tag preventing ABA problem
+    */
+    std::atomic<std::uint64_t> head;
+
+    /**
+    * @brief Number of registered waiters, lets returning threads and new callers skip the lock when nobody waits
+    */
+    std::atomic<std::uint32_t> waitingCount{0};
+    std::mutex waitMutex;
+
+    /**
+    * @brief Ends of the intrusive line of blocked threads and waiters in FIFO order, guarded by waitMutex
+    */
+    IdleStreamWaiter* firstWaiter = nullptr;
+    IdleStreamWaiter* lastWaiter = nullptr;
+
     /**
-     * 
+     *
      */
     std::vector<T> inferRequests;
-    std::queue<std::promise<int>> promises;
 };
 }  // namespace ovms
@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "queue.hpp"
+
+namespace {
+
+// Previous idle stream queue implementation handing out streams through std::promise/std::future,
+// kept only as a reference point for comparison
+class PromiseQueue {
+public:
+    PromiseQueue(int streamsLength) :
+        streams(streamsLength),
+        front_idx{0},
+        back_idx{0} {
+        for (int i = 0; i < streamsLength; ++i) {
+            streams[i] = i;
+        }
+    }
+
+    std::future<int> getIdleStream() {
+        int value;
+        std::promise<int> idleStreamPromise;
+        std::future<int> idleStreamFuture = idleStreamPromise.get_future();
+        std::unique_lock<std::mutex> lk(front_mut);
+        if (streams[front_idx] < 0) {
+            std::unique_lock<std::mutex> queueLock(queue_mutex);
+            promises.push(std::move(idleStreamPromise));
+        } else {
+            value = streams[front_idx];
+            streams[front_idx] = -1;
+            front_idx = (front_idx + 1) % streams.size();
+            lk.unlock();
+            idleStreamPromise.set_value(value);
+        }
+        return idleStreamFuture;
+    }
+
+    void returnStream(int streamID) {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        if (promises.size()) {
+            std::promise<int> promise = std::move(promises.front());
+            promises.pop();
+            lk.unlock();
+            promise.set_value(streamID);
+            return;
+        }
+        std::uint32_t old_back = back_idx.load();
+        while (!back_idx.compare_exchange_weak(
+            old_back,
+            (old_back + 1) % streams.size(),
+            std::memory_order_relaxed)) {
+        }
+        streams[old_back] = streamID;
+    }
+
+private:
+    std::vector<int> streams;
+    std::uint32_t front_idx;
+    std::atomic<std::uint32_t> back_idx;
+    std::mutex front_mut;
+    std::mutex queue_mutex;
+    std::queue<std::promise<int>> promises;
+};
+
+template <typename GetStream, typename ReturnStream>
+double measureThroughput(uint32_t threadsCount, uint32_t iterations, GetStream getStream, ReturnStream returnStream) {
+    std::vector<std::thread> threads;
+    std::promise<void> startSignal;
+    std::shared_future<void> started = startSignal.get_future().share();
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&, started]() {
+            started.wait();
+            for (uint32_t j = 0; j < iterations; ++j) {
+                returnStream(getStream());
+            }
+        });
+    }
+    auto begin = std::chrono::high_resolution_clock::now();
+    startSignal.set_value();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1'000'000.0;
+    return (threadsCount * iterations) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "Idle stream queue benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("nireq",
+            "number of streams in the queue",
+            cxxopts::value<uint32_t>()->default_value("4"),
+            "NIREQ")
+        ("threads",
+            "number of threads competing for streams",
+            cxxopts::value<uint32_t>()->default_value("16"),
+            "THREADS")
+        ("niter",
+            "number of get/return cycles per thread",
+            cxxopts::value<uint32_t>()->default_value("100000"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t nireq = result->operator[]("nireq").as<uint32_t>();
+    const uint32_t threadsCount = result->operator[]("threads").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (nireq == 0) {
+        std::cerr << "nireq has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    PromiseQueue promiseQueue(nireq);
+    double promiseQueueThroughput = measureThroughput(threadsCount, niter,
+        [&promiseQueue]() { return promiseQueue.getIdleStream().get(); },
+        [&promiseQueue](int streamId) { promiseQueue.returnStream(streamId); });
+
+    ovms::Queue<int> queue(nireq);
+    double queueThroughput = measureThroughput(threadsCount, niter,
+        [&queue]() { return queue.getIdleStream(); },
+        [&queue](int streamId) { queue.returnStream(streamId); });
+
+    std::cout << "nireq: " << nireq << " threads: " << threadsCount << " iterations per thread: " << niter << std::endl;
+    std::cout << "Promise based queue: " << promiseQueueThroughput << " get/return cycles per second" << std::endl;
+    std::cout << "Lock-free queue: " << queueThroughput << " get/return cycles per second" << std::endl;
+    return EX_OK;
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+
+#include <google/protobuf/arena.h>
+
+namespace ovms {
+
+/**
+ * @brief Protobuf arena owning request and response messages of a single call
+ *
+ * Messages and all their nested messages, repeated fields and strings headers are allocated
+ * from arena blocks and released at once when the arena is destroyed. The first block is part
+ * of the object itself, so messages of small requests do not allocate memory at all.
+ */
+class RequestArena {
+public:
+    static const size_t INITIAL_BLOCK_SIZE = 4096;
+
+private:
+    alignas(alignof(std::max_align_t)) char initialBlock[INITIAL_BLOCK_SIZE];
+    google::protobuf::Arena arena;
+
+    static google::protobuf::ArenaOptions createOptions(char* initialBlock) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = initialBlock;
+        options.initial_block_size = INITIAL_BLOCK_SIZE;
+        options.start_block_size = INITIAL_BLOCK_SIZE;
+        return options;
+    }
+
+public:
+    RequestArena() :
+        arena(createOptions(initialBlock)) {}
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    template <typename MessageType>
+    MessageType* create() {
+        return google::protobuf::Arena::CreateMessage<MessageType>(&this->arena);
+    }
+
+    google::protobuf::Arena* get() {
+        return &this->arena;
+    }
+};
+}  // namespace ovms
@@ -15,9 +15,26 @@
 //*****************************************************************************
 #include "rest_parser.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include "capi_frontend/buffer.hpp"
+#include "capi_frontend/capi_utils.hpp"
+#include "capi_frontend/inferencerequest.hpp"
+#include "kfs_frontend/kfs_utils.hpp"
 #include "precision.hpp"
 #include "rest_utils.hpp"
 #include "status.hpp"
@@ -66,6 +83,20 @@ void TFSRestParser::removeUnusedInputs() {
     }
 }
 
+void TFSRestParser::resetInputs() {
+    auto& inputs = (*requestProto.mutable_inputs());
+    for (const auto& [name, precision] : tensorPrecisionMap) {
+        auto& input = inputs[name];
+        input.clear_tensor_shape();
+        input.mutable_tensor_content()->clear();
+        input.clear_half_val();
+        input.clear_int_val();
+        input.set_dtype(getPrecisionAsDataType(precision));
+    }
+    order = Order::UNKNOWN;
+    format = Format::UNKNOWN;
+}
+
 bool TFSRestParser::parseSequenceIdInput(rapidjson::Value& doc, tensorflow::TensorProto& proto, const std::string& tensorName) {
     proto.set_dtype(tensorflow::DataType::DT_UINT64);
     for (auto& value : doc.GetArray()) {
@@ -278,7 +309,399 @@ Status TFSRestParser::parseColumnFormat(rapidjson::Value& node) {
     return StatusCode::OK;
 }
 
+class TFSRestParser::StreamingHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, TFSRestParser::StreamingHandler> {
+    // Containers entered by reader
+    enum class Frame {
+        Root,
+        Skipped,
+        NamedInputs,
+        Instances,
+        Instance,
+        Tensor
+    };
+
+    // Meaning of the next value in request
+    enum class Role {
+        Document,
+        Skipped,
+        Inputs,
+        Instances,
+        FirstInstance,
+        Instance,
+        TensorRoot,
+        TensorElement
+    };
+
+    struct Context {
+        Frame frame;
+        int level = 0;
+        size_t count = 0;
+        bool containsArrays = false;
+    };
+
+    // Dimension which size is known only after its first array ends
+    static constexpr int64_t UNSET_DIM = -1;
+
+    TFSRestParser& parser;
+    std::vector<Context> stack;
+    Role afterKey = Role::Document;
+    std::vector<std::string> objectKeys;
+    bool rowOrder = false;
+    bool columnOrder = false;
+    bool named = false;
+
+    tensorflow::TensorProto* proto = nullptr;
+    std::string* content = nullptr;
+    size_t written = 0;
+    int baseDim = 0;
+    int leafLevel = -1;
+
+    Role nextValueRole() const {
+        if (stack.empty()) {
+            return Role::Document;
+        }
+        const Context& top = stack.back();
+        switch (top.frame) {
+        case Frame::Skipped:
+            return Role::Skipped;
+        case Frame::Instances:
+            return top.count == 0 ? Role::FirstInstance : Role::Instance;
+        case Frame::Tensor:
+            return Role::TensorElement;
+        default:
+            return afterKey;
+        }
+    }
+
+    bool selectTensor(const std::string& tensorName, int dim) {
+        if (std::find(objectKeys.begin(), objectKeys.end(), tensorName) != objectKeys.end()) {
+            return false;
+        }
+        objectKeys.push_back(tensorName);
+        if (tensorName == "sequence_id" || tensorName == "sequence_control_input" || !parser.tensorPrecisionMap.count(tensorName)) {
+            return false;
+        }
+        proto = &(*parser.requestProto.mutable_inputs())[tensorName];
+        if (dim == 1) {
+            increaseBatchSize(*proto);
+        }
+        baseDim = dim;
+        afterKey = Role::TensorRoot;
+        return true;
+    }
+
+    bool selectNoNamedTensor() {
+        if (parser.requestProto.inputs_size() != 1) {
+            return false;
+        }
+        auto inputsIterator = parser.requestProto.mutable_inputs()->begin();
+        if (inputsIterator->first == "sequence_id" || inputsIterator->first == "sequence_control_input") {
+            return false;
+        }
+        proto = &inputsIterator->second;
+        baseDim = 0;
+        return true;
+    }
+
+    bool beginTensor() {
+        switch (proto->dtype()) {
+        case tensorflow::DataType::DT_FLOAT:
+        case tensorflow::DataType::DT_INT32:
+        case tensorflow::DataType::DT_INT8:
+        case tensorflow::DataType::DT_UINT8:
+        case tensorflow::DataType::DT_DOUBLE:
+        case tensorflow::DataType::DT_HALF:
+        case tensorflow::DataType::DT_INT16:
+        case tensorflow::DataType::DT_UINT16:
+        case tensorflow::DataType::DT_INT64:
+        case tensorflow::DataType::DT_UINT32:
+        case tensorflow::DataType::DT_UINT64:
+            break;
+        default:
+            return false;
+        }
+        // Values are written into memory reserved in constructor, content is truncated to written size when tensor ends
+        content = proto->mutable_tensor_content();
+        written = content->size();
+        content->resize(std::max(content->capacity(), written));
+        leafLevel = -1;
+        return openArray(0);
+    }
+
+    // Instances array turns out to be outermost array of no named tensor
+    bool beginNoNamedInstances() {
+        stack.pop_back();
+        return selectNoNamedTensor() && beginTensor();
+    }
+
+    bool openArray(int level) {
+        int dim = baseDim + level;
+        auto* shape = proto->mutable_tensor_shape();
+        if (shape->dim_size() == dim) {
+            shape->add_dim()->set_size(UNSET_DIM);
+        } else if (shape->dim_size() < dim) {
+            return false;
+        }
+        stack.push_back({Frame::Tensor, level});
+        return true;
+    }
+
+    bool openNestedArray() {
+        Context& top = stack.back();
+        if (top.count++ == 0) {
+            top.containsArrays = true;
+        } else if (!top.containsArrays) {
+            return false;
+        }
+        if (leafLevel != -1 && top.level + 1 > leafLevel) {
+            return false;
+        }
+        return openArray(top.level + 1);
+    }
+
+    bool closeArray(rapidjson::SizeType count) {
+        int level = stack.back().level;
+        stack.pop_back();
+        if (count == 0) {
+            return false;
+        }
+        auto* dim = proto->mutable_tensor_shape()->mutable_dim(baseDim + level);
+        if (dim->size() == UNSET_DIM) {
+            dim->set_size(count);
+        } else if (dim->size() != static_cast<int64_t>(count)) {
+            return false;
+        }
+        if (level == 0) {
+            content->resize(written);
+        }
+        return true;
+    }
+
+    template <typename T>
+    void append(T value) {
+        if (written + sizeof(T) > content->size()) {
+            content->resize(std::max(2 * content->size(), written + sizeof(T)));
+        }
+        std::memcpy(content->data() + written, &value, sizeof(T));
+        written += sizeof(T);
+    }
+
+    template <typename T>
+    void write(T value) {
+        switch (proto->dtype()) {
+        case tensorflow::DataType::DT_FLOAT:
+            return append<float>(static_cast<float>(value));
+        case tensorflow::DataType::DT_INT32:
+            return append<int32_t>(static_cast<int32_t>(value));
+        case tensorflow::DataType::DT_INT8:
+            return append<int8_t>(static_cast<int8_t>(value));
+        case tensorflow::DataType::DT_UINT8:
+            return append<uint8_t>(static_cast<uint8_t>(value));
+        case tensorflow::DataType::DT_DOUBLE:
+            return append<double>(static_cast<double>(value));
+        case tensorflow::DataType::DT_HALF:
+            return proto->add_half_val(static_cast<int32_t>(value));
+        case tensorflow::DataType::DT_INT16:
+            return append<int16_t>(static_cast<int16_t>(value));
+        case tensorflow::DataType::DT_UINT16:
+            return proto->add_int_val(static_cast<int32_t>(value));
+        case tensorflow::DataType::DT_INT64:
+            return append<int64_t>(static_cast<int64_t>(value));
+        case tensorflow::DataType::DT_UINT32:
+            return append<uint32_t>(static_cast<uint32_t>(value));
+        case tensorflow::DataType::DT_UINT64:
+            return append<uint64_t>(static_cast<uint64_t>(value));
+        default:
+            return;
+        }
+    }
+
+    template <typename T>
+    bool number(T value) {
+        switch (nextValueRole()) {
+        case Role::Skipped:
+            return true;
+        case Role::FirstInstance:
+            if (!beginNoNamedInstances()) {
+                return false;
+            }
+            break;
+        case Role::TensorElement:
+            break;
+        default:
+            return false;
+        }
+        Context& top = stack.back();
+        if (top.count++ == 0) {
+            top.containsArrays = false;
+        } else if (top.containsArrays) {
+            return false;
+        }
+        if (leafLevel == -1) {
+            leafLevel = top.level;
+        } else if (leafLevel != top.level) {
+            return false;
+        }
+        write(value);
+        return true;
+    }
+
+    bool skippedOnly() const {
+        return nextValueRole() == Role::Skipped;
+    }
+
+public:
+    StreamingHandler(TFSRestParser& parser) :
+        parser(parser) {}
+
+    bool Null() { return skippedOnly(); }
+    bool Bool(bool) { return skippedOnly(); }
+    bool Int(int value) { return number(value); }
+    bool Uint(unsigned value) { return number(value); }
+    bool Int64(int64_t value) { return number(value); }
+    bool Uint64(uint64_t value) { return number(value); }
+    bool Double(double value) { return number(value); }
+    bool String(const char*, rapidjson::SizeType, bool) { return skippedOnly(); }
+
+    bool StartObject() {
+        switch (nextValueRole()) {
+        case Role::Document:
+            stack.push_back({Frame::Root});
+            return true;
+        case Role::Skipped:
+            stack.push_back({Frame::Skipped});
+            return true;
+        case Role::Inputs:
+            named = true;
+            objectKeys.clear();
+            stack.push_back({Frame::NamedInputs});
+            return true;
+        case Role::FirstInstance:
+            named = true;
+            [[fallthrough]];
+        case Role::Instance:
+            stack.back().count++;
+            objectKeys.clear();
+            stack.push_back({Frame::Instance});
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        std::string key(str, length);
+        switch (stack.back().frame) {
+        case Frame::Root:
+            if (key == "instances" || key == "inputs") {
+                if (rowOrder || columnOrder) {
+                    return false;
+                }
+                rowOrder = (key == "instances");
+                columnOrder = !rowOrder;
+                afterKey = rowOrder ? Role::Instances : Role::Inputs;
+            } else {
+                afterKey = Role::Skipped;
+            }
+            return true;
+        case Frame::Skipped:
+            return true;
+        case Frame::NamedInputs:
+            return selectTensor(key, 0);
+        case Frame::Instance:
+            // object with single b64 member is binary input in no named format
+            if (key == "b64") {
+                return false;
+            }
+            return selectTensor(key, 1);
+        default:
+            return false;
+        }
+    }
+
+    bool EndObject(rapidjson::SizeType count) {
+        Frame frame = stack.back().frame;
+        stack.pop_back();
+        return (frame == Frame::Root || frame == Frame::Skipped || count > 0);
+    }
+
+    bool StartArray() {
+        switch (nextValueRole()) {
+        case Role::Skipped:
+            stack.push_back({Frame::Skipped});
+            return true;
+        case Role::Inputs:
+            return selectNoNamedTensor() && beginTensor();
+        case Role::Instances:
+            stack.push_back({Frame::Instances});
+            return true;
+        case Role::FirstInstance:
+            return beginNoNamedInstances() && openNestedArray();
+        case Role::TensorRoot:
+            return beginTensor();
+        case Role::TensorElement:
+            return openNestedArray();
+        default:
+            return false;
+        }
+    }
+
+    bool EndArray(rapidjson::SizeType count) {
+        switch (stack.back().frame) {
+        case Frame::Skipped:
+            stack.pop_back();
+            return true;
+        case Frame::Instances:
+            stack.pop_back();
+            return count > 0;
+        case Frame::Tensor:
+            return closeArray(count);
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief Applies checks performed by document parser after whole request is read
+     * 
+     * @return false if request has to be parsed with document parser
+     */
+    bool finish() {
+        if (!rowOrder && !columnOrder) {
+            return false;
+        }
+        if (named) {
+            parser.removeUnusedInputs();
+            if (rowOrder && !parser.isBatchSizeEqualForAllInputs()) {
+                return false;
+            }
+        }
+        parser.order = rowOrder ? Order::ROW : Order::COLUMN;
+        parser.format = named ? Format::NAMED : Format::NONAMED;
+        return true;
+    }
+};
+
+bool TFSRestParser::parseStreaming(const char* json, size_t length) {
+    StreamingHandler handler(*this);
+    rapidjson::MemoryStream stream(json, length);
+    rapidjson::Reader reader;
+    if (reader.Parse(stream, handler).IsError() || !handler.finish()) {
+        resetInputs();
+        return false;
+    }
+    return true;
+}
+
 Status TFSRestParser::parse(const char* json) {
+    if (parseStreaming(json, std::strlen(json))) {
+        return StatusCode::OK;
+    }
+    SPDLOG_DEBUG("Request could not be parsed with streaming parser, parsing with document parser");
+    return parseDocument(json);
+}
+
+Status TFSRestParser::parseDocument(const char* json) {
     rapidjson::Document doc;
     if (doc.Parse(json).HasParseError()) {
         return StatusCode::JSON_INVALID;
@@ -319,14 +742,6 @@ bool TFSRestParser::setDimOrValidate(tensorflow::TensorProto& proto, int dim, in
     }
 }
 
-static bool getB64FromValue(const rapidjson::Value& value, std::string& b64Val) {
-    if (!isBinary(value)) {
-        return false;
-    }
-
-    b64Val = value["b64"].GetString();
-    return true;
-}
 
 template <typename T>
 static bool addToTensorContent(tensorflow::TensorProto& proto, T value) {
@@ -410,17 +825,14 @@ static bool addToIntVal(tensorflow::TensorProto& proto, const rapidjson::Value&
 
 bool TFSRestParser::addValue(tensorflow::TensorProto& proto, const rapidjson::Value& value) {
     if (isBinary(value)) {
-        std::string b64Val;
-        if (!getB64FromValue(value, b64Val))
-            return false;
-        std::string decodedBytes;
-        if (decodeBase64(b64Val, decodedBytes) == StatusCode::OK) {
-            proto.add_string_val(decodedBytes.c_str(), decodedBytes.length());
-            proto.set_dtype(tensorflow::DataType::DT_STRING);
-            return true;
-        } else {
+        // decoded straight into the tensor proto, without intermediate copies of encoded and decoded bytes
+        const rapidjson::Value& b64Val = value["b64"];
+        if (decodeBase64(b64Val.GetString(), b64Val.GetStringLength(), *proto.add_string_val()) != StatusCode::OK) {
+            proto.mutable_string_val()->RemoveLast();
             return false;
         }
+        proto.set_dtype(tensorflow::DataType::DT_STRING);
+        return true;
     }
     if (value.IsString() && (proto.dtype() == tensorflow::DataType::DT_UINT8 || proto.dtype() == tensorflow::DataType::DT_STRING)) {
         proto.add_string_val(value.GetString(), strlen(value.GetString()));
@@ -478,6 +890,16 @@ bool TFSRestParser::setDTypeIfNotSet(const rapidjson::Value& value, tensorflow::
     return true;
 }
 
+KFSRestParser::KFSRestParser(google::protobuf::Arena* arena) :
+    requestProto(*google::protobuf::Arena::CreateMessage<::KFSRequest>(arena)) {}
+
+KFSRestParser::~KFSRestParser() {
+    // proto allocated on arena is destroyed with the arena
+    if (requestProto.GetArena() == nullptr) {
+        delete &requestProto;
+    }
+}
+
 Status KFSRestParser::parseId(rapidjson::Value& node) {
     if (!node.IsString()) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
@@ -502,9 +924,9 @@ Status KFSRestParser::parseId(rapidjson::Value& node) {
         } else if (parameter.value.IsBool()) {                                                                \
             auto requestParameters = PROTO.mutable_parameters();                                              \
             ((*requestParameters)[parameter.name.GetString()]).set_bool_param(parameter.value.GetBool());     \
-        } else if (parameter.value.IsInt()) {                                                                 \
+        } else if (parameter.value.IsInt64()) {                                                               \
             auto requestParameters = PROTO.mutable_parameters();                                              \
-            ((*requestParameters)[parameter.name.GetString()]).set_int64_param(parameter.value.GetInt());     \
+            ((*requestParameters)[parameter.name.GetString()]).set_int64_param(parameter.value.GetInt64());   \
         } else {                                                                                              \
             return StatusCode::REST_COULD_NOT_PARSE_PARAMETERS;                                               \
         }                                                                                                     \
@@ -524,7 +946,6 @@ Status KFSRestParser::parseOutput(rapidjson::Value& node) {
     if (!node.IsObject()) {
         return StatusCode::REST_COULD_NOT_PARSE_OUTPUT;
     }
-    requestProto.mutable_outputs()->Clear();
     auto output = requestProto.add_outputs();
     auto nameItr = node.FindMember("name");
     if ((nameItr == node.MemberEnd()) || !(nameItr->value.IsString())) {
@@ -546,6 +967,7 @@ Status KFSRestParser::parseOutputs(rapidjson::Value& node) {
     if (!node.IsArray()) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
     }
+    requestProto.mutable_outputs()->Clear();
     for (auto& output : node.GetArray()) {
         auto status = parseOutput(output);
         if (!status.ok()) {
@@ -623,17 +1045,12 @@ static Status binaryDataSizeCanBeCalculated(::KFSRequest::InferInputTensor& inpu
     return StatusCode::OK;
 }
 
-Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
-    if (!node.IsObject()) {
-        return StatusCode::REST_COULD_NOT_PARSE_INPUT;
-    }
-
-    auto input = requestProto.add_inputs();
+Status KFSRestParser::parseInputMetadata(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input) {
     auto nameItr = node.FindMember("name");
     if ((nameItr == node.MemberEnd()) || !(nameItr->value.IsString())) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
     }
-    input->set_name(nameItr->value.GetString());
+    input.set_name(nameItr->value.GetString());
 
     auto shapeItr = node.FindMember("shape");
     if ((shapeItr == node.MemberEnd()) || !(shapeItr->value.IsArray())) {
@@ -647,22 +1064,35 @@ Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
             SPDLOG_DEBUG("Shape dimension is invalid: {}", dim.GetInt());
             return StatusCode::REST_COULD_NOT_PARSE_INPUT;
         }
-        input->mutable_shape()->Add(dim.GetInt());
+        input.mutable_shape()->Add(dim.GetInt());
     }
 
     auto datatypeItr = node.FindMember("datatype");
     if ((datatypeItr == node.MemberEnd()) || !(datatypeItr->value.IsString())) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
     }
-    input->set_datatype(datatypeItr->value.GetString());
+    input.set_datatype(datatypeItr->value.GetString());
 
     auto parametersItr = node.FindMember("parameters");
     if (parametersItr != node.MemberEnd()) {
-        auto status = parseInputParameters(parametersItr->value, *input);
+        auto status = parseInputParameters(parametersItr->value, input);
         if (!status.ok()) {
             return status;
         }
     }
+    return StatusCode::OK;
+}
+
+Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
+    if (!node.IsObject()) {
+        return StatusCode::REST_COULD_NOT_PARSE_INPUT;
+    }
+
+    auto input = requestProto.add_inputs();
+    auto status = parseInputMetadata(node, *input);
+    if (!status.ok()) {
+        return status;
+    }
 
     auto dataItr = node.FindMember("data");
     if ((dataItr != node.MemberEnd())) {
@@ -696,55 +1126,1075 @@ Status KFSRestParser::parseInputs(rapidjson::Value& node) {
     return StatusCode::OK;
 }
 
-Status KFSRestParser::parse(const char* json) {
-    rapidjson::Document doc;
-    if (doc.Parse(json).HasParseError()) {
-        SPDLOG_DEBUG("Request parsing is not a valid JSON");
-        return StatusCode::JSON_INVALID;
+namespace {
+// Typed contents field filled with input data of given datatype
+enum class ContentsField {
+    FP32,
+    INT64,
+    INT,
+    UINT64,
+    UINT,
+    FP64,
+    BOOL,
+    BYTES
+};
+
+std::optional<ContentsField> getContentsField(std::string_view datatype) {
+    static const std::unordered_map<std::string_view, ContentsField> fields{
+        {"FP32", ContentsField::FP32},
+        {"INT64", ContentsField::INT64},
+        {"INT32", ContentsField::INT},
+        {"INT16", ContentsField::INT},
+        {"INT8", ContentsField::INT},
+        {"UINT64", ContentsField::UINT64},
+        {"UINT32", ContentsField::UINT},
+        {"UINT16", ContentsField::UINT},
+        {"UINT8", ContentsField::UINT},
+        {"FP64", ContentsField::FP64},
+        {"BOOL", ContentsField::BOOL},
+        {"BYTES", ContentsField::BYTES}};
+    auto it = fields.find(datatype);
+    if (it == fields.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+// Parses member value captured from request, json starts right after member name
+bool parseCapturedValue(std::string_view json, rapidjson::Document& doc) {
+    json.remove_prefix(json.find(':') + 1);
+    return !doc.Parse(json.data(), json.size()).HasParseError();
+}
+}  // namespace
+
+class KFSRestParser::StreamingHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, KFSRestParser::StreamingHandler> {
+    // Containers entered by reader
+    enum class Frame {
+        Root,
+        Skipped,
+        Captured,
+        Inputs,
+        Input,
+        Data
+    };
+
+    // Meaning of the next value in request
+    enum class Role {
+        Document,
+        Skipped,
+        Captured,
+        Inputs,
+        Input,
+        DataRoot,
+        DataElement
+    };
+
+    KFSRestParser& parser;
+    const rapidjson::MemoryStream& stream;
+    const char* json;
+    std::vector<Frame> stack;
+    Role afterKey = Role::Document;
+
+    // Members other than input data are captured as json and parsed with document parser,
+    // as they are small and have to be checked in the same order as in document parsing
+    std::optional<std::string_view> id;
+    std::optional<std::string_view> parameters;
+    std::optional<std::string_view> outputs;
+    std::vector<std::pair<std::string_view, std::string_view>> inputMembers;
+    std::string_view* captureTarget = nullptr;
+    size_t captureStart = 0;
+    bool capturingDatatype = false;
+    bool inputsFound = false;
+
+    ::KFSRequest::InferInputTensor* input = nullptr;
+    std::optional<std::string> datatype;
+    ContentsField field = ContentsField::FP32;
+    bool dataFound = false;
+
+    Role nextValueRole() const {
+        if (stack.empty()) {
+            return Role::Document;
+        }
+        switch (stack.back()) {
+        case Frame::Skipped:
+            return Role::Skipped;
+        case Frame::Captured:
+            return Role::Captured;
+        case Frame::Inputs:
+            return Role::Input;
+        case Frame::Data:
+            return Role::DataElement;
+        default:
+            return afterKey;
+        }
     }
-    if (!doc.IsObject()) {
-        SPDLOG_DEBUG("Request body is not an object");
-        return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
+
+    void capture(std::string_view& target) {
+        captureTarget = &target;
+        captureStart = stream.Tell();
+        afterKey = Role::Captured;
     }
-    auto idItr = doc.FindMember("id");
-    if (idItr != doc.MemberEnd()) {
-        auto status = parseId(idItr->value);
-        if (!status.ok()) {
-            SPDLOG_DEBUG("Parsing request ID failed");
-            return status;
+
+    void captureMember(std::optional<std::string_view>& member) {
+        if (member.has_value()) {
+            // document parser uses first occurrence of member
+            afterKey = Role::Skipped;
+            return;
         }
+        member.emplace();
+        capture(*member);
     }
 
-    auto parametersItr = doc.FindMember("parameters");
-    if (parametersItr != doc.MemberEnd()) {
-        auto status = parseRequestParameters(parametersItr->value);
-        if (!status.ok()) {
-            SPDLOG_DEBUG("Parsing request parameters failed");
-            return status;
+    void captureInputMember(std::string_view name) {
+        for (const auto& [memberName, memberJson] : inputMembers) {
+            if (memberName == name) {
+                afterKey = Role::Skipped;
+                return;
+            }
         }
+        inputMembers.emplace_back(name, std::string_view());
+        capture(inputMembers.back().second);
+        capturingDatatype = (name == "datatype");
     }
 
-    auto outputsItr = doc.FindMember("outputs");
-    if (outputsItr != doc.MemberEnd()) {
-        auto status = parseOutputs(outputsItr->value);
-        if (!status.ok()) {
-            SPDLOG_DEBUG("Parsing request outputs failed");
-            return status;
+    void endCapture() {
+        *captureTarget = std::string_view(json + captureStart, stream.Tell() - captureStart);
+        capturingDatatype = false;
+    }
+
+    // Returns true if value ends with this event
+    bool scalarEndsCapture() {
+        return nextValueRole() == Role::Captured && stack.back() != Frame::Captured;
+    }
+
+    bool scalar() {
+        switch (nextValueRole()) {
+        case Role::Skipped:
+            return true;
+        case Role::Captured:
+            if (scalarEndsCapture()) {
+                endCapture();
+            }
+            return true;
+        default:
+            return false;
         }
     }
 
-    auto inputsItr = doc.FindMember("inputs");
-    if (inputsItr == doc.MemberEnd()) {
-        SPDLOG_DEBUG("No inputs found in request");
-        return StatusCode::REST_NO_INPUTS_FOUND;
+    bool beginData() {
+        if (dataFound || !datatype.has_value()) {
+            return false;
+        }
+        auto contentsField = getContentsField(datatype.value());
+        if (!contentsField.has_value()) {
+            return false;
+        }
+        field = contentsField.value();
+        dataFound = true;
+        afterKey = Role::DataRoot;
+        reserveContents();
+        return true;
     }
-    auto status = parseInputs(inputsItr->value);
-    if (!status.ok()) {
-        SPDLOG_DEBUG("Parsing request inputs failed");
-        return status;
+
+    // Reserves typed contents when shape precedes data in request. Shape is not validated yet,
+    // so reservation is limited by the number of elements the remaining request body can hold
+    void reserveContents() {
+        for (const auto& [name, memberJson] : inputMembers) {
+            if (name != "shape") {
+                continue;
+            }
+            rapidjson::Document shape;
+            if (!parseCapturedValue(memberJson, shape) || !shape.IsArray()) {
+                return;
+            }
+            int64_t elements = 1;
+            for (auto& dim : shape.GetArray()) {
+                if (!dim.IsInt() || dim.GetInt() <= 0 || elements > std::numeric_limits<int>::max() / dim.GetInt()) {
+                    return;
+                }
+                elements *= dim.GetInt();
+            }
+            // every element takes at least one character and a separator
+            const int64_t remainingBytes = stream.size_ - stream.Tell();
+            elements = std::min(elements, remainingBytes / 2 + 1);
+            auto* contents = input->mutable_contents();
+            switch (field) {
+            case ContentsField::FP32:
+                return contents->mutable_fp32_contents()->Reserve(elements);
+            case ContentsField::INT64:
+                return contents->mutable_int64_contents()->Reserve(elements);
+            case ContentsField::INT:
+                return contents->mutable_int_contents()->Reserve(elements);
+            case ContentsField::UINT64:
+                return contents->mutable_uint64_contents()->Reserve(elements);
+            case ContentsField::UINT:
+                return contents->mutable_uint_contents()->Reserve(elements);
+            case ContentsField::FP64:
+                return contents->mutable_fp64_contents()->Reserve(elements);
+            case ContentsField::BOOL:
+                return contents->mutable_bool_contents()->Reserve(elements);
+            case ContentsField::BYTES:
+                return contents->mutable_bytes_contents()->Reserve(elements);
+            }
+        }
     }
 
-    return StatusCode::OK;
+    // Checks and conversions are the same as in document parsing, so value is wrapped in rapidjson value
+    bool addData(const rapidjson::Value& value) {
+        if (nextValueRole() != Role::DataElement) {
+            return false;
+        }
+        auto* contents = input->mutable_contents();
+        switch (field) {
+        case ContentsField::FP32:
+            if (!value.IsNumber()) {
+                return false;
+            }
+            contents->add_fp32_contents(value.GetFloat());
+            return true;
+        case ContentsField::INT64:
+            if (!value.IsInt()) {
+                return false;
+            }
+            contents->add_int64_contents(value.GetInt64());
+            return true;
+        case ContentsField::INT:
+            if (!value.IsInt()) {
+                return false;
+            }
+            contents->add_int_contents(value.GetInt());
+            return true;
+        case ContentsField::UINT64:
+            if (!value.IsUint()) {
+                return false;
+            }
+            contents->add_uint64_contents(value.GetUint64());
+            return true;
+        case ContentsField::UINT:
+            if (!value.IsUint()) {
+                return false;
+            }
+            contents->add_uint_contents(value.GetUint());
+            return true;
+        case ContentsField::FP64:
+            if (!value.IsNumber()) {
+                return false;
+            }
+            contents->add_fp64_contents(value.GetFloat());
+            return true;
+        case ContentsField::BOOL:
+            if (!value.IsBool()) {
+                return false;
+            }
+            contents->add_bool_contents(value.GetBool());
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename T>
+    bool number(T value) {
+        if (nextValueRole() == Role::DataElement) {
+            return addData(rapidjson::Value(value));
+        }
+        return scalar();
+    }
+
+    bool endInput() {
+        if (!dataFound) {
+            return false;
+        }
+        // Document parsing does not create contents for empty data arrays
+        if (input->has_contents() && input->contents().ByteSizeLong() == 0) {
+            input->clear_contents();
+        }
+        std::string metadata = "{";
+        for (const auto& [name, memberJson] : inputMembers) {
+            if (metadata.size() > 1) {
+                metadata += ',';
+            }
+            metadata += '"';
+            metadata += name;
+            metadata += '"';
+            metadata += memberJson;
+        }
+        metadata += '}';
+        rapidjson::Document doc;
+        if (doc.Parse(metadata.c_str(), metadata.size()).HasParseError()) {
+            return false;
+        }
+        return parser.parseInputMetadata(doc, *input).ok();
+    }
+
+    bool parseCapturedMember(const std::optional<std::string_view>& member, Status (KFSRestParser::*parse)(rapidjson::Value&)) {
+        if (!member.has_value()) {
+            return true;
+        }
+        rapidjson::Document doc;
+        if (!parseCapturedValue(member.value(), doc)) {
+            return false;
+        }
+        return (parser.*parse)(doc).ok();
+    }
+
+public:
+    StreamingHandler(KFSRestParser& parser, const rapidjson::MemoryStream& stream, const char* json) :
+        parser(parser),
+        stream(stream),
+        json(json) {}
+
+    bool Null() { return scalar(); }
+    bool Bool(bool value) {
+        if (nextValueRole() == Role::DataElement) {
+            return addData(rapidjson::Value(value));
+        }
+        return scalar();
+    }
+    bool Int(int value) { return number(value); }
+    bool Uint(unsigned value) { return number(value); }
+    bool Int64(int64_t value) { return number(value); }
+    bool Uint64(uint64_t value) { return number(value); }
+    bool Double(double value) { return number(value); }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        if (nextValueRole() == Role::DataElement) {
+            if (field != ContentsField::BYTES) {
+                return false;
+            }
+            // document parser copies string up to first null character as well
+            input->mutable_contents()->add_bytes_contents(str);
+            return true;
+        }
+        if (capturingDatatype && scalarEndsCapture()) {
+            datatype.emplace(str, length);
+        }
+        return scalar();
+    }
+
+    bool StartObject() {
+        switch (nextValueRole()) {
+        case Role::Document:
+            stack.push_back(Frame::Root);
+            return true;
+        case Role::Skipped:
+            stack.push_back(Frame::Skipped);
+            return true;
+        case Role::Captured:
+            stack.push_back(Frame::Captured);
+            return true;
+        case Role::Input:
+            input = parser.requestProto.add_inputs();
+            inputMembers.clear();
+            datatype.reset();
+            dataFound = false;
+            stack.push_back(Frame::Input);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        std::string_view key(str, length);
+        switch (stack.back()) {
+        case Frame::Root:
+            if (key == "id") {
+                captureMember(id);
+            } else if (key == "parameters") {
+                captureMember(parameters);
+            } else if (key == "outputs") {
+                captureMember(outputs);
+            } else if (key == "inputs") {
+                if (inputsFound) {
+                    return false;
+                }
+                inputsFound = true;
+                afterKey = Role::Inputs;
+            } else {
+                afterKey = Role::Skipped;
+            }
+            return true;
+        case Frame::Input:
+            if (key == "data") {
+                return beginData();
+            }
+            for (std::string_view name : {"name", "shape", "datatype", "parameters"}) {
+                if (key == name) {
+                    captureInputMember(name);
+                    return true;
+                }
+            }
+            afterKey = Role::Skipped;
+            return true;
+        case Frame::Skipped:
+        case Frame::Captured:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        Frame frame = stack.back();
+        stack.pop_back();
+        switch (frame) {
+        case Frame::Captured:
+            if (stack.back() != Frame::Captured) {
+                endCapture();
+            }
+            return true;
+        case Frame::Input:
+            return endInput();
+        default:
+            return true;
+        }
+    }
+
+    bool StartArray() {
+        switch (nextValueRole()) {
+        case Role::Skipped:
+            stack.push_back(Frame::Skipped);
+            return true;
+        case Role::Captured:
+            stack.push_back(Frame::Captured);
+            return true;
+        case Role::Inputs:
+            stack.push_back(Frame::Inputs);
+            return true;
+        case Role::DataRoot:
+        case Role::DataElement:
+            stack.push_back(Frame::Data);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool EndArray(rapidjson::SizeType count) {
+        Frame frame = stack.back();
+        stack.pop_back();
+        switch (frame) {
+        case Frame::Captured:
+            if (stack.back() != Frame::Captured) {
+                endCapture();
+            }
+            return true;
+        case Frame::Inputs:
+            return count > 0;
+        default:
+            return true;
+        }
+    }
+
+    /**
+     * @brief Parses captured members in the same order as document parser
+     * 
+     * @return false if request has to be parsed with document parser
+     */
+    bool finish() {
+        return inputsFound &&
+               parseCapturedMember(id, &KFSRestParser::parseId) &&
+               parseCapturedMember(parameters, &KFSRestParser::parseRequestParameters) &&
+               parseCapturedMember(outputs, &KFSRestParser::parseOutputs);
+    }
+};
+
+bool KFSRestParser::parseStreaming(const char* json, size_t length) {
+    rapidjson::MemoryStream stream(json, length);
+    StreamingHandler handler(*this, stream, json);
+    rapidjson::Reader reader;
+    if (reader.Parse(stream, handler).IsError() || !handler.finish()) {
+        requestProto.Clear();
+        return false;
+    }
+    return true;
+}
+
+Status KFSRestParser::parse(const char* json) {
+    return parse(json, std::strlen(json));
+}
+
+Status KFSRestParser::parse(const char* json, size_t length) {
+    if (parseStreaming(json, length)) {
+        return StatusCode::OK;
+    }
+    SPDLOG_DEBUG("Request could not be parsed with streaming parser, parsing with document parser");
+    return parseDocument(json, length);
+}
+
+Status KFSRestParser::parseDocument(const char* json, size_t length) {
+    rapidjson::Document doc;
+    if (doc.Parse(json, length).HasParseError()) {
+        SPDLOG_DEBUG("Request parsing is not a valid JSON");
+        return StatusCode::JSON_INVALID;
+    }
+    if (!doc.IsObject()) {
+        SPDLOG_DEBUG("Request body is not an object");
+        return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
+    }
+    auto idItr = doc.FindMember("id");
+    if (idItr != doc.MemberEnd()) {
+        auto status = parseId(idItr->value);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Parsing request ID failed");
+            return status;
+        }
+    }
+
+    auto parametersItr = doc.FindMember("parameters");
+    if (parametersItr != doc.MemberEnd()) {
+        auto status = parseRequestParameters(parametersItr->value);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Parsing request parameters failed");
+            return status;
+        }
+    }
+
+    auto outputsItr = doc.FindMember("outputs");
+    if (outputsItr != doc.MemberEnd()) {
+        auto status = parseOutputs(outputsItr->value);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Parsing request outputs failed");
+            return status;
+        }
+    }
+
+    auto inputsItr = doc.FindMember("inputs");
+    if (inputsItr == doc.MemberEnd()) {
+        SPDLOG_DEBUG("No inputs found in request");
+        return StatusCode::REST_NO_INPUTS_FOUND;
+    }
+    auto status = parseInputs(inputsItr->value);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Parsing request inputs failed");
+        return status;
+    }
+
+    return StatusCode::OK;
+}
+
+namespace {
+// Input of request parsed into tensor, read from members preceding input data
+struct TensorInputMetadata {
+    std::string name;
+    signed_shape_t shape;
+    Precision precision = Precision::UNDEFINED;
+    size_t elementSize = 0;
+    std::optional<int64_t> binaryDataSize;
+    size_t elementsCount = 1;
+};
+
+// Reads input members captured from request. Returns false if input is not valid or cannot be parsed into tensor
+bool parseTensorInputMetadata(const std::vector<std::pair<std::string_view, std::string_view>>& members, TensorInputMetadata& metadata) {
+    bool nameFound = false;
+    bool shapeFound = false;
+    bool datatypeFound = false;
+    for (const auto& [name, memberJson] : members) {
+        rapidjson::Document doc;
+        if (!parseCapturedValue(memberJson, doc)) {
+            return false;
+        }
+        if (name == "name") {
+            if (!doc.IsString()) {
+                return false;
+            }
+            metadata.name.assign(doc.GetString(), doc.GetStringLength());
+            nameFound = true;
+        } else if (name == "shape") {
+            if (!doc.IsArray()) {
+                return false;
+            }
+            for (auto& dim : doc.GetArray()) {
+                if (!dim.IsInt() || dim.GetInt() <= 0 || metadata.elementsCount > std::numeric_limits<int32_t>::max() / static_cast<size_t>(dim.GetInt())) {
+                    return false;
+                }
+                metadata.shape.push_back(dim.GetInt());
+                metadata.elementsCount *= dim.GetInt();
+            }
+            shapeFound = true;
+        } else if (name == "datatype") {
+            if (!doc.IsString()) {
+                return false;
+            }
+            KFSDataType datatype(doc.GetString(), doc.GetStringLength());
+            metadata.precision = KFSPrecisionToOvmsPrecision(datatype);
+            metadata.elementSize = KFSDataTypeSize(datatype);
+            datatypeFound = true;
+        } else if (name == "parameters") {
+            // other parameters, e.g. shared memory ones, are handled only by request proto processing
+            if (!doc.IsObject()) {
+                return false;
+            }
+            for (auto& parameter : doc.GetObject()) {
+                if (std::string_view(parameter.name.GetString()) != "binary_data_size" || !parameter.value.IsInt64()) {
+                    return false;
+                }
+                metadata.binaryDataSize = parameter.value.GetInt64();
+            }
+        }
+    }
+    return nameFound && shapeFound && datatypeFound && metadata.precision != Precision::UNDEFINED && metadata.elementSize > 0;
+}
+
+// Precisions of tensors filled from json numbers or binary data without conversion
+bool isNumericPrecision(Precision precision) {
+    switch (precision) {
+    case Precision::FP64:
+    case Precision::FP32:
+    case Precision::I64:
+    case Precision::I32:
+    case Precision::I16:
+    case Precision::I8:
+    case Precision::U64:
+    case Precision::U32:
+    case Precision::U16:
+    case Precision::U8:
+        return true;
+    default:
+        return false;
+    }
+}
+}  // namespace
+
+class KFSRestTensorParser::StreamingHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, KFSRestTensorParser::StreamingHandler> {
+    // Containers entered by reader
+    enum class Frame {
+        Root,
+        Nested,
+        Inputs,
+        Input,
+        Data
+    };
+
+    // Meaning of value following the last key
+    enum class Member {
+        Skipped,
+        Captured,
+        Inputs,
+        Data
+    };
+
+    KFSRestTensorParser& parser;
+    const rapidjson::MemoryStream& stream;
+    std::string_view json;
+    std::string_view binaryInputs;
+    size_t binaryInputsOffset = 0;
+    std::vector<Frame> stack;
+    Member afterKey = Member::Skipped;
+
+    // Members other than input data are small, they are captured as json and parsed with document parser
+    std::optional<std::string_view> id;
+    std::optional<std::string_view> parameters;
+    std::optional<std::string_view> outputs;
+    std::vector<std::pair<std::string_view, std::string_view>> inputMembers;
+    std::string_view* captureTarget = nullptr;
+    size_t captureStart = 0;
+    bool inputsFound = false;
+
+    TensorInputMetadata input;
+    std::unique_ptr<Buffer> data;
+    size_t dataCount = 0;
+    bool dataFound = false;
+
+    bool capture(std::optional<std::string_view>& member) {
+        if (member.has_value()) {
+            return false;
+        }
+        member.emplace();
+        captureTarget = &member.value();
+        captureStart = stream.Tell();
+        afterKey = Member::Captured;
+        return true;
+    }
+
+    bool captureInputMember(std::string_view name) {
+        for (const auto& [memberName, memberJson] : inputMembers) {
+            if (memberName == name) {
+                return false;
+            }
+        }
+        inputMembers.emplace_back(name, std::string_view());
+        captureTarget = &inputMembers.back().second;
+        captureStart = stream.Tell();
+        afterKey = Member::Captured;
+        return true;
+    }
+
+    void endCapture() {
+        if (afterKey == Member::Captured) {
+            *captureTarget = json.substr(captureStart, stream.Tell() - captureStart);
+        }
+    }
+
+    // Value directly in request or input object, not in nested container
+    bool isMemberValue() const {
+        return !stack.empty() && (stack.back() == Frame::Root || stack.back() == Frame::Input);
+    }
+
+    bool scalar() {
+        if (!stack.empty() && stack.back() == Frame::Nested) {
+            return true;
+        }
+        if (!isMemberValue() || (afterKey != Member::Skipped && afterKey != Member::Captured)) {
+            return false;
+        }
+        endCapture();
+        return true;
+    }
+
+    bool startNested() {
+        if (!stack.empty() && stack.back() == Frame::Nested) {
+            stack.push_back(Frame::Nested);
+            return true;
+        }
+        if (!isMemberValue() || (afterKey != Member::Skipped && afterKey != Member::Captured)) {
+            return false;
+        }
+        stack.push_back(Frame::Nested);
+        return true;
+    }
+
+    bool endNested() {
+        stack.pop_back();
+        if (stack.back() != Frame::Nested) {
+            endCapture();
+        }
+        return true;
+    }
+
+    bool beginData() {
+        if (dataFound || !parseTensorInputMetadata(inputMembers, input) || input.binaryDataSize.has_value()) {
+            return false;
+        }
+        if (!isNumericPrecision(input.precision) && input.precision != Precision::BOOL) {
+            return false;
+        }
+        // every element takes at least one character and a separator, so larger inputs cannot be filled
+        if (input.elementsCount > (json.size() - stream.Tell()) / 2 + 1) {
+            return false;
+        }
+        data = std::make_unique<Buffer>(input.elementsCount * input.elementSize);
+        dataCount = 0;
+        dataFound = true;
+        return true;
+    }
+
+    template <typename T>
+    void write(T value) {
+        std::memcpy(static_cast<char*>(data->data()) + dataCount * sizeof(T), &value, sizeof(T));
+        ++dataCount;
+    }
+
+    // Accepts the same values as document parsing of typed contents, converted as in their deserialization
+    bool addData(const rapidjson::Value& value) {
+        if (dataCount == input.elementsCount) {
+            return false;
+        }
+        switch (input.precision) {
+        case Precision::FP32:
+            if (!value.IsNumber()) {
+                return false;
+            }
+            write<float>(value.GetFloat());
+            return true;
+        case Precision::FP64:
+            if (!value.IsNumber()) {
+                return false;
+            }
+            write<double>(value.GetDouble());
+            return true;
+        case Precision::I64:
+            if (!value.IsInt()) {
+                return false;
+            }
+            write<int64_t>(value.GetInt64());
+            return true;
+        case Precision::I32:
+            if (!value.IsInt()) {
+                return false;
+            }
+            write<int32_t>(value.GetInt());
+            return true;
+        case Precision::I16:
+            if (!value.IsInt()) {
+                return false;
+            }
+            write<int16_t>(static_cast<int16_t>(value.GetInt()));
+            return true;
+        case Precision::I8:
+            if (!value.IsInt()) {
+                return false;
+            }
+            write<int8_t>(static_cast<int8_t>(value.GetInt()));
+            return true;
+        case Precision::U64:
+            if (!value.IsUint()) {
+                return false;
+            }
+            write<uint64_t>(value.GetUint64());
+            return true;
+        case Precision::U32:
+            if (!value.IsUint()) {
+                return false;
+            }
+            write<uint32_t>(value.GetUint());
+            return true;
+        case Precision::U16:
+            if (!value.IsUint()) {
+                return false;
+            }
+            write<uint16_t>(static_cast<uint16_t>(value.GetUint()));
+            return true;
+        case Precision::U8:
+            if (!value.IsUint()) {
+                return false;
+            }
+            write<uint8_t>(static_cast<uint8_t>(value.GetUint()));
+            return true;
+        case Precision::BOOL:
+            if (!value.IsBool()) {
+                return false;
+            }
+            write<bool>(value.GetBool());
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename T>
+    bool number(T value) {
+        if (!stack.empty() && stack.back() == Frame::Data) {
+            return addData(rapidjson::Value(value));
+        }
+        return scalar();
+    }
+
+    bool addInput() {
+        return parser.request.addInput(input.name.c_str(), getPrecisionAsOVMSDataType(input.precision), input.shape.data(), input.shape.size()).ok();
+    }
+
+    // Binary inputs follow json part in the same order as inputs without data in json
+    bool addBinaryInput() {
+        if (!parseTensorInputMetadata(inputMembers, input) || (!isNumericPrecision(input.precision) && input.precision != Precision::FP16)) {
+            return false;
+        }
+        const size_t size = input.elementsCount * input.elementSize;
+        if (input.binaryDataSize.has_value() && input.binaryDataSize.value() != static_cast<int64_t>(size)) {
+            return false;
+        }
+        if (size > binaryInputs.size() - binaryInputsOffset || !addInput()) {
+            return false;
+        }
+        const char* binaryInput = binaryInputs.data() + binaryInputsOffset;
+        binaryInputsOffset += size;
+        // tensor is created over request body unless its data is not aligned for its element type
+        const bool aligned = reinterpret_cast<uintptr_t>(binaryInput) % input.elementSize == 0;
+        return parser.request.getTensor(input.name.c_str())->setBuffer(std::make_unique<Buffer>(binaryInput, size, OVMS_BUFFERTYPE_CPU, std::nullopt, !aligned)).ok();
+    }
+
+    bool endInput() {
+        if (!dataFound) {
+            return addBinaryInput();
+        }
+        if (dataCount != input.elementsCount || !addInput()) {
+            return false;
+        }
+        return parser.request.getTensor(input.name.c_str())->setBuffer(std::move(data)).ok();
+    }
+
+    bool parseId() {
+        if (!id.has_value()) {
+            return true;
+        }
+        rapidjson::Document doc;
+        if (!parseCapturedValue(id.value(), doc) || !doc.IsString()) {
+            return false;
+        }
+        parser.id.assign(doc.GetString(), doc.GetStringLength());
+        return true;
+    }
+
+    // Only binary_data parameters are handled, other request parameters are handled by request proto processing
+    static bool parseBinaryDataParameter(const rapidjson::Value& node, std::string_view parameterName, bool& binaryData) {
+        if (!node.IsObject()) {
+            return false;
+        }
+        for (auto parameter = node.MemberBegin(); parameter != node.MemberEnd(); ++parameter) {
+            if (std::string_view(parameter->name.GetString()) != parameterName || !parameter->value.IsBool()) {
+                return false;
+            }
+            binaryData = parameter->value.GetBool();
+        }
+        return true;
+    }
+
+    // Binary format applies only to outputs listed in request, as in request proto processing
+    bool parseOutputs() {
+        bool binaryDataOutput = false;
+        if (parameters.has_value()) {
+            rapidjson::Document doc;
+            if (!parseCapturedValue(parameters.value(), doc) || !parseBinaryDataParameter(doc, "binary_data_output", binaryDataOutput)) {
+                return false;
+            }
+        }
+        if (!outputs.has_value()) {
+            return true;
+        }
+        rapidjson::Document doc;
+        if (!parseCapturedValue(outputs.value(), doc) || !doc.IsArray()) {
+            return false;
+        }
+        for (auto& output : doc.GetArray()) {
+            if (!output.IsObject()) {
+                return false;
+            }
+            auto nameItr = output.FindMember("name");
+            if (nameItr == output.MemberEnd() || !nameItr->value.IsString()) {
+                return false;
+            }
+            bool binaryData = binaryDataOutput;
+            auto parametersItr = output.FindMember("parameters");
+            if (parametersItr != output.MemberEnd() && !parseBinaryDataParameter(parametersItr->value, "binary_data", binaryData)) {
+                return false;
+            }
+            if (binaryData) {
+                parser.binaryOutputsNames.emplace(nameItr->value.GetString(), nameItr->value.GetStringLength());
+            }
+        }
+        return true;
+    }
+
+public:
+    StreamingHandler(KFSRestTensorParser& parser, const rapidjson::MemoryStream& stream, std::string_view json, std::string_view binaryInputs) :
+        parser(parser),
+        stream(stream),
+        json(json),
+        binaryInputs(binaryInputs) {}
+
+    bool Null() { return scalar(); }
+    bool Bool(bool value) {
+        if (!stack.empty() && stack.back() == Frame::Data) {
+            return addData(rapidjson::Value(value));
+        }
+        return scalar();
+    }
+    bool Int(int value) { return number(value); }
+    bool Uint(unsigned value) { return number(value); }
+    bool Int64(int64_t value) { return number(value); }
+    bool Uint64(uint64_t value) { return number(value); }
+    bool Double(double value) { return number(value); }
+    bool String(const char*, rapidjson::SizeType, bool) { return scalar(); }
+
+    bool StartObject() {
+        if (stack.empty()) {
+            stack.push_back(Frame::Root);
+            return true;
+        }
+        if (stack.back() == Frame::Inputs) {
+            inputMembers.clear();
+            input = TensorInputMetadata();
+            dataFound = false;
+            stack.push_back(Frame::Input);
+            return true;
+        }
+        return startNested();
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        std::string_view key(str, length);
+        switch (stack.back()) {
+        case Frame::Root:
+            if (key == "id") {
+                return capture(id);
+            } else if (key == "parameters") {
+                return capture(parameters);
+            } else if (key == "outputs") {
+                return capture(outputs);
+            } else if (key == "inputs") {
+                if (inputsFound) {
+                    return false;
+                }
+                inputsFound = true;
+                afterKey = Member::Inputs;
+                return true;
+            }
+            afterKey = Member::Skipped;
+            return true;
+        case Frame::Input:
+            if (key == "data") {
+                afterKey = Member::Data;
+                return beginData();
+            }
+            for (std::string_view name : {"name", "shape", "datatype", "parameters"}) {
+                if (key == name) {
+                    return captureInputMember(name);
+                }
+            }
+            afterKey = Member::Skipped;
+            return true;
+        case Frame::Nested:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        switch (stack.back()) {
+        case Frame::Nested:
+            return endNested();
+        case Frame::Input:
+            stack.pop_back();
+            return endInput();
+        default:
+            stack.pop_back();
+            return true;
+        }
+    }
+
+    bool StartArray() {
+        if (stack.empty()) {
+            return false;
+        }
+        if (stack.back() == Frame::Data || (stack.back() == Frame::Input && afterKey == Member::Data)) {
+            stack.push_back(Frame::Data);
+            return true;
+        }
+        if (stack.back() == Frame::Root && afterKey == Member::Inputs) {
+            stack.push_back(Frame::Inputs);
+            return true;
+        }
+        return startNested();
+    }
+
+    bool EndArray(rapidjson::SizeType count) {
+        switch (stack.back()) {
+        case Frame::Nested:
+            return endNested();
+        case Frame::Inputs:
+            stack.pop_back();
+            return count > 0;
+        default:
+            stack.pop_back();
+            return true;
+        }
+    }
+
+    bool finish() {
+        return inputsFound && parseId() && parseOutputs();
+    }
+};
+
+bool KFSRestTensorParser::parse(std::string_view body, size_t endOfJson) {
+    if (endOfJson > body.size()) {
+        return false;
+    }
+    rapidjson::MemoryStream stream(body.data(), endOfJson);
+    StreamingHandler handler(*this, stream, body.substr(0, endOfJson), body.substr(endOfJson));
+    rapidjson::Reader reader;
+    return !reader.Parse(stream, handler).IsError() && handler.finish();
 }
 
 }  // namespace ovms
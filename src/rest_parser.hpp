@@ -15,7 +15,9 @@
 //*****************************************************************************
 #pragma once
 
+#include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <rapidjson/document.h>
@@ -31,6 +33,7 @@
 #include "tensorinfo.hpp"
 
 namespace ovms {
+class InferenceRequest;
 class Status;
 
 /**
@@ -77,8 +80,18 @@ class TFSRestParser : RestParser {
      */
     std::unordered_map<std::string, ovms::Precision> tensorPrecisionMap;
 
+    /**
+     * @brief Handler of rapidjson reader events writing numeric tensor data directly into request proto
+     */
+    class StreamingHandler;
+
     void removeUnusedInputs();
 
+    /**
+     * @brief Restores inputs to the state after construction, used when streaming parsing is abandoned
+     */
+    void resetInputs();
+
     /**
      * @brief Increases batch size (0th-dimension) of tensor
      */
@@ -217,10 +230,37 @@ public:
      * }
      */
     Status parse(const char* json);
+
+    /**
+     * @brief Parses http request body with rapidjson reader, without building document.
+     *        Tensor shape is learned from nesting of arrays while numeric values are written directly to tensor content.
+     * 
+     * @return true when request was parsed, false when it has to be parsed with document parser,
+     *         e.g. contains binary, string or special inputs or is not valid
+     */
+    bool parseStreaming(const char* json, size_t length);
+
+    /**
+     * @brief Parses http request body building full rapidjson document
+     * 
+     * @param json request string
+     * 
+     * @return Status indicating error code or success
+     */
+    Status parseDocument(const char* json);
 };
 
 class KFSRestParser : RestParser {
-    ::KFSRequest requestProto;
+    /**
+     * @brief Request proto, allocated on arena when parser was given one
+     */
+    ::KFSRequest& requestProto;
+
+    /**
+     * @brief Handler of rapidjson reader events writing input data directly into request proto
+     */
+    class StreamingHandler;
+
     Status parseId(rapidjson::Value& node);
     Status parseRequestParameters(rapidjson::Value& node);
     Status parseInputParameters(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input);
@@ -228,12 +268,78 @@ class KFSRestParser : RestParser {
     Status parseOutput(rapidjson::Value& node);
     Status parseOutputs(rapidjson::Value& node);
     Status parseData(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input);
+    Status parseInputMetadata(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input);
     Status parseInput(rapidjson::Value& node, bool onlyOneInput);
     Status parseInputs(rapidjson::Value& node);
 
 public:
+    /**
+     * @brief Constructs parser which parses request into proto allocated on given arena
+     *
+     * @param arena arena owning parsed request, has to outlive the parser, heap is used when nullptr
+     */
+    KFSRestParser(google::protobuf::Arena* arena = nullptr);
+    ~KFSRestParser();
+    KFSRestParser(const KFSRestParser&) = delete;
+    KFSRestParser& operator=(const KFSRestParser&) = delete;
+
     Status parse(const char* json);
+    /**
+     * @brief Parses json which is not null terminated, e.g. followed by binary inputs in request body
+     */
+    Status parse(const char* json, size_t length);
+
+    /**
+     * @brief Parses http request body with rapidjson reader, without building document.
+     *        Input data is written directly to typed contents reserved according to input shape.
+     * 
+     * @return true when request was parsed, false when it has to be parsed with document parser,
+     *         e.g. input data precedes its datatype or request is not valid
+     */
+    bool parseStreaming(const char* json, size_t length);
+
+    /**
+     * @brief Parses http request body building full rapidjson document
+     */
+    Status parseDocument(const char* json, size_t length);
     ::KFSRequest& getProto() { return requestProto; }
 };
 
+/**
+ * @brief This class parses KServe http request body straight into inference request of a single model, without building request proto.
+ *        Input data in json is written to tensor buffers and binary inputs are referenced in request body.
+ *
+ *        Only inputs of numeric datatypes with no parameters other than binary data ones are handled.
+ *        Remaining requests, including invalid ones, are left to KFSRestParser which also reports their errors.
+ */
+class KFSRestTensorParser : RestParser {
+    InferenceRequest& request;
+    std::string id;
+    std::set<std::string> binaryOutputsNames;
+
+    /**
+     * @brief Handler of rapidjson reader events writing input data directly into tensor buffers
+     */
+    class StreamingHandler;
+
+public:
+    KFSRestTensorParser(InferenceRequest& request) :
+        request(request) {}
+
+    /**
+     * @brief Parses http request body with json part ending at endOfJson, followed by binary inputs.
+     *        Request body has to outlive inference request.
+     *
+     * @return true when request was parsed, false when it has to be parsed with KFSRestParser
+     */
+    bool parse(std::string_view body, size_t endOfJson);
+
+    const std::string& getId() const { return id; }
+
+    /**
+     * @brief Names of outputs requested in binary format
+     */
+    const std::set<std::string>& getBinaryOutputsNames() const { return binaryOutputsNames; }
+};
+
 }  // namespace ovms
@@ -0,0 +1,196 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "benchmark_utils.hpp"
+#include "precision.hpp"
+#include "rest_parser.hpp"
+#include "shape.hpp"
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace {
+
+ovms::tensor_map_t prepareTensors(const std::unordered_map<std::string, ovms::Shape>& tensors) {
+    ovms::tensor_map_t result;
+    for (const auto& [name, shape] : tensors) {
+        result[name] = std::make_shared<ovms::TensorInfo>(name, ovms::Precision::FP32, shape);
+    }
+    return result;
+}
+
+// Nested json array of random values with given shape
+void appendArray(std::string& json, const std::vector<size_t>& shape, size_t dim, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1000.0, 1000.0);
+    json += '[';
+    for (size_t i = 0; i < shape[dim]; ++i) {
+        if (i > 0) {
+            json += ',';
+        }
+        if (dim + 1 < shape.size()) {
+            appendArray(json, shape, dim + 1, generator);
+        } else {
+            json += std::to_string(distribution(generator));
+        }
+    }
+    json += ']';
+}
+
+int compareTFS(const std::string& description, const std::unordered_map<std::string, ovms::Shape>& tensors, const std::string& json, uint32_t niter) {
+    ovms::TFSRestParser streamingParser(prepareTensors(tensors));
+    ovms::TFSRestParser documentParser(prepareTensors(tensors));
+    if (!streamingParser.parseStreaming(json.c_str(), json.size()) || !documentParser.parseDocument(json.c_str()).ok() ||
+        streamingParser.getProto().DebugString() != documentParser.getProto().DebugString()) {
+        std::cerr << description << ": parsing results differ" << std::endl;
+        return EX_SOFTWARE;
+    }
+    double documentTime = ovms::measureMilliseconds(niter, [&tensors, &json]() {
+        ovms::TFSRestParser parser(prepareTensors(tensors));
+        parser.parseDocument(json.c_str());
+    });
+    double streamingTime = ovms::measureMilliseconds(niter, [&tensors, &json]() {
+        ovms::TFSRestParser parser(prepareTensors(tensors));
+        parser.parseStreaming(json.c_str(), json.size());
+    });
+    std::cout << description << " (" << json.size() << " bytes): document " << documentTime << " ms, streaming " << streamingTime << " ms" << std::endl;
+    return EX_OK;
+}
+
+int compareKFS(const std::string& description, const std::string& json, uint32_t niter) {
+    ovms::KFSRestParser streamingParser;
+    ovms::KFSRestParser documentParser;
+    if (!streamingParser.parseStreaming(json.c_str(), json.size()) || !documentParser.parseDocument(json.c_str(), json.size()).ok() ||
+        streamingParser.getProto().DebugString() != documentParser.getProto().DebugString()) {
+        std::cerr << description << ": parsing results differ" << std::endl;
+        return EX_SOFTWARE;
+    }
+    double documentTime = ovms::measureMilliseconds(niter, [&json]() {
+        ovms::KFSRestParser parser;
+        parser.parseDocument(json.c_str(), json.size());
+    });
+    double streamingTime = ovms::measureMilliseconds(niter, [&json]() {
+        ovms::KFSRestParser parser;
+        parser.parseStreaming(json.c_str(), json.size());
+    });
+    std::cout << description << " (" << json.size() << " bytes): document " << documentTime << " ms, streaming " << streamingTime << " ms" << std::endl;
+    return EX_OK;
+}
+
+const char* columnNamedRequest = R"({
+    "inputs": {
+        "inputA": [
+            [[[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], [[7.0, 8.0], [9.0, 10.0], [11.0, 12.0]]],
+            [[[101.0, 102.0], [103.0, 104.0], [105.0, 106.0]], [[107.0, 108.0], [109.0, 110.0], [111.0, 112.0]]]
+        ],
+        "inputB": [
+            [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]],
+            [[11.0, 12.0, 13.0], [14.0, 15.0, 16.0]]
+        ]
+    },
+    "signature_name": "serving_default"
+})";
+
+const char* rowNamedRequest = R"({
+    "signature_name": "serving_default",
+    "instances": [
+        {
+            "inputA": [[[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], [[7.0, 8.0], [9.0, 10.0], [11.0, 12.0]]],
+            "inputB": [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]
+        },
+        {
+            "inputA": [[[101.0, 102.0], [103.0, 104.0], [105.0, 106.0]], [[107.0, 108.0], [109.0, 110.0], [111.0, 112.0]]],
+            "inputB": [[11.0, 12.0, 13.0], [14.0, 15.0, 16.0]]
+        }
+    ]
+})";
+
+const char* kfsRequest = R"({
+    "id": "request",
+    "inputs": [
+        {"name": "input0", "shape": [2, 2], "datatype": "FP32", "data": [1, 2, 3, 4]},
+        {"name": "input1", "shape": [3], "datatype": "BOOL", "data": [true, false, true]}
+    ]
+})";
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "REST API request json parsing benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("resolution",
+            "height and width of synthetic 1x3xRESOLUTIONxRESOLUTION image input",
+            cxxopts::value<uint32_t>()->default_value("224"),
+            "RESOLUTION")
+        ("niter",
+            "number of parsed requests per payload",
+            cxxopts::value<uint32_t>()->default_value("20"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t resolution = result->operator[]("resolution").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0 || resolution == 0) {
+        std::cerr << "niter and resolution have to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::mt19937 generator(42);
+    const std::vector<size_t> imageShape{1, 3, resolution, resolution};
+    std::string image;
+    appendArray(image, imageShape, 0, generator);
+    const ovms::Shape imageTensorShape{1, 3, static_cast<int64_t>(resolution), static_cast<int64_t>(resolution)};
+
+    std::cout << "iterations: " << niter << " image elements: " << 3 * resolution * resolution << std::endl;
+    int exitCode = EX_OK;
+    auto check = [&exitCode](int code) {
+        if (code != EX_OK) {
+            exitCode = code;
+        }
+    };
+    check(compareTFS("TFS column named", {{"inputA", {2, 2, 3, 2}}, {"inputB", {2, 2, 3}}}, columnNamedRequest, niter * 1000));
+    check(compareTFS("TFS row named", {{"inputA", {2, 2, 3, 2}}, {"inputB", {2, 2, 3}}}, rowNamedRequest, niter * 1000));
+    check(compareKFS("KServe two inputs", kfsRequest, niter * 1000));
+    check(compareTFS("TFS row no named image", {{"image", imageTensorShape}}, R"({"instances":)" + image + "}", niter));
+    check(compareTFS("TFS column named image", {{"image", imageTensorShape}}, R"({"inputs":{"image":)" + image + "}}", niter));
+    check(compareKFS("KServe FP32 image",
+        R"({"inputs":[{"name":"image","shape":[1,3,)" + std::to_string(resolution) + "," + std::to_string(resolution) +
+            R"(],"datatype":"FP32","data":)" + image + "}]}",
+        niter));
+    return exitCode;
+}
@@ -0,0 +1,197 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <sysexits.h>
+
+#include "benchmark_utils.hpp"
+#include "kfs_frontend/kfs_utils.hpp"
+#include "rest_utils.hpp"
+#include "status.hpp"
+
+namespace {
+
+template <typename T>
+void addOutput(::KFSResponse& response, const std::string& name, const std::string& datatype, const std::vector<int64_t>& shape, const std::vector<T>& values) {
+    auto* output = response.add_outputs();
+    output->set_name(name);
+    output->set_datatype(datatype);
+    for (auto dim : shape) {
+        output->add_shape(dim);
+    }
+    response.add_raw_output_contents()->assign(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+// Writer calls per tensor element, as responses were written before numbers were formatted in bulk
+template <typename T>
+void writeReferenceData(rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer, const std::string& raw) {
+    const size_t count = raw.size() / sizeof(T);
+    writer.StartArray();
+    for (size_t i = 0; i < count; ++i) {
+        T value;
+        std::memcpy(&value, raw.data() + i * sizeof(T), sizeof(T));
+        if constexpr (std::is_floating_point_v<T>) {
+            writer.Double(value);
+        } else {
+            writer.Int64(value);
+        }
+    }
+    writer.EndArray();
+}
+
+std::string makeReferenceJson(const ::KFSResponse& response) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("model_name");
+    writer.String(response.model_name().c_str());
+    writer.Key("outputs");
+    writer.StartArray();
+    for (int i = 0; i < response.outputs_size(); ++i) {
+        const auto& output = response.outputs(i);
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(output.name().c_str());
+        writer.Key("shape");
+        writer.StartArray();
+        for (auto dim : output.shape()) {
+            writer.Int64(dim);
+        }
+        writer.EndArray();
+        writer.Key("datatype");
+        writer.String(output.datatype().c_str());
+        writer.Key("data");
+        if (output.datatype() == "FP32") {
+            writeReferenceData<float>(writer, response.raw_output_contents(i));
+        } else {
+            writeReferenceData<int64_t>(writer, response.raw_output_contents(i));
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+int compare(const std::string& description, const ::KFSResponse& response, uint32_t niter) {
+    std::string referenceJson = makeReferenceJson(response);
+    std::string prettyJson, compactJson;
+    std::optional<int> inferenceHeaderContentLength;
+    if (!ovms::makeJsonFromPredictResponse(response, &prettyJson, inferenceHeaderContentLength, {}, true).ok() ||
+        !ovms::makeJsonFromPredictResponse(response, &compactJson, inferenceHeaderContentLength, {}, false).ok()) {
+        std::cerr << description << ": serialization failed" << std::endl;
+        return EX_SOFTWARE;
+    }
+    double referenceTime = ovms::measureMilliseconds(niter, [&response]() {
+        makeReferenceJson(response);
+    });
+    double prettyTime = ovms::measureMilliseconds(niter, [&response]() {
+        std::string json;
+        std::optional<int> contentLength;
+        ovms::makeJsonFromPredictResponse(response, &json, contentLength, {}, true);
+    });
+    double compactTime = ovms::measureMilliseconds(niter, [&response]() {
+        std::string json;
+        std::optional<int> contentLength;
+        ovms::makeJsonFromPredictResponse(response, &json, contentLength, {}, false);
+    });
+    std::cout << description << ": per element writer " << referenceTime << " ms (" << referenceJson.size() << " bytes), "
+              << "pretty " << prettyTime << " ms (" << prettyJson.size() << " bytes), "
+              << "compact " << compactTime << " ms (" << compactJson.size() << " bytes)" << std::endl;
+    return EX_OK;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "KServe REST API response json serialization benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("resolution",
+            "height and width of synthetic 1x3xRESOLUTIONxRESOLUTION image output",
+            cxxopts::value<uint32_t>()->default_value("224"),
+            "RESOLUTION")
+        ("niter",
+            "number of serialized responses per payload",
+            cxxopts::value<uint32_t>()->default_value("20"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t resolution = result->operator[]("resolution").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0 || resolution == 0) {
+        std::cerr << "niter and resolution have to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1000.0, 1000.0);
+    auto randomFloats = [&generator, &distribution](size_t count) {
+        std::vector<float> values(count);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+        return values;
+    };
+
+    ::KFSResponse classification;
+    classification.set_model_name("classification");
+    addOutput(classification, "scores", "FP32", {1, 1000}, randomFloats(1000));
+    std::vector<int64_t> labels(1000);
+    for (size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = static_cast<int64_t>(generator());
+    }
+    addOutput(classification, "labels", "INT64", {1, 1000}, labels);
+
+    ::KFSResponse image;
+    image.set_model_name("image");
+    const size_t imageElements = 3 * static_cast<size_t>(resolution) * resolution;
+    addOutput(image, "image", "FP32", {1, 3, resolution, resolution}, randomFloats(imageElements));
+
+    std::cout << "iterations: " << niter << " image elements: " << imageElements << std::endl;
+    int exitCode = EX_OK;
+    auto check = [&exitCode](int code) {
+        if (code != EX_OK) {
+            exitCode = code;
+        }
+    };
+    check(compare("KServe FP32 and INT64 1x1000", classification, niter * 100));
+    check(compare("KServe FP32 image", image, niter));
+    return exitCode;
+}
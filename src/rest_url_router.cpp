@@ -0,0 +1,260 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "rest_url_router.hpp"
+
+namespace ovms {
+
+namespace {
+class PathCursor {
+    std::string_view remaining;
+
+public:
+    explicit PathCursor(std::string_view path) :
+        remaining(path) {}
+
+    bool atEnd() const {
+        return remaining.empty();
+    }
+
+    bool consume(std::string_view literal) {
+        if (remaining.substr(0, literal.size()) != literal) {
+            return false;
+        }
+        remaining.remove_prefix(literal.size());
+        return true;
+    }
+
+    // TFS endpoints accept single arbitrary character other than line terminator before path
+    bool consumeWithOptionalPrefix(std::string_view literal) {
+        if (consume(literal)) {
+            return true;
+        }
+        if (remaining.empty() || remaining[0] == '\n' || remaining[0] == '\r' || remaining.substr(1, literal.size()) != literal) {
+            return false;
+        }
+        remaining.remove_prefix(1 + literal.size());
+        return true;
+    }
+
+    // consumes at least one character, up to first of separators
+    bool consumeUntil(std::string_view separators, std::string_view& token) {
+        size_t length = remaining.find_first_of(separators);
+        if (length == std::string_view::npos) {
+            length = remaining.size();
+        }
+        return consumeFirst(length, token);
+    }
+
+    template <typename Predicate>
+    bool consumeWhile(Predicate predicate, std::string_view& token) {
+        size_t length = 0;
+        while (length < remaining.size() && predicate(static_cast<unsigned char>(remaining[length]))) {
+            ++length;
+        }
+        return consumeFirst(length, token);
+    }
+
+private:
+    bool consumeFirst(size_t length, std::string_view& token) {
+        if (length == 0) {
+            return false;
+        }
+        token = remaining.substr(0, length);
+        remaining.remove_prefix(length);
+        return true;
+    }
+};
+
+// same character classes as \d and \w in regular expressions, independent of locale
+bool isDigit(unsigned char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool isWordCharacter(unsigned char c) {
+    return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+// optional /versions/<version> part, cursor is left untouched if it does not match
+void consumeVersion(PathCursor& cursor, RestUrlComponents& components) {
+    PathCursor attempt = cursor;
+    if (attempt.consume("/versions/") && attempt.consumeWhile(isDigit, components.modelVersion)) {
+        cursor = attempt;
+    }
+}
+
+// optional /versions/<version> or /labels/<label> part, cursor is left untouched if it does not match
+void consumeVersionOrLabel(PathCursor& cursor, RestUrlComponents& components) {
+    consumeVersion(cursor, components);
+    if (!components.modelVersion.empty()) {
+        return;
+    }
+    PathCursor attempt = cursor;
+    if (attempt.consume("/labels/") && attempt.consumeWhile(isWordCharacter, components.modelVersionLabel)) {
+        cursor = attempt;
+    }
+}
+
+bool matchModelStatusSuffix(PathCursor cursor, RestUrlComponents& components) {
+    consumeVersionOrLabel(cursor, components);
+    if (cursor.consume("/metadata")) {
+        components.modelSubresource = "metadata";
+    }
+    return cursor.atEnd();
+}
+
+bool matchKFSModelPrefix(PathCursor& cursor, RestUrlComponents& components) {
+    if (!cursor.consume("/v2/models/") || !cursor.consumeUntil("/", components.modelName)) {
+        return false;
+    }
+    consumeVersion(cursor, components);
+    return true;
+}
+
+// /v2/systemsharedmemory[/region/<name>]/<action>
+bool matchKFSSystemSharedMemoryUrl(std::string_view path, std::string_view action, bool regionRequired, RestUrlComponents& components) {
+    RestUrlComponents result;
+    PathCursor cursor(path);
+    if (!cursor.consume("/v2/systemsharedmemory")) {
+        return false;
+    }
+    PathCursor attempt = cursor;
+    if (attempt.consume("/region/") && attempt.consumeUntil("/", result.sharedMemoryRegionName)) {
+        cursor = attempt;
+    } else if (regionRequired) {
+        return false;
+    }
+    if (!cursor.consume("/") || !cursor.consume(action) || !cursor.atEnd()) {
+        return false;
+    }
+    components = result;
+    return true;
+}
+}  // namespace
+
+bool matchPredictionUrl(std::string_view path, RestUrlComponents& components) {
+    RestUrlComponents result;
+    PathCursor cursor(path);
+    if (!cursor.consumeWithOptionalPrefix("/v1/models/") || !cursor.consumeUntil("/:", result.modelName)) {
+        return false;
+    }
+    consumeVersionOrLabel(cursor, result);
+    if (!cursor.consume(":")) {
+        return false;
+    }
+    for (std::string_view method : {"classify", "regress", "predict"}) {
+        PathCursor attempt = cursor;
+        if (attempt.consume(method) && attempt.atEnd()) {
+            result.processingMethod = method;
+            components = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool matchModelStatusUrl(std::string_view path, RestUrlComponents& components) {
+    PathCursor cursor(path);
+    if (!cursor.consumeWithOptionalPrefix("/v1/models")) {
+        return false;
+    }
+    // model name is optional, so path without it is checked when the rest does not match
+    RestUrlComponents result;
+    PathCursor named = cursor;
+    if (named.consume("/") && named.consumeUntil("/:", result.modelName) && matchModelStatusSuffix(named, result)) {
+        components = result;
+        return true;
+    }
+    result = RestUrlComponents();
+    if (matchModelStatusSuffix(cursor, result)) {
+        components = result;
+        return true;
+    }
+    return false;
+}
+
+bool matchConfigReloadUrl(std::string_view path) {
+    PathCursor cursor(path);
+    return cursor.consumeWithOptionalPrefix("/v1/config/reload") && cursor.atEnd();
+}
+
+bool matchConfigStatusUrl(std::string_view path) {
+    PathCursor cursor(path);
+    return cursor.consumeWithOptionalPrefix("/v1/config") && cursor.atEnd();
+}
+
+bool matchMetricsUrl(std::string_view path) {
+    PathCursor cursor(path);
+    return cursor.consumeWithOptionalPrefix("/metrics") && cursor.atEnd();
+}
+
+bool matchKFSModelReadyUrl(std::string_view path, RestUrlComponents& components) {
+    RestUrlComponents result;
+    PathCursor cursor(path);
+    if (!matchKFSModelPrefix(cursor, result) || !cursor.consume("/ready") || !cursor.atEnd()) {
+        return false;
+    }
+    components = result;
+    return true;
+}
+
+bool matchKFSModelMetadataUrl(std::string_view path, RestUrlComponents& components) {
+    RestUrlComponents result;
+    PathCursor cursor(path);
+    if (!matchKFSModelPrefix(cursor, result)) {
+        return false;
+    }
+    cursor.consume("/");
+    if (!cursor.atEnd()) {
+        return false;
+    }
+    components = result;
+    return true;
+}
+
+bool matchKFSInferUrl(std::string_view path, RestUrlComponents& components) {
+    RestUrlComponents result;
+    PathCursor cursor(path);
+    if (!matchKFSModelPrefix(cursor, result) || !cursor.consume("/infer") || !cursor.atEnd()) {
+        return false;
+    }
+    components = result;
+    return true;
+}
+
+bool matchKFSServerReadyUrl(std::string_view path) {
+    return path == "/v2/health/ready";
+}
+
+bool matchKFSServerLiveUrl(std::string_view path) {
+    return path == "/v2/health/live";
+}
+
+bool matchKFSServerMetadataUrl(std::string_view path) {
+    return path == "/v2";
+}
+
+bool matchKFSSystemSharedMemoryStatusUrl(std::string_view path, RestUrlComponents& components) {
+    return matchKFSSystemSharedMemoryUrl(path, "status", false, components);
+}
+
+bool matchKFSSystemSharedMemoryRegisterUrl(std::string_view path, RestUrlComponents& components) {
+    return matchKFSSystemSharedMemoryUrl(path, "register", true, components);
+}
+
+bool matchKFSSystemSharedMemoryUnregisterUrl(std::string_view path, RestUrlComponents& components) {
+    return matchKFSSystemSharedMemoryUrl(path, "unregister", false, components);
+}
+}  // namespace ovms
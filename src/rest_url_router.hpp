@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string_view>
+
+namespace ovms {
+
+/**
+     * @brief Parts of REST API url extracted by url matchers. Views point into matched path.
+     */
+struct RestUrlComponents {
+    std::string_view modelName;
+    std::string_view modelVersion;
+    std::string_view modelVersionLabel;
+    std::string_view processingMethod;
+    std::string_view modelSubresource;
+    std::string_view sharedMemoryRegionName;
+};
+
+// Url matchers walk the path segment by segment without allocations. Each one accepts exactly the same
+// paths as the regular expression previously used for the endpoint:
+// TFS endpoints may be preceded by a single arbitrary character, model names cannot contain '/' or ':',
+// KServe model names cannot contain '/', versions consist of digits and labels of word characters.
+
+// (.?)/v1/models/<name>[/versions/<version>|/labels/<label>]:(classify|regress|predict)
+bool matchPredictionUrl(std::string_view path, RestUrlComponents& components);
+// (.?)/v1/models[/<name>][/versions/<version>|/labels/<label>][/metadata]
+bool matchModelStatusUrl(std::string_view path, RestUrlComponents& components);
+// (.?)/v1/config/reload
+bool matchConfigReloadUrl(std::string_view path);
+// (.?)/v1/config
+bool matchConfigStatusUrl(std::string_view path);
+// (.?)/metrics
+bool matchMetricsUrl(std::string_view path);
+
+// /v2/models/<name>[/versions/<version>]/ready
+bool matchKFSModelReadyUrl(std::string_view path, RestUrlComponents& components);
+// /v2/models/<name>[/versions/<version>][/]
+bool matchKFSModelMetadataUrl(std::string_view path, RestUrlComponents& components);
+// /v2/models/<name>[/versions/<version>]/infer
+bool matchKFSInferUrl(std::string_view path, RestUrlComponents& components);
+// /v2/health/ready
+bool matchKFSServerReadyUrl(std::string_view path);
+// /v2/health/live
+bool matchKFSServerLiveUrl(std::string_view path);
+// /v2
+bool matchKFSServerMetadataUrl(std::string_view path);
+
+// KServe system shared memory extension, region names cannot contain '/'
+// /v2/systemsharedmemory[/region/<name>]/status
+bool matchKFSSystemSharedMemoryStatusUrl(std::string_view path, RestUrlComponents& components);
+// /v2/systemsharedmemory/region/<name>/register
+bool matchKFSSystemSharedMemoryRegisterUrl(std::string_view path, RestUrlComponents& components);
+// /v2/systemsharedmemory[/region/<name>]/unregister
+bool matchKFSSystemSharedMemoryUnregisterUrl(std::string_view path, RestUrlComponents& components);
+}  // namespace ovms
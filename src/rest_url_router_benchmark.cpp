@@ -0,0 +1,234 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "rest_url_router.hpp"
+
+namespace {
+
+enum Route {
+    Predict,
+    ModelStatus,
+    ConfigReload,
+    ConfigStatus,
+    KFSModelReady,
+    KFSModelMetadata,
+    KFSInfer,
+    KFSServerReady,
+    KFSServerLive,
+    KFSServerMetadata,
+    Metrics,
+    UnsupportedMethod,
+    InvalidUrl
+};
+
+// Previous HttpRestApiHandler url matching with regular expressions, kept only as a reference point for comparison
+class RegexRouter {
+    const std::regex predictionRegex{R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))"};
+    const std::regex modelstatusRegex{R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata))?)"};
+    const std::regex configReloadRegex{R"((.?)\/v1\/config\/reload)"};
+    const std::regex configStatusRegex{R"((.?)\/v1\/config)"};
+    const std::regex kfs_modelreadyRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(ready)))"};
+    const std::regex kfs_modelmetadataRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/)?)"};
+    const std::regex kfs_inferRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(infer)))"};
+    const std::regex kfs_serverreadyRegex{R"(/v2/health/ready)"};
+    const std::regex kfs_serverliveRegex{R"(/v2/health/live)"};
+    const std::regex kfs_servermetadataRegex{R"(/v2)"};
+    const std::regex metricsRegex{R"((.?)\/metrics)"};
+
+public:
+    Route route(const std::string& method, const std::string& path, std::string& modelName) const {
+        std::smatch sm;
+        if (method == "POST") {
+            if (std::regex_match(path, sm, predictionRegex)) {
+                modelName = sm[2];
+                return Predict;
+            }
+            if (std::regex_match(path, sm, kfs_inferRegex, std::regex_constants::match_any)) {
+                modelName = sm[1];
+                return KFSInfer;
+            }
+            if (std::regex_match(path, sm, configReloadRegex))
+                return ConfigReload;
+            if (std::regex_match(path, sm, modelstatusRegex))
+                return UnsupportedMethod;
+        } else {
+            if (std::regex_match(path, sm, modelstatusRegex)) {
+                modelName = sm[2];
+                return ModelStatus;
+            }
+            if (std::regex_match(path, sm, configStatusRegex))
+                return ConfigStatus;
+            if (std::regex_match(path, sm, kfs_serverliveRegex))
+                return KFSServerLive;
+            if (std::regex_match(path, sm, kfs_serverreadyRegex))
+                return KFSServerReady;
+            if (std::regex_match(path, sm, kfs_servermetadataRegex))
+                return KFSServerMetadata;
+            if (std::regex_match(path, sm, kfs_modelmetadataRegex)) {
+                modelName = sm[1];
+                return KFSModelMetadata;
+            }
+            if (std::regex_match(path, sm, kfs_modelreadyRegex)) {
+                modelName = sm[1];
+                return KFSModelReady;
+            }
+            if (std::regex_match(path, sm, predictionRegex))
+                return UnsupportedMethod;
+            if (std::regex_match(path, sm, metricsRegex))
+                return Metrics;
+        }
+        return InvalidUrl;
+    }
+};
+
+Route routeWithMatchers(const std::string& method, const std::string& path, std::string& modelName) {
+    ovms::RestUrlComponents components;
+    if (method == "POST") {
+        if (ovms::matchPredictionUrl(path, components)) {
+            modelName = components.modelName;
+            return Predict;
+        }
+        if (ovms::matchKFSInferUrl(path, components)) {
+            modelName = components.modelName;
+            return KFSInfer;
+        }
+        if (ovms::matchConfigReloadUrl(path))
+            return ConfigReload;
+        if (ovms::matchModelStatusUrl(path, components))
+            return UnsupportedMethod;
+    } else {
+        if (ovms::matchModelStatusUrl(path, components)) {
+            modelName = components.modelName;
+            return ModelStatus;
+        }
+        if (ovms::matchConfigStatusUrl(path))
+            return ConfigStatus;
+        if (ovms::matchKFSServerLiveUrl(path))
+            return KFSServerLive;
+        if (ovms::matchKFSServerReadyUrl(path))
+            return KFSServerReady;
+        if (ovms::matchKFSServerMetadataUrl(path))
+            return KFSServerMetadata;
+        if (ovms::matchKFSModelMetadataUrl(path, components)) {
+            modelName = components.modelName;
+            return KFSModelMetadata;
+        }
+        if (ovms::matchKFSModelReadyUrl(path, components)) {
+            modelName = components.modelName;
+            return KFSModelReady;
+        }
+        if (ovms::matchPredictionUrl(path, components))
+            return UnsupportedMethod;
+        if (ovms::matchMetricsUrl(path))
+            return Metrics;
+    }
+    return InvalidUrl;
+}
+
+template <typename Function>
+double measureNanoseconds(uint32_t iterations, Function function) {
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / static_cast<double>(iterations);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "REST API url routing benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("niter",
+            "number of routed requests per endpoint",
+            cxxopts::value<uint32_t>()->default_value("100000"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0) {
+        std::cerr << "niter has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    const std::vector<std::pair<std::string, std::string>> requests{
+        {"POST", "/v1/models/resnet:predict"},
+        {"POST", "/v1/models/resnet/versions/1:predict"},
+        {"POST", "/v1/models/resnet/labels/stable:classify"},
+        {"GET", "/v1/models/resnet"},
+        {"GET", "/v1/models/resnet/versions/1/metadata"},
+        {"POST", "/v1/config/reload"},
+        {"GET", "/v1/config"},
+        {"POST", "/v2/models/resnet/infer"},
+        {"POST", "/v2/models/resnet/versions/1/infer"},
+        {"GET", "/v2/models/resnet/ready"},
+        {"GET", "/v2/models/resnet/versions/1/ready"},
+        {"GET", "/v2/models/resnet/versions/1"},
+        {"GET", "/v2/health/ready"},
+        {"GET", "/v2/health/live"},
+        {"GET", "/v2"},
+        {"GET", "/metrics"},
+        {"GET", "/v1/models/resnet:predict"},
+        {"GET", "/v3/unknown"}};
+
+    RegexRouter regexRouter;
+    std::cout << "iterations: " << niter << std::endl;
+    int exitCode = EX_OK;
+    for (const auto& [method, path] : requests) {
+        std::string regexModelName, matcherModelName;
+        Route regexRoute = regexRouter.route(method, path, regexModelName);
+        Route matcherRoute = routeWithMatchers(method, path, matcherModelName);
+        if (regexRoute != matcherRoute || regexModelName != matcherModelName) {
+            std::cerr << method << " " << path << ": routing differs" << std::endl;
+            exitCode = EX_SOFTWARE;
+        }
+        double regexTime = measureNanoseconds(niter, [&regexRouter, &method = method, &path = path]() {
+            std::string modelName;
+            regexRouter.route(method, path, modelName);
+        });
+        double matcherTime = measureNanoseconds(niter, [&method = method, &path = path]() {
+            std::string modelName;
+            routeWithMatchers(method, path, modelName);
+        });
+        std::cout << method << " " << path << ": regex " << regexTime << " ns, matchers " << matcherTime << " ns" << std::endl;
+    }
+    return exitCode;
+}
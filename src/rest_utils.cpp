@@ -15,20 +15,36 @@
 //*****************************************************************************
 #include "rest_utils.hpp"
 
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <deque>
 #include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <spdlog/spdlog.h>
 
-#include "absl/strings/escaping.h"
+#include "base64_decoder.hpp"
+#include "float_formatter.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
 #include "tensorflow_serving/util/json_tensor.h"
 #pragma GCC diagnostic pop
+#include "capi_frontend/buffer.hpp"
+#include "capi_frontend/capi_utils.hpp"
+#include "capi_frontend/inferenceresponse.hpp"
+#include "capi_frontend/inferencetensor.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "precision.hpp"
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
@@ -212,7 +228,8 @@ Status makeJsonFromPredictResponse(
     return StatusCode::OK;
 }
 
-static Status parseResponseParameters(const ::KFSResponse& response_proto, rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer) {
+template <typename WriterType>
+static Status parseResponseParameters(const ::KFSResponse& response_proto, WriterType& writer) {
     if (response_proto.parameters_size() > 0) {
         writer.Key("parameters");
         writer.StartObject();
@@ -224,7 +241,7 @@ static Status parseResponseParameters(const ::KFSResponse& response_proto, rapid
                 writer.Bool(protoParameter.second.bool_param());
                 break;
             case inference::InferParameter::ParameterChoiceCase::kInt64Param:
-                writer.Int(protoParameter.second.int64_param());
+                writer.Int64(protoParameter.second.int64_param());
                 break;
             case inference::InferParameter::ParameterChoiceCase::kStringParam:
                 writer.String(protoParameter.second.string_param().c_str());
@@ -239,7 +256,8 @@ static Status parseResponseParameters(const ::KFSResponse& response_proto, rapid
     return StatusCode::OK;
 }
 
-static Status parseOutputParameters(const inference::ModelInferResponse_InferOutputTensor& output, rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer, int binaryOutputSize) {
+template <typename WriterType>
+static Status parseOutputParameters(const inference::ModelInferResponse_InferOutputTensor& output, WriterType& writer, int binaryOutputSize) {
     if (output.parameters_size() > 0 || binaryOutputSize > 0) {
         writer.Key("parameters");
         writer.StartObject();
@@ -251,7 +269,7 @@ static Status parseOutputParameters(const inference::ModelInferResponse_InferOut
                 writer.Bool(protoParameter.second.bool_param());
                 break;
             case inference::InferParameter::ParameterChoiceCase::kInt64Param:
-                writer.Int(protoParameter.second.int64_param());
+                writer.Int64(protoParameter.second.int64_param());
                 break;
             case inference::InferParameter::ParameterChoiceCase::kStringParam:
                 writer.String(protoParameter.second.string_param().c_str());
@@ -270,11 +288,93 @@ static Status parseOutputParameters(const inference::ModelInferResponse_InferOut
     return StatusCode::OK;
 }
 
-static void appendBinaryOutput(std::string& bytesOutputsBuffer, char* output, size_t outputSize) {
+/**
+     * @brief Collects binary outputs appended after JSON part of response. Data is referenced in response proto
+     * and copied only once, directly into the response body.
+     */
+class BinaryOutputsBuffer {
+    std::vector<std::string_view> parts;
+    // length prefixes of BYTES outputs serialized from bytes_contents; deque keeps their addresses stable
+    std::deque<uint32_t> lengths;
+    size_t size = 0;
+
+public:
+    void append(const char* data, size_t dataSize) {
+        parts.emplace_back(data, dataSize);
+        size += dataSize;
+    }
+    void appendLength(uint32_t length) {
+        lengths.push_back(length);
+        append(reinterpret_cast<const char*>(&lengths.back()), sizeof(length));
+    }
+    size_t getSize() const {
+        return size;
+    }
+    void appendTo(std::string& destination) const {
+        for (const auto& part : parts) {
+            destination.append(part.data(), part.size());
+        }
+    }
+};
+
+static void appendBinaryOutput(BinaryOutputsBuffer& bytesOutputsBuffer, const char* output, size_t outputSize) {
     bytesOutputsBuffer.append(output, outputSize);
 }
 
-#define PARSE_OUTPUT_DATA(CONTENTS_FIELD, DATATYPE, WRITER_TYPE)                                                                      \
+// Enough for any number written by formatJsonNumber together with array separator
+constexpr size_t JSON_NUMBER_MAX_LENGTH = 40;
+static_assert(JSON_NUMBER_MAX_LENGTH >= FORMATTED_FLOAT_MAX_LENGTH + 2);
+
+template <typename T>
+static char* formatJsonNumber(T value, char* buffer) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!std::isfinite(value)) {
+            // JSON has no representation of non-finite numbers
+            constexpr std::string_view null = "null";
+            std::memcpy(buffer, null.data(), null.size());
+            return buffer + null.size();
+        }
+        if constexpr (std::is_same_v<T, float>) {
+            return formatFloat(value, buffer);
+        } else {
+            return rapidjson::internal::dtoa(value, buffer);
+        }
+    } else {
+        return std::to_chars(buffer, buffer + JSON_NUMBER_MAX_LENGTH, value).ptr;
+    }
+}
+
+/**
+     * @brief Writes numeric tensor data as json array with a single writer call. Elements are formatted
+     * directly into writer output buffer instead of passing each of them through the writer.
+     * Integers and doubles are formatted the same way as in rapidjson writer, floats with their shortest
+     * representation. NaN and infinities are written as null.
+     */
+template <typename T, typename WriterType>
+static void writeNumbers(WriterType& writer, rapidjson::StringBuffer& buffer, const char* data, size_t count) {
+    constexpr std::string_view separator = std::is_same_v<WriterType, rapidjson::PrettyWriter<rapidjson::StringBuffer>> ? ", " : ",";
+    writer.RawValue("[", 1, rapidjson::kArrayType);
+    for (size_t i = 0; i < count; ++i) {
+        char* begin = buffer.Push(JSON_NUMBER_MAX_LENGTH);
+        char* end = begin;
+        if (i > 0) {
+            std::memcpy(end, separator.data(), separator.size());
+            end += separator.size();
+        }
+        T value;
+        std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+        end = formatJsonNumber(value, end);
+        buffer.Pop(JSON_NUMBER_MAX_LENGTH - (end - begin));
+    }
+    buffer.Put(']');
+}
+
+template <typename T, typename WriterType>
+static void writeNumbers(WriterType& writer, rapidjson::StringBuffer& buffer, const google::protobuf::RepeatedField<T>& field) {
+    writeNumbers<T>(writer, buffer, reinterpret_cast<const char*>(field.data()), field.size());
+}
+
+#define PARSE_OUTPUT_DATA(CONTENTS_FIELD, DATATYPE)                                                                                   \
     if (seekDataInValField) {                                                                                                         \
         auto status = checkValField(tensor.contents().CONTENTS_FIELD##_size(), expectedElementsNumber);                               \
         if (!status.ok())                                                                                                             \
@@ -282,16 +382,14 @@ static void appendBinaryOutput(std::string& bytesOutputsBuffer, char* output, si
         if (binaryOutput) {                                                                                                           \
             appendBinaryOutput(bytesOutputsBuffer, (char*)tensor.contents().CONTENTS_FIELD().data(), expectedContentSize);            \
         } else {                                                                                                                      \
-            for (auto& number : tensor.contents().CONTENTS_FIELD()) {                                                                 \
-                writer.WRITER_TYPE(number);                                                                                           \
-            }                                                                                                                         \
+            writeNumbers(writer, buffer, tensor.contents().CONTENTS_FIELD());                                                         \
         }                                                                                                                             \
     } else {                                                                                                                          \
         if (binaryOutput) {                                                                                                           \
             appendBinaryOutput(bytesOutputsBuffer, (char*)response_proto.raw_output_contents(tensor_it).data(), expectedContentSize); \
         } else {                                                                                                                      \
-            for (size_t i = 0; i < response_proto.raw_output_contents(tensor_it).size(); i += sizeof(DATATYPE))                       \
-                writer.WRITER_TYPE(*(reinterpret_cast<const DATATYPE*>(response_proto.raw_output_contents(tensor_it).data() + i)));   \
+            writeNumbers<DATATYPE>(writer, buffer, response_proto.raw_output_contents(tensor_it).data(),                              \
+                response_proto.raw_output_contents(tensor_it).size() / sizeof(DATATYPE));                                            \
         }                                                                                                                             \
     }
 
@@ -303,8 +401,7 @@ static void appendBinaryOutput(std::string& bytesOutputsBuffer, char* output, si
                 uint32_t length = static_cast<uint32_t>(                                                                                                               \
                     sentence.size());                                                                                                                                  \
                 expectedContentSize += length + 4;                                                                                                                     \
-                appendBinaryOutput(bytesOutputsBuffer,                                                                                                                 \
-                    (char*)&length, sizeof(length));                                                                                                                   \
+                bytesOutputsBuffer.appendLength(length);                                                                                                               \
                 appendBinaryOutput(                                                                                                                                    \
                     bytesOutputsBuffer,                                                                                                                                \
                     (char*)sentence.data(),                                                                                                                            \
@@ -332,7 +429,8 @@ static void appendBinaryOutput(std::string& bytesOutputsBuffer, char* output, si
         }                                                                                                                                                              \
     }
 
-static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer, std::string& bytesOutputsBuffer, const std::set<std::string>& binaryOutputsNames) {
+template <typename WriterType>
+static Status parseOutputs(const ::KFSResponse& response_proto, WriterType& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& bytesOutputsBuffer, const std::set<std::string>& binaryOutputsNames) {
     writer.Key("outputs");
     writer.StartArray();
 
@@ -350,7 +448,9 @@ static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::Prett
         }
         size_t expectedElementsNumber = dataTypeSize > 0 ? expectedContentSize / dataTypeSize : 0;
 
-        if (!seekDataInValField && (tensor.datatype() != "BYTES" && response_proto.raw_output_contents(tensor_it).size() != expectedContentSize))
+        // data of output in shared memory was written to client region, only metadata is returned
+        const bool sharedMemoryOutput = usesSharedMemory(tensor.parameters());
+        if (!seekDataInValField && !sharedMemoryOutput && (tensor.datatype() != "BYTES" && response_proto.raw_output_contents(tensor_it).size() != expectedContentSize))
             return StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE;
         writer.StartObject();
         writer.Key("name");
@@ -363,39 +463,50 @@ static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::Prett
         writer.EndArray();
         writer.Key("datatype");
         writer.String(tensor.datatype().c_str());
+        if (sharedMemoryOutput) {
+            auto status = parseOutputParameters(tensor, writer, 0);
+            if (!status.ok()) {
+                return status;
+            }
+            writer.EndObject();
+            tensor_it++;
+            continue;
+        }
         bool binaryOutput = ((binaryOutputsNames.find(tensor.name().c_str()) != binaryOutputsNames.end()));
         if (!binaryOutput) {
             writer.Key("data");
-            writer.StartArray();
         }
         if (tensor.datatype() == "FP32") {
-            PARSE_OUTPUT_DATA(fp32_contents, float, Double)
+            PARSE_OUTPUT_DATA(fp32_contents, float)
         } else if (tensor.datatype() == "INT32") {
-            PARSE_OUTPUT_DATA(int_contents, int32_t, Int)
+            PARSE_OUTPUT_DATA(int_contents, int32_t)
         } else if (tensor.datatype() == "INT16") {
-            PARSE_OUTPUT_DATA(int_contents, int16_t, Int)
+            PARSE_OUTPUT_DATA(int_contents, int16_t)
         } else if (tensor.datatype() == "INT8") {
-            PARSE_OUTPUT_DATA(int_contents, int8_t, Int)
+            PARSE_OUTPUT_DATA(int_contents, int8_t)
         } else if (tensor.datatype() == "UINT32") {
-            PARSE_OUTPUT_DATA(uint_contents, uint32_t, Uint)
+            PARSE_OUTPUT_DATA(uint_contents, uint32_t)
         } else if (tensor.datatype() == "UINT16") {
-            PARSE_OUTPUT_DATA(uint_contents, uint16_t, Uint)
+            PARSE_OUTPUT_DATA(uint_contents, uint16_t)
         } else if (tensor.datatype() == "UINT8") {
-            PARSE_OUTPUT_DATA(uint_contents, uint8_t, Uint)
+            PARSE_OUTPUT_DATA(uint_contents, uint8_t)
         } else if (tensor.datatype() == "FP64") {
-            PARSE_OUTPUT_DATA(fp64_contents, double, Double)
+            PARSE_OUTPUT_DATA(fp64_contents, double)
         } else if (tensor.datatype() == "INT64") {
-            PARSE_OUTPUT_DATA(int64_contents, int64_t, Int64)
+            PARSE_OUTPUT_DATA(int64_contents, int64_t)
         } else if (tensor.datatype() == "UINT64") {
-            PARSE_OUTPUT_DATA(uint64_contents, uint64_t, Uint64)
+            PARSE_OUTPUT_DATA(uint64_contents, uint64_t)
         } else if (tensor.datatype() == "BYTES") {
+            if (!binaryOutput) {
+                writer.StartArray();
+            }
             PARSE_OUTPUT_DATA_STRING(bytes_contents, String)
+            if (!binaryOutput) {
+                writer.EndArray();
+            }
         } else {
             return StatusCode::REST_UNSUPPORTED_PRECISION;
         }
-        if (!binaryOutput) {
-            writer.EndArray();
-        }
         auto status = parseOutputParameters(tensor, writer, binaryOutput ? expectedContentSize : 0);
         if (!status.ok()) {
             return status;
@@ -407,18 +518,8 @@ static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::Prett
     return StatusCode::OK;
 }
 
-Status makeJsonFromPredictResponse(
-    const ::KFSResponse& response_proto,
-    std::string* response_json,
-    std::optional<int>& inferenceHeaderContentLength,
-    const std::set<std::string>& requestedBinaryOutputsNames) {
-    Timer<TIMER_END> timer;
-    using std::chrono::microseconds;
-    timer.start(CONVERT);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
-    writer.SetFormatOptions(rapidjson::kFormatSingleLineArray);
+template <typename WriterType>
+static Status writeResponse(const ::KFSResponse& response_proto, WriterType& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& binaryOutputsBuffer, const std::set<std::string>& requestedBinaryOutputsNames) {
     writer.StartObject();
     writer.Key("model_name");
     writer.String(response_proto.model_name().c_str());
@@ -441,26 +542,208 @@ Status makeJsonFromPredictResponse(
         return StatusCode::REST_PROTO_TO_STRING_ERROR;
     }
 
-    std::string binaryOutputsBuffer;
-    status = parseOutputs(response_proto, writer, binaryOutputsBuffer, requestedBinaryOutputsNames);
+    status = parseOutputs(response_proto, writer, buffer, binaryOutputsBuffer, requestedBinaryOutputsNames);
     if (!status.ok()) {
         return status;
     }
 
     writer.EndObject();
-    response_json->assign(buffer.GetString());
-    if (binaryOutputsBuffer.size() > 0) {
+    return StatusCode::OK;
+}
+
+/**
+     * @brief Serializes response with writer selected by pretty flag. Binary outputs collected by write
+     * function are appended after JSON part and their presence is reported with JSON part length.
+     */
+template <typename WriteFunction>
+static Status makeJson(std::string* response_json, std::optional<int>& inferenceHeaderContentLength, bool pretty, WriteFunction&& write) {
+    Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
+    timer.start(CONVERT);
+
+    rapidjson::StringBuffer buffer;
+    BinaryOutputsBuffer binaryOutputsBuffer;
+    Status status;
+    if (pretty) {
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+        writer.SetFormatOptions(rapidjson::kFormatSingleLineArray);
+        status = write(writer, buffer, binaryOutputsBuffer);
+    } else {
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        status = write(writer, buffer, binaryOutputsBuffer);
+    }
+    if (!status.ok()) {
+        return status;
+    }
+
+    response_json->reserve(buffer.GetSize() + binaryOutputsBuffer.getSize());
+    response_json->assign(buffer.GetString(), buffer.GetSize());
+    if (binaryOutputsBuffer.getSize() > 0) {
         inferenceHeaderContentLength = response_json->length();
     }
-    response_json->append(binaryOutputsBuffer);
+    binaryOutputsBuffer.appendTo(*response_json);
 
     timer.stop(CONVERT);
-    SPDLOG_DEBUG("GRPC to HTTP response conversion: {:.3f} ms", timer.elapsed<microseconds>(CONVERT) / 1000);
+    SPDLOG_DEBUG("Response to HTTP response conversion: {:.3f} ms", timer.elapsed<microseconds>(CONVERT) / 1000);
+
+    return StatusCode::OK;
+}
+
+Status makeJsonFromPredictResponse(
+    const ::KFSResponse& response_proto,
+    std::string* response_json,
+    std::optional<int>& inferenceHeaderContentLength,
+    const std::set<std::string>& requestedBinaryOutputsNames,
+    bool pretty) {
+    return makeJson(response_json, inferenceHeaderContentLength, pretty, [&](auto& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& binaryOutputsBuffer) {
+        return writeResponse(response_proto, writer, buffer, binaryOutputsBuffer, requestedBinaryOutputsNames);
+    });
+}
+
+template <typename WriterType>
+static Status writeTensorData(const InferenceTensor& tensor, WriterType& writer, rapidjson::StringBuffer& buffer, size_t count) {
+    const char* data = static_cast<const char*>(tensor.getBuffer()->data());
+    switch (getOVMSDataTypeAsPrecision(tensor.getDataType())) {
+    case Precision::FP32:
+        writeNumbers<float>(writer, buffer, data, count);
+        break;
+    case Precision::I32:
+        writeNumbers<int32_t>(writer, buffer, data, count);
+        break;
+    case Precision::I16:
+        writeNumbers<int16_t>(writer, buffer, data, count);
+        break;
+    case Precision::I8:
+        writeNumbers<int8_t>(writer, buffer, data, count);
+        break;
+    case Precision::U32:
+        writeNumbers<uint32_t>(writer, buffer, data, count);
+        break;
+    case Precision::U16:
+        writeNumbers<uint16_t>(writer, buffer, data, count);
+        break;
+    case Precision::U8:
+        writeNumbers<uint8_t>(writer, buffer, data, count);
+        break;
+    case Precision::FP64:
+        writeNumbers<double>(writer, buffer, data, count);
+        break;
+    case Precision::I64:
+        writeNumbers<int64_t>(writer, buffer, data, count);
+        break;
+    case Precision::U64:
+        writeNumbers<uint64_t>(writer, buffer, data, count);
+        break;
+    default:
+        return StatusCode::REST_UNSUPPORTED_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+template <typename WriterType>
+static Status writeOutput(const std::string& name, const InferenceTensor& tensor, WriterType& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& binaryOutputsBuffer, bool binaryOutput) {
+    const KFSDataType& datatype = ovmsPrecisionToKFSPrecision(getOVMSDataTypeAsPrecision(tensor.getDataType()));
+    const size_t dataTypeSize = KFSDataTypeSize(datatype);
+    size_t expectedContentSize = dataTypeSize;
+    for (auto dim : tensor.getShape()) {
+        expectedContentSize *= dim;
+    }
+    if (tensor.getBuffer() == nullptr) {
+        return StatusCode::REST_SERIALIZE_NO_DATA;
+    }
+    if (dataTypeSize == 0 || tensor.getBuffer()->getByteSize() != expectedContentSize) {
+        return StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE;
+    }
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(name.c_str(), name.size());
+    writer.Key("shape");
+    writer.StartArray();
+    for (auto dim : tensor.getShape()) {
+        writer.Int64(dim);
+    }
+    writer.EndArray();
+    writer.Key("datatype");
+    writer.String(datatype.c_str(), datatype.size());
+    if (binaryOutput) {
+        appendBinaryOutput(binaryOutputsBuffer, static_cast<const char*>(tensor.getBuffer()->data()), expectedContentSize);
+        writer.Key("parameters");
+        writer.StartObject();
+        writer.Key("binary_data_size");
+        writer.Uint64(expectedContentSize);
+        writer.EndObject();
+    } else {
+        writer.Key("data");
+        auto status = writeTensorData(tensor, writer, buffer, expectedContentSize / dataTypeSize);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    writer.EndObject();
+    return StatusCode::OK;
+}
+
+template <typename WriterType>
+static Status writeResponse(const InferenceResponse& response, const std::string& id, WriterType& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& binaryOutputsBuffer, const std::set<std::string>& requestedBinaryOutputsNames) {
+    writer.StartObject();
+    writer.Key("model_name");
+    writer.String(response.getServableName().c_str(), response.getServableName().size());
+    if (id.length() > 0) {
+        writer.Key("id");
+        writer.String(id.c_str(), id.size());
+    }
+    writer.Key("model_version");
+    writer.String(std::to_string(response.getServableVersion()).c_str());
 
+    if (response.getOutputCount() == 0) {
+        SPDLOG_ERROR("Creating json from tensors failed: No outputs found.");
+        return StatusCode::REST_PROTO_TO_STRING_ERROR;
+    }
+    writer.Key("outputs");
+    writer.StartArray();
+    for (uint32_t i = 0; i < response.getOutputCount(); ++i) {
+        const std::string* name = nullptr;
+        const InferenceTensor* tensor = nullptr;
+        auto status = response.getOutput(i, &name, &tensor);
+        if (!status.ok()) {
+            return status;
+        }
+        const bool binaryOutput = requestedBinaryOutputsNames.find(*name) != requestedBinaryOutputsNames.end();
+        status = writeOutput(*name, *tensor, writer, buffer, binaryOutputsBuffer, binaryOutput);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    writer.EndArray();
+
+    writer.EndObject();
     return StatusCode::OK;
 }
 
+Status makeJsonFromPredictResponse(
+    const InferenceResponse& response,
+    const std::string& id,
+    std::string* response_json,
+    std::optional<int>& inferenceHeaderContentLength,
+    const std::set<std::string>& requestedBinaryOutputsNames,
+    bool pretty) {
+    return makeJson(response_json, inferenceHeaderContentLength, pretty, [&](auto& writer, rapidjson::StringBuffer& buffer, BinaryOutputsBuffer& binaryOutputsBuffer) {
+        return writeResponse(response, id, writer, buffer, binaryOutputsBuffer, requestedBinaryOutputsNames);
+    });
+}
+
 Status decodeBase64(std::string& bytes, std::string& decodedBytes) {
-    return absl::Base64Unescape(bytes, &decodedBytes) ? StatusCode::OK : StatusCode::REST_BASE64_DECODE_ERROR;
+    return decodeBase64(bytes.data(), bytes.size(), decodedBytes);
+}
+
+Status decodeBase64(const char* bytes, size_t size, std::string& decodedBytes) {
+    decodedBytes.resize(base64DecodedMaxSize(size));
+    size_t decodedSize = 0;
+    if (!decodeBase64(bytes, size, decodedBytes.data(), decodedSize)) {
+        decodedBytes.clear();
+        return StatusCode::REST_BASE64_DECODE_ERROR;
+    }
+    decodedBytes.resize(decodedSize);
+    return StatusCode::OK;
 }
 }  // namespace ovms
@@ -26,6 +26,7 @@
 #include "rest_parser.hpp"
 
 namespace ovms {
+class InferenceResponse;
 class Status;
 Status makeJsonFromPredictResponse(
     tensorflow::serving::PredictResponse& response_proto,
@@ -36,8 +37,21 @@ Status makeJsonFromPredictResponse(
     const ::KFSResponse& response_proto,
     std::string* response_json,
     std::optional<int>& inferenceHeaderContentLength,
-    const std::set<std::string>& requestedBinaryOutputsNames = {});
+    const std::set<std::string>& requestedBinaryOutputsNames = {},
+    bool pretty = false);
+
+/**
+ * @brief Serializes response of inference served without response proto. Id is echoed from request.
+ */
+Status makeJsonFromPredictResponse(
+    const InferenceResponse& response,
+    const std::string& id,
+    std::string* response_json,
+    std::optional<int>& inferenceHeaderContentLength,
+    const std::set<std::string>& requestedBinaryOutputsNames = {},
+    bool pretty = false);
 
 Status decodeBase64(std::string& bytes, std::string& decodedBytes);
+Status decodeBase64(const char* bytes, size_t size, std::string& decodedBytes);
 
 }  // namespace ovms
@@ -83,6 +83,25 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 					"type": "integer",
 					"minimum": 0
 				},
+				"max_batch_size": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"max_queue_delay_us": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"shape_cache_size": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"accept_precisions": {
+					"type": "object",
+		"additionalProperties": {"anyOf": [
+						{"type": "string"},
+						{"type": "array", "items": {"type": "string"}}
+					]}
+				},
 				"custom_loader_options": {
 					"type": "object",
 												"required": ["loader_name"],
@@ -15,6 +15,11 @@
 //*****************************************************************************
 #include "serialization.hpp"
 
+#include <cstring>
+#include <sstream>
+
+#include "capi_frontend/buffer.hpp"
+#include "element_conversion.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "ov_utils.hpp"
 #include "precision.hpp"
@@ -186,36 +191,58 @@ static void serializeStringContent(std::string* content, ov::Tensor& tensor) {
         content->append((char*)tensor.data() + i * maxStringLen, strLen);
     }
 }
-#define SERIALIZE_BY_DATATYPE(contents, datatype)                                  \
-    for (size_t i = 0; i < tensor.get_byte_size(); i += sizeof(datatype)) {        \
-        auto value = responseOutput.mutable_contents()->contents()->Add();         \
-        *value = (*(reinterpret_cast<const datatype*>((char*)tensor.data() + i))); \
-    }
+template <typename ContentType, typename TensorType>
+static void serializeTypedContent(google::protobuf::RepeatedField<ContentType>* contents, const ov::Tensor& tensor) {
+    const size_t elementsCount = tensor.get_byte_size() / sizeof(TensorType);
+    const TensorType* data = reinterpret_cast<const TensorType*>(tensor.data());
+    contents->Reserve(contents->size() + elementsCount);
+    convertElements<ContentType, TensorType>(data, contents->AddNAlreadyReserved(elementsCount), elementsCount);
+}
 
-static void serializeContent(::inference::ModelInferResponse::InferOutputTensor& responseOutput, ov::Tensor& tensor) {
+static void serializeContent(::inference::ModelInferResponse::InferOutputTensor& responseOutput, const std::shared_ptr<const TensorInfo>& servableOutput, ov::Tensor& tensor) {
     OVMS_PROFILE_FUNCTION();
-    if (responseOutput.datatype() == "FP32") {
-        SERIALIZE_BY_DATATYPE(mutable_fp32_contents, float)
-    } else if (responseOutput.datatype() == "INT64") {
-        SERIALIZE_BY_DATATYPE(mutable_int64_contents, int64_t)
-    } else if (responseOutput.datatype() == "INT32") {
-        SERIALIZE_BY_DATATYPE(mutable_int_contents, int32_t)
-    } else if (responseOutput.datatype() == "INT16") {
-        SERIALIZE_BY_DATATYPE(mutable_int_contents, int16_t)
-    } else if (responseOutput.datatype() == "INT8") {
-        SERIALIZE_BY_DATATYPE(mutable_int_contents, int8_t)
-    } else if (responseOutput.datatype() == "UINT64") {
-        SERIALIZE_BY_DATATYPE(mutable_uint64_contents, uint64_t)
-    } else if (responseOutput.datatype() == "UINT32") {
-        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint32_t)
-    } else if (responseOutput.datatype() == "UINT16") {
-        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint16_t)
-    } else if (responseOutput.datatype() == "UINT8") {
-        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint8_t)
-    } else if (responseOutput.datatype() == "FP64") {
-        SERIALIZE_BY_DATATYPE(mutable_fp64_contents, double)
-    } else if (responseOutput.datatype() == "BYTES") {
-        responseOutput.mutable_contents()->add_bytes_contents((char*)tensor.data(), tensor.get_byte_size());
+    auto* contents = responseOutput.mutable_contents();
+    switch (servableOutput->getPrecision()) {
+    case ovms::Precision::FP32:
+        serializeTypedContent<float, float>(contents->mutable_fp32_contents(), tensor);
+        break;
+    case ovms::Precision::FP64:
+        serializeTypedContent<double, double>(contents->mutable_fp64_contents(), tensor);
+        break;
+    case ovms::Precision::I64:
+        serializeTypedContent<int64_t, int64_t>(contents->mutable_int64_contents(), tensor);
+        break;
+    case ovms::Precision::I32:
+        serializeTypedContent<int32_t, int32_t>(contents->mutable_int_contents(), tensor);
+        break;
+    case ovms::Precision::I16:
+        serializeTypedContent<int32_t, int16_t>(contents->mutable_int_contents(), tensor);
+        break;
+    case ovms::Precision::I8:
+        serializeTypedContent<int32_t, int8_t>(contents->mutable_int_contents(), tensor);
+        break;
+    case ovms::Precision::U64:
+        serializeTypedContent<uint64_t, uint64_t>(contents->mutable_uint64_contents(), tensor);
+        break;
+    case ovms::Precision::U32:
+        serializeTypedContent<uint32_t, uint32_t>(contents->mutable_uint_contents(), tensor);
+        break;
+    case ovms::Precision::U16:
+        serializeTypedContent<uint32_t, uint16_t>(contents->mutable_uint_contents(), tensor);
+        break;
+    case ovms::Precision::U8:
+        if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
+            contents->add_bytes_contents((char*)tensor.data(), tensor.get_byte_size());
+        } else {
+            serializeTypedContent<uint32_t, uint8_t>(contents->mutable_uint_contents(), tensor);
+        }
+        break;
+    case ovms::Precision::BOOL:
+        serializeTypedContent<bool, bool>(contents->mutable_bool_contents(), tensor);
+        break;
+    default:
+        // precisions without typed contents field are rejected or serialized as raw contents
+        break;
     }
 }
 
@@ -277,7 +304,50 @@ Status serializeTensorToTensorProto(
     if (!status.ok()) {
         return status;
     }
-    serializeContent(responseOutput, tensor);
+    serializeContent(responseOutput, servableOutput, tensor);
+    return StatusCode::OK;
+}
+
+Status serializeTensorToSharedMemory(
+    ::KFSResponse::InferOutputTensor& responseOutput,
+    const std::shared_ptr<const TensorInfo>& servableOutput,
+    ov::Tensor& tensor) {
+    OVMS_PROFILE_FUNCTION();
+    if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
+        Status status = StatusCode::OV_UNSUPPORTED_SERIALIZATION_PRECISION;
+        SPDLOG_DEBUG("Output: {} with string data cannot be written to shared memory", servableOutput->getMappedName());
+        return status;
+    }
+    auto status = serializePrecision(responseOutput, servableOutput, tensor);
+    if (!status.ok()) {
+        return status;
+    }
+    status = serializeShape(responseOutput, servableOutput, tensor);
+    if (!status.ok()) {
+        return status;
+    }
+    SharedMemoryReference reference;
+    status = getSharedMemoryReference(responseOutput.parameters(), reference);
+    if (!status.ok()) {
+        return status;
+    }
+    if (tensor.get_byte_size() > reference.byteSize) {
+        std::stringstream ss;
+        ss << "Output: " << servableOutput->getMappedName() << " requires: " << tensor.get_byte_size()
+           << " bytes; shared memory byte size: " << reference.byteSize;
+        SPDLOG_DEBUG(ss.str());
+        return Status(StatusCode::INVALID_CONTENT_SIZE, ss.str());
+    }
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data = nullptr;
+    status = SharedMemoryRegistry::instance().getMemory(reference, region, data);
+    if (!status.ok()) {
+        return status;
+    }
+    // output bound to shared memory before inference is already in place
+    if (data != tensor.data()) {
+        std::memcpy(data, tensor.data(), tensor.get_byte_size());
+    }
     return StatusCode::OK;
 }
 
@@ -320,8 +390,9 @@ std::string* ProtoGetter<::KFSResponse*, ::KFSResponse::InferOutputTensor&>::cre
     for (int i = 0; i < protoStorage->outputs_size(); i++) {
         auto& tensor = *protoStorage->mutable_outputs(i);
         if (tensor.name() == name) {
-            if (protoStorage->raw_output_contents_size() <= i) {
-                return protoStorage->add_raw_output_contents();
+            // outputs written to shared memory may precede this one without contents
+            while (protoStorage->raw_output_contents_size() <= i) {
+                protoStorage->add_raw_output_contents();
             }
             return protoStorage->mutable_raw_output_contents(i);
         }
@@ -329,6 +400,164 @@ std::string* ProtoGetter<::KFSResponse*, ::KFSResponse::InferOutputTensor&>::cre
     return protoStorage->add_raw_output_contents();
 }
 
+static bool isOutputBindable(const TensorInfo& outputInfo) {
+    if (!outputInfo.getShape().isStatic()) {
+        return false;
+    }
+    if (outputInfo.getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
+        return false;
+    }
+    switch (outputInfo.getPrecision()) {
+    case ovms::Precision::FP64:
+    case ovms::Precision::FP32:
+    case ovms::Precision::FP16:
+    case ovms::Precision::I64:
+    case ovms::Precision::I32:
+    case ovms::Precision::I16:
+    case ovms::Precision::I8:
+    case ovms::Precision::U16:
+    case ovms::Precision::U8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool OutputBinding::getOriginalTensor(const TensorInfo& outputInfo, ov::Tensor& original) {
+    if (!isOutputBindable(outputInfo)) {
+        return false;
+    }
+    try {
+        original = inferRequest.get_tensor(outputInfo.getName());
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Cannot bind output: {}; error: {}", outputInfo.getName(), e.what());
+        return false;
+    }
+    return original.get_element_type() == outputInfo.getOvPrecision();
+}
+
+bool OutputBinding::bind(const TensorInfo& outputInfo, const ov::Tensor& original, void* data) {
+    try {
+        inferRequest.set_tensor(outputInfo.getName(), ov::Tensor(original.get_element_type(), original.get_shape(), data));
+    } catch (const ov::Exception& e) {
+        SPDLOG_DEBUG("Cannot bind output: {}; error: {}", outputInfo.getName(), e.what());
+        return false;
+    }
+    originalTensors.emplace_back(outputInfo.getName(), original);
+    return true;
+}
+
+OutputBinding::~OutputBinding() {
+    for (auto& [name, original] : originalTensors) {
+        try {
+            inferRequest.set_tensor(name, original);
+        } catch (const ov::Exception& e) {
+            SPDLOG_ERROR("Cannot restore output: {} tensor in infer request; error: {}", name, e.what());
+        }
+    }
+}
+
+void OutputBinding::bindOutputs(const tensor_map_t& outputMap, tensorflow::serving::PredictResponse* response, bool useSharedOutputContent) {
+    OVMS_PROFILE_FUNCTION();
+    ProtoGetter<tensorflow::serving::PredictResponse*, tensorflow::TensorProto&> protoGetter(response);
+    for (const auto& [outputName, outputInfo] : outputMap) {
+        ov::Tensor original;
+        if (!getOriginalTensor(*outputInfo, original) || original.get_byte_size() == 0) {
+            continue;
+        }
+        auto* content = protoGetter.createOutput(outputInfo->getMappedName()).mutable_tensor_content();
+        content->resize(original.get_byte_size());
+        if (!bind(*outputInfo, original, content->data())) {
+            content->clear();
+        }
+    }
+}
+
+static const ::KFSResponse::InferOutputTensor* findSharedMemoryOutput(const ::KFSResponse& response, const std::string& name) {
+    for (const auto& output : response.outputs()) {
+        if (output.name() == name) {
+            return usesSharedMemory(output.parameters()) ? &output : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void OutputBinding::bindSharedMemory(const TensorInfo& outputInfo, const ov::Tensor& original, const ::KFSResponse::InferOutputTensor& output) {
+    SharedMemoryReference reference;
+    if (!getSharedMemoryReference(output.parameters(), reference).ok() || reference.byteSize < original.get_byte_size()) {
+        // serialization reports the error
+        return;
+    }
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data = nullptr;
+    if (!SharedMemoryRegistry::instance().getMemory(reference, region, data).ok()) {
+        return;
+    }
+    if (bind(outputInfo, original, data)) {
+        boundRegions.push_back(std::move(region));
+    }
+}
+
+void OutputBinding::bindOutputs(const tensor_map_t& outputMap, ::KFSResponse* response, bool useSharedOutputContent) {
+    OVMS_PROFILE_FUNCTION();
+    ProtoGetter<::KFSResponse*, ::KFSResponse::InferOutputTensor&> protoGetter(response);
+    for (const auto& [outputName, outputInfo] : outputMap) {
+        ov::Tensor original;
+        if (!getOriginalTensor(*outputInfo, original) || original.get_byte_size() == 0) {
+            continue;
+        }
+        const auto* sharedMemoryOutput = findSharedMemoryOutput(*response, outputInfo->getMappedName());
+        if (sharedMemoryOutput != nullptr) {
+            bindSharedMemory(*outputInfo, original, *sharedMemoryOutput);
+            continue;
+        }
+        // typed contents are filled element by element so only raw output contents can be bound
+        if (!useSharedOutputContent) {
+            continue;
+        }
+        protoGetter.createOutput(outputInfo->getMappedName());
+        auto* content = protoGetter.createContent(outputInfo->getMappedName());
+        content->resize(original.get_byte_size());
+        if (!bind(*outputInfo, original, content->data())) {
+            content->clear();
+        }
+    }
+}
+
+void OutputBinding::bindOutputs(const tensor_map_t& outputMap, InferenceResponse* response, bool useSharedOutputContent) {
+    OVMS_PROFILE_FUNCTION();
+    for (const auto& [outputName, outputInfo] : outputMap) {
+        ov::Tensor original;
+        if (!getOriginalTensor(*outputInfo, original) || original.get_byte_size() == 0) {
+            continue;
+        }
+        auto buffer = std::make_unique<Buffer>(original.get_byte_size());
+        if (!bind(*outputInfo, original, buffer->data())) {
+            continue;
+        }
+        // Serialization skips outputs which are already present in response
+        auto status = response->addOutput(
+            outputInfo->getMappedName(),
+            getPrecisionAsOVMSDataType(outputInfo->getPrecision()),
+            reinterpret_cast<const int64_t*>(original.get_shape().data()),
+            original.get_shape().size());
+        InferenceTensor* outputTensor{nullptr};
+        const std::string* outputNameFromCapiTensor = nullptr;
+        if (status.ok()) {
+            status = response->getOutput(response->getOutputCount() - 1, &outputNameFromCapiTensor, &outputTensor);
+        }
+        if (status.ok()) {
+            status = outputTensor->setBuffer(std::move(buffer));
+        }
+        if (!status.ok()) {
+            // leave output to regular serialization; memory bound in infer request must outlive inference
+            SPDLOG_DEBUG("Cannot bind output: {} to response buffer; error: {}", outputInfo->getName(), status.string());
+            inferRequest.set_tensor(outputInfo->getName(), original);
+            originalTensors.pop_back();
+        }
+    }
+}
+
 const std::string& getTensorInfoName(const std::string& first, const TensorInfo& tensorInfo) {
     return tensorInfo.getName();
 }
@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <openvino/openvino.hpp>
 #include <spdlog/spdlog.h>
@@ -31,6 +33,7 @@
 #include "capi_frontend/inferenceresponse.hpp"
 #include "capi_frontend/inferencetensor.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "profiler.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
@@ -80,6 +83,44 @@ Status serializeTensorToTensorProto(
     const std::shared_ptr<const TensorInfo>& servableOutput,
     ov::Tensor& tensor);
 
+/**
+     * @brief Writes output requested in shared memory into client region. Response output contains only its metadata.
+     */
+Status serializeTensorToSharedMemory(
+    ::KFSResponse::InferOutputTensor& responseOutput,
+    const std::shared_ptr<const TensorInfo>& servableOutput,
+    ov::Tensor& tensor);
+
+/**
+     * @brief Binds model outputs directly to memory owned by response so that inference writes results in place
+     * and serialization does not need to copy them.
+     *
+     * Only outputs with static shape and precision serialized as raw bytes are bound. Remaining outputs are serialized
+     * with a copy. Original infer request output tensors are restored on destruction since infer request outlives response.
+     * KServe outputs requested in shared memory are bound to client region instead of response.
+     */
+class OutputBinding {
+    ov::InferRequest& inferRequest;
+    std::vector<std::pair<std::string, ov::Tensor>> originalTensors;
+    // keeps regions mapped while infer request writes to them
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> boundRegions;
+
+    bool getOriginalTensor(const TensorInfo& outputInfo, ov::Tensor& original);
+    bool bind(const TensorInfo& outputInfo, const ov::Tensor& original, void* data);
+    void bindSharedMemory(const TensorInfo& outputInfo, const ov::Tensor& original, const ::KFSResponse::InferOutputTensor& output);
+
+public:
+    OutputBinding(ov::InferRequest& inferRequest) :
+        inferRequest(inferRequest) {}
+    ~OutputBinding();
+
+    void bindOutputs(const tensor_map_t& outputMap, tensorflow::serving::PredictResponse* response, bool useSharedOutputContent);
+    void bindOutputs(const tensor_map_t& outputMap, ::KFSResponse* response, bool useSharedOutputContent);
+    void bindOutputs(const tensor_map_t& outputMap, InferenceResponse* response, bool useSharedOutputContent);
+
+    size_t getBoundOutputsCount() const { return originalTensors.size(); }
+};
+
 typedef const std::string& (*outputNameChooser_t)(const std::string&, const TensorInfo&);
 const std::string& getTensorInfoName(const std::string& first, const TensorInfo& tensorInfo);
 const std::string& getOutputMapKeyName(const std::string& first, const TensorInfo& tensorInfo);
@@ -132,7 +173,13 @@ Status serializePredictResponse(
             return status;
         }
         auto& inferOutputTensor = protoGetter.createOutput(outputInfo->getMappedName());
-        if (useSharedOutputContent) {
+        if (usesSharedMemory(inferOutputTensor.parameters())) {
+            status = serializeTensorToSharedMemory(inferOutputTensor, outputInfo, tensor);
+            if (useSharedOutputContent) {
+                // keeps raw output contents aligned with outputs, data is passed only in shared memory
+                protoGetter.createContent(outputInfo->getMappedName())->clear();
+            }
+        } else if (useSharedOutputContent) {
             status = serializeTensorToTensorProtoRaw(inferOutputTensor, protoGetter.createContent(outputInfo->getMappedName()), outputInfo, tensor);
         } else {
             status = serializeTensorToTensorProto(inferOutputTensor, outputInfo, tensor);
@@ -155,7 +202,6 @@ Status serializePredictResponse(
     bool useSharedOutputContent = true) {  // does not apply for C-API frontend
     OVMS_PROFILE_FUNCTION();
     Status status;
-    uint32_t outputId = 0;
     for (const auto& [outputName, outputInfo] : outputMap) {
         ov::Tensor tensor;
         status = outputGetter.get(outputNameChooser(outputName, *outputInfo), tensor);
@@ -208,10 +254,11 @@ Status serializePredictResponse(
             reinterpret_cast<const int64_t*>(tensor.get_shape().data()),
             tensor.get_shape().size());
         if (status == StatusCode::DOUBLE_TENSOR_INSERT) {
-            // DAG demultiplexer CAPI handling
-            // there is performance optimization so that during gather stage we do not double copy nodes
+            // Output is already filled either by DAG demultiplexer CAPI handling
+            // - there is performance optimization so that during gather stage we do not double copy nodes
             // outputs first to intermediate shard tensors and then to gathered tensor in response
-            return StatusCode::OK;
+            // or by binding output memory before inference
+            continue;
         }
         if (!status.ok()) {
             SPDLOG_ERROR("Cannot serialize output with name:{} for servable name:{}; version:{}; error: duplicate output name",
@@ -219,8 +266,7 @@ Status serializePredictResponse(
             return StatusCode::INTERNAL_ERROR;
         }
         const std::string* outputNameFromCapiTensor = nullptr;
-        status = response->getOutput(outputId, &outputNameFromCapiTensor, &outputTensor);
-        ++outputId;
+        status = response->getOutput(response->getOutputCount() - 1, &outputNameFromCapiTensor, &outputTensor);
         if (!status.ok()) {
             SPDLOG_ERROR("Cannot serialize output with name:{} for servable name:{}; version:{}; error: cannot find inserted input",
                 outputName, response->getServableName(), response->getServableVersion());
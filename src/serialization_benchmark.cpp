@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <openvino/openvino.hpp>
+#include <sysexits.h>
+
+#include "benchmark_utils.hpp"
+#include "deserialization.hpp"
+#include "kfs_frontend/kfs_utils.hpp"
+#include "precision.hpp"
+#include "serialization.hpp"
+#include "tensorinfo.hpp"
+
+namespace {
+
+// Previous KServe typed contents serialization adding elements one by one after datatype string comparison,
+// kept only as a reference point for comparison
+#define SERIALIZE_BY_DATATYPE(contents, datatype)                                  \
+    for (size_t i = 0; i < tensor.get_byte_size(); i += sizeof(datatype)) {        \
+        auto value = responseOutput.mutable_contents()->contents()->Add();         \
+        *value = (*(reinterpret_cast<const datatype*>((char*)tensor.data() + i))); \
+    }
+
+void serializeContentPerElement(::KFSResponse::InferOutputTensor& responseOutput, ov::Tensor& tensor) {
+    if (responseOutput.datatype() == "FP32") {
+        SERIALIZE_BY_DATATYPE(mutable_fp32_contents, float)
+    } else if (responseOutput.datatype() == "INT64") {
+        SERIALIZE_BY_DATATYPE(mutable_int64_contents, int64_t)
+    } else if (responseOutput.datatype() == "INT32") {
+        SERIALIZE_BY_DATATYPE(mutable_int_contents, int32_t)
+    } else if (responseOutput.datatype() == "INT16") {
+        SERIALIZE_BY_DATATYPE(mutable_int_contents, int16_t)
+    } else if (responseOutput.datatype() == "INT8") {
+        SERIALIZE_BY_DATATYPE(mutable_int_contents, int8_t)
+    } else if (responseOutput.datatype() == "UINT64") {
+        SERIALIZE_BY_DATATYPE(mutable_uint64_contents, uint64_t)
+    } else if (responseOutput.datatype() == "UINT32") {
+        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint32_t)
+    } else if (responseOutput.datatype() == "UINT16") {
+        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint16_t)
+    } else if (responseOutput.datatype() == "UINT8") {
+        SERIALIZE_BY_DATATYPE(mutable_uint_contents, uint8_t)
+    } else if (responseOutput.datatype() == "FP64") {
+        SERIALIZE_BY_DATATYPE(mutable_fp64_contents, double)
+    }
+}
+
+// Previous KServe typed contents deserialization copying elements one by one,
+// kept only as a reference point for comparison
+template <typename TensorType, typename ContentType>
+void deserializeContentPerElement(const google::protobuf::RepeatedField<ContentType>& contents, ov::Tensor& tensor) {
+    TensorType* ptr = reinterpret_cast<TensorType*>(tensor.data());
+    size_t i = 0;
+    for (auto& number : contents) {
+        ptr[i++] = *(const_cast<TensorType*>(reinterpret_cast<const TensorType*>(&number)));
+    }
+}
+
+template <typename TensorType, typename ContentType>
+void compareDeserialization(ovms::Precision precision, uint32_t elements, uint32_t niter,
+    google::protobuf::RepeatedField<ContentType>* (::inference::InferTensorContents::*mutableContents)()) {
+    ::KFSRequest::InferInputTensor requestInput;
+    requestInput.set_name("input");
+    requestInput.set_datatype(ovms::ovmsPrecisionToKFSPrecision(precision));
+    requestInput.add_shape(elements);
+    auto* contents = (requestInput.mutable_contents()->*mutableContents)();
+    contents->Resize(elements, 1);
+    auto tensorInfo = std::make_shared<const ovms::TensorInfo>("input", precision, ovms::Shape{elements}, ovms::Layout{"C"});
+
+    double perElementTime = ovms::measureMilliseconds(niter, [&requestInput, &tensorInfo, contents]() {
+        ov::Tensor tensor = ovms::makeTensor(requestInput, tensorInfo);
+        deserializeContentPerElement<TensorType>(*contents, tensor);
+    });
+    double bulkTime = ovms::measureMilliseconds(niter, [&requestInput, &tensorInfo]() {
+        ov::Tensor tensor = ovms::deserializeTensorProto<ovms::ConcreteTensorProtoDeserializator>(requestInput, tensorInfo, nullptr);
+        if (!tensor) {
+            std::cerr << "deserialization failed" << std::endl;
+        }
+    });
+    std::cout << ovms::toString(precision) << ": per element " << perElementTime << " ms, bulk " << bulkTime << " ms" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "KServe typed contents serialization and deserialization benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("elements",
+            "number of elements in serialized tensor",
+            cxxopts::value<uint32_t>()->default_value("1000000"),
+            "ELEMENTS")
+        ("niter",
+            "number of repetitions per precision",
+            cxxopts::value<uint32_t>()->default_value("20"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const uint32_t elements = result->operator[]("elements").as<uint32_t>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0) {
+        std::cerr << "niter has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::cout << "elements: " << elements << " iterations: " << niter << std::endl;
+    std::cout << "Serialization to KServe typed contents" << std::endl;
+    for (auto precision : {ovms::Precision::FP32, ovms::Precision::I64, ovms::Precision::I16, ovms::Precision::I8, ovms::Precision::U8}) {
+        auto servableOutput = std::make_shared<const ovms::TensorInfo>("output", precision, ovms::Shape{elements}, ovms::Layout{"C"});
+        ov::Tensor tensor(ovms::ovmsPrecisionToIE2Precision(precision), ov::Shape{elements});
+        std::memset(tensor.data(), 1, tensor.get_byte_size());
+
+        double perElementTime = ovms::measureMilliseconds(niter, [&tensor, precision]() {
+            ::KFSResponse::InferOutputTensor responseOutput;
+            responseOutput.set_datatype(ovms::ovmsPrecisionToKFSPrecision(precision));
+            serializeContentPerElement(responseOutput, tensor);
+        });
+        double bulkTime = ovms::measureMilliseconds(niter, [&tensor, &servableOutput]() {
+            ::KFSResponse::InferOutputTensor responseOutput;
+            auto status = ovms::serializeTensorToTensorProto(responseOutput, servableOutput, tensor);
+            if (!status.ok()) {
+                std::cerr << "serialization failed: " << status.string() << std::endl;
+            }
+        });
+        std::cout << ovms::toString(precision) << ": per element " << perElementTime << " ms, bulk " << bulkTime << " ms" << std::endl;
+    }
+
+    std::cout << "Deserialization from KServe typed contents" << std::endl;
+    compareDeserialization<float>(ovms::Precision::FP32, elements, niter, &::inference::InferTensorContents::mutable_fp32_contents);
+    compareDeserialization<int64_t>(ovms::Precision::I64, elements, niter, &::inference::InferTensorContents::mutable_int64_contents);
+    compareDeserialization<int16_t>(ovms::Precision::I16, elements, niter, &::inference::InferTensorContents::mutable_int_contents);
+    compareDeserialization<int8_t>(ovms::Precision::I8, elements, niter, &::inference::InferTensorContents::mutable_int_contents);
+    compareDeserialization<uint16_t>(ovms::Precision::U16, elements, niter, &::inference::InferTensorContents::mutable_uint_contents);
+    compareDeserialization<uint8_t>(ovms::Precision::U8, elements, niter, &::inference::InferTensorContents::mutable_uint_contents);
+    return EX_OK;
+}
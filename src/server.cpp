@@ -99,6 +99,8 @@ static void logConfig(const Config& config) {
     SPDLOG_DEBUG("REST port: {}", config.restPort());
     SPDLOG_DEBUG("gRPC bind address: {}", config.grpcBindAddress());
     SPDLOG_DEBUG("REST bind address: {}", config.restBindAddress());
+    SPDLOG_DEBUG("gRPC unix domain socket path: {}", config.grpcUdsPath());
+    SPDLOG_DEBUG("REST unix domain socket path: {}", config.restUdsPath());
     SPDLOG_DEBUG("REST workers: {}", config.restWorkers());
     SPDLOG_DEBUG("gRPC workers: {}", config.grpcWorkers());
     SPDLOG_DEBUG("gRPC channel arguments: {}", config.grpcChannelArguments());
@@ -251,7 +253,7 @@ Status Server::startModules(ovms::Config& config) {
     START_MODULE(itGrpc);
     // if we ever decide not to start GRPC module then we need to implement HTTP responses without using grpc implementations
     auto itHttp = modules.end();
-    if (config.restPort() != 0) {
+    if (config.restPort() != 0 || !config.restUdsPath().empty()) {
         INSERT_MODULE(HTTP_SERVER_MODULE_NAME, itHttp);
         START_MODULE(itHttp);
     }
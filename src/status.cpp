@@ -70,6 +70,9 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::REQUESTED_MODEL_TYPE_CHANGE, "Model type cannot be changed after it is loaded"},
     {StatusCode::INVALID_NON_STATEFUL_MODEL_PARAMETER, "Stateful model config parameter used for non stateful model"},
     {StatusCode::INVALID_MAX_SEQUENCE_NUMBER, "Sequence max number parameter too high"},
+    {StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER, "Invalid dynamic batching parameters"},
+    {StatusCode::INVALID_SHAPE_CACHE_SIZE, "Shape cache size exceeds allowed value"},
+    {StatusCode::INVALID_ACCEPT_PRECISIONS, "Invalid accept precisions parameter"},
     {StatusCode::CANNOT_CONVERT_FLAT_SHAPE, "Cannot convert flat shape to Shape object"},
     {StatusCode::INVALID_BATCH_DIMENSION, "Invalid batch dimension in shape"},
     {StatusCode::LAYOUT_INCOMPATIBLE_WITH_SHAPE, "Layout incompatible with given shape"},
@@ -104,7 +107,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_VALUE_COUNT, "Invalid number of values in tensor proto container"},
     {StatusCode::INVALID_CONTENT_SIZE, "Invalid content size of tensor proto"},
     {StatusCode::INVALID_MESSAGE_STRUCTURE, "Passing buffers both in ModelInferRequest::InferInputTensor::contents and in ModelInferRequest::raw_input_contents is not allowed"},
-    {StatusCode::UNSUPPORTED_LAYOUT, "Received binary image input but resource not configured to accept NHWC layout"},
+    {StatusCode::UNSUPPORTED_LAYOUT, "Received binary image input but resource not configured to accept NHWC or NCHW layout"},
 
     // Deserialization
     {StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION, "Unsupported deserialization precision"},
@@ -154,6 +157,14 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID, "Inference-Header-Content-Length header is invalid and couldn't be parsed"},
     {StatusCode::REST_CONTENTS_FIELD_NOT_EMPTY, "Request contains values both in binary data and in content value"},
 
+    // KServe shared memory extension
+    {StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED, "Shared memory region with this name is already registered"},
+    {StatusCode::SHARED_MEMORY_REGION_NOT_FOUND, "Shared memory region is not registered"},
+    {StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED, "Could not open shared memory object"},
+    {StatusCode::SHARED_MEMORY_INVALID_RANGE, "Offset and byte size exceed shared memory object or region"},
+    {StatusCode::SHARED_MEMORY_INVALID_PARAMETERS, "Invalid shared memory parameters"},
+    {StatusCode::SHARED_MEMORY_DISABLED, "System shared memory is disabled; start the server with allow_system_shared_memory to enable it"},
+
     // Pipeline validation errors
     {StatusCode::PIPELINE_DEFINITION_ALREADY_EXIST, "Pipeline definition with the same name already exists"},
     {StatusCode::PIPELINE_NODE_WRONG_KIND_CONFIGURATION, "Unsupported node type"},
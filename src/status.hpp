@@ -75,6 +75,9 @@ enum class StatusCode {
     REQUESTED_MODEL_TYPE_CHANGE,                       /*!< Model type cannot be changed after it's loaded */
     INVALID_NON_STATEFUL_MODEL_PARAMETER,              /*!< Stateful model config parameter used for non stateful model */
     INVALID_MAX_SEQUENCE_NUMBER,                       /*!< Sequence max number parameter too high */
+    INVALID_DYNAMIC_BATCHING_PARAMETER,                /*!< Dynamic batching parameters are invalid or conflict with other model parameters */
+    INVALID_SHAPE_CACHE_SIZE,                          /*!< Shape cache size parameter too high */
+    INVALID_ACCEPT_PRECISIONS,                         /*!< Accept precisions parameter is malformed or requests unsupported conversion */
 
     // Sequence management
     SEQUENCE_MISSING,                /*!< Sequence with provided ID does not exist */
@@ -196,6 +199,14 @@ enum class StatusCode {
     REST_BINARY_BUFFER_EXCEEDED,                  /*!< Received buffer size is smaller than binary_data_size parameter indicates*/
     REST_CONTENTS_FIELD_NOT_EMPTY,                /*!< Request contains values both in binary data and in content value*/
 
+    // KServe shared memory extension
+    SHARED_MEMORY_REGION_ALREADY_REGISTERED, /*!< Shared memory region with this name is already registered */
+    SHARED_MEMORY_REGION_NOT_FOUND,          /*!< Shared memory region with this name is not registered */
+    SHARED_MEMORY_REGION_OPEN_FAILED,        /*!< Could not open or map shared memory object */
+    SHARED_MEMORY_INVALID_RANGE,             /*!< Offset and byte size exceed shared memory object or region */
+    SHARED_MEMORY_INVALID_PARAMETERS,        /*!< Shared memory parameters are missing or have invalid type */
+    SHARED_MEMORY_DISABLED,                  /*!< System shared memory extension is not enabled */
+
     // Pipeline validation errors
     PIPELINE_DEFINITION_ALREADY_EXIST,
     PIPELINE_NODE_WRONG_KIND_CONFIGURATION,
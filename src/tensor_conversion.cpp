@@ -22,19 +22,25 @@
 #pragma GCC diagnostic pop
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include <openvino/openvino.hpp>
 
+#include "config.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "logging.hpp"
 #include "opencv2/opencv.hpp"
 #include "profiler.hpp"
 #include "status.hpp"
 #include "tfs_frontend/tfs_utils.hpp"
+#include "worker_pool.hpp"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
@@ -66,45 +72,107 @@ static int getMatTypeFromTensorPrecision(ovms::Precision tensorPrecision) {
     }
 }
 
-static bool isPrecisionEqual(int matPrecision, ovms::Precision tensorPrecision) {
-    int convertedTensorPrecision = getMatTypeFromTensorPrecision(tensorPrecision);
-    if (convertedTensorPrecision == matPrecision) {
-        return true;
-    }
-    return false;
-}
-
-static cv::Mat convertStringToMat(const std::string& image) {
+static cv::Mat convertStringToMat(std::string_view image, int flags = cv::IMREAD_UNCHANGED) {
     OVMS_PROFILE_FUNCTION();
-    std::vector<unsigned char> data(image.begin(), image.end());
-    cv::Mat dataMat(data, true);
+    if (image.empty()) {
+        return cv::Mat{};
+    }
+    // decoder only reads encoded bytes, so they are wrapped instead of copied
+    cv::Mat dataMat(1, image.size(), CV_8UC1, const_cast<char*>(image.data()));
 
     try {
-        return cv::imdecode(dataMat, cv::IMREAD_UNCHANGED);
+        return cv::imdecode(dataMat, flags);
     } catch (const cv::Exception& e) {
         SPDLOG_DEBUG("Error during string_val to mat conversion: {}", e.what());
         return cv::Mat{};
     }
 }
 
-static Status convertPrecision(const cv::Mat& src, cv::Mat& dst, const ovms::Precision requestedPrecision) {
+// Reads resolution and number of color components from JPEG frame header, without decoding the image
+static bool readJpegFrameHeader(std::string_view image, int& height, int& width, int& components) {
+    const auto* data = reinterpret_cast<const unsigned char*>(image.data());
+    const size_t size = image.size();
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return false;
+    }
+    size_t offset = 2;
+    while (offset + 4 <= size) {
+        if (data[offset] != 0xFF) {
+            return false;
+        }
+        const unsigned char marker = data[offset + 1];
+        if (marker == 0xFF) {
+            // fill byte
+            offset++;
+            continue;
+        }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            // markers without length
+            offset += 2;
+            continue;
+        }
+        if (marker == 0xD9 || marker == 0xDA) {
+            // end of image or start of scan before frame header
+            return false;
+        }
+        const size_t length = (data[offset + 2] << 8) | data[offset + 3];
+        // start of frame markers, except DHT, JPG and DAC sharing the same range
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            if (length < 8 || offset + 10 > size) {
+                return false;
+            }
+            height = (data[offset + 5] << 8) | data[offset + 6];
+            width = (data[offset + 7] << 8) | data[offset + 8];
+            components = data[offset + 9];
+            return height > 0 && width > 0;
+        }
+        offset += 2 + length;
+    }
+    return false;
+}
+
+// Returns decoding flags making libjpeg decode image at the smallest of 1/8, 1/4 and 1/2 scales
+// which is not smaller than target resolution. Other images are decoded unchanged, at full resolution.
+static int getScaledDecodingFlags(std::string_view image, int targetHeight, int targetWidth) {
     OVMS_PROFILE_FUNCTION();
-    int type = getMatTypeFromTensorPrecision(requestedPrecision);
-    if (type == -1) {
-        SPDLOG_DEBUG("Error during binary input conversion: not supported precision: {}", toString(requestedPrecision));
-        return StatusCode::INVALID_PRECISION;
+    int height, width, components;
+    if (!readJpegFrameHeader(image, height, width, components) || (components != 1 && components != 3)) {
+        return cv::IMREAD_UNCHANGED;
+    }
+    static const std::array<std::tuple<int, int, int>, 3> scales{{
+        {8, cv::IMREAD_REDUCED_COLOR_8, cv::IMREAD_REDUCED_GRAYSCALE_8},
+        {4, cv::IMREAD_REDUCED_COLOR_4, cv::IMREAD_REDUCED_GRAYSCALE_4},
+        {2, cv::IMREAD_REDUCED_COLOR_2, cv::IMREAD_REDUCED_GRAYSCALE_2},
+    }};
+    for (const auto& [denominator, colorFlags, grayscaleFlags] : scales) {
+        // decoder rounds scaled resolution up
+        if ((height + denominator - 1) / denominator >= targetHeight &&
+            (width + denominator - 1) / denominator >= targetWidth) {
+            // keep number of channels and ignore EXIF orientation, the same as when decoding unchanged
+            return (components == 3 ? colorFlags : grayscaleFlags) | cv::IMREAD_IGNORE_ORIENTATION;
+        }
     }
+    return cv::IMREAD_UNCHANGED;
+}
 
-    src.convertTo(dst, type);
-    return StatusCode::OK;
+static const std::string INTERLEAVED_IMAGE_LAYOUT = "N...HWC";
+static const std::string PLANAR_IMAGE_LAYOUT = "N...CHW";
+
+static bool isLayoutCompatible(const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string& layout) {
+    return tensorInfo->getLayout().createIntersection(Layout(layout), tensorInfo->getShape().size()).has_value();
+}
+
+// Images are written in interleaved N...HWC layout, unless endpoint accepts only planar N...CHW layout
+static bool isPlanarLayout(const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    return !isLayoutCompatible(tensorInfo, INTERLEAVED_IMAGE_LAYOUT) && isLayoutCompatible(tensorInfo, PLANAR_IMAGE_LAYOUT);
 }
 
 static Status validateLayout(const std::shared_ptr<const TensorInfo>& tensorInfo) {
     OVMS_PROFILE_FUNCTION();
-    static const std::string binarySupportedLayout = "N...HWC";
-    if (!tensorInfo->getLayout().createIntersection(Layout(binarySupportedLayout), tensorInfo->getShape().size()).has_value()) {
-        SPDLOG_DEBUG("Endpoint needs to be compatible with {} to support binary image inputs, actual: {}",
-            binarySupportedLayout,
+    if (!isLayoutCompatible(tensorInfo, INTERLEAVED_IMAGE_LAYOUT) && !isLayoutCompatible(tensorInfo, PLANAR_IMAGE_LAYOUT)) {
+        SPDLOG_DEBUG("Endpoint needs to be compatible with {} or {} to support binary image inputs, actual: {}",
+            INTERLEAVED_IMAGE_LAYOUT,
+            PLANAR_IMAGE_LAYOUT,
             tensorInfo->getLayout());
         return StatusCode::UNSUPPORTED_LAYOUT;
     }
@@ -118,23 +186,37 @@ static bool resizeNeeded(const cv::Mat& image, const dimension_value_t height, c
     return false;
 }
 
-static Status resizeMat(const cv::Mat& src, cv::Mat& dst, const dimension_value_t height, const dimension_value_t width) {
-    OVMS_PROFILE_FUNCTION();
-    cv::resize(src, dst, cv::Size(width, height));
-    return StatusCode::OK;
+// Height, width and channels are the last three dimensions of N...HWC as well as N...CHW shapes
+static Dimension getTensorInfoDimFromEnd(const std::shared_ptr<const TensorInfo>& tensorInfo, size_t positionFromEnd) {
+    size_t numberOfShapeDimensions = tensorInfo->getShape().size();
+    if (numberOfShapeDimensions < 4 || numberOfShapeDimensions > 5) {
+        throw std::logic_error("wrong number of shape dimensions");
+    }
+    return tensorInfo->getShape()[numberOfShapeDimensions - positionFromEnd];
+}
+
+static Dimension getTensorInfoHeightDim(const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    return getTensorInfoDimFromEnd(tensorInfo, isPlanarLayout(tensorInfo) ? /*CHW*/ 2 : /*HWC*/ 3);
+}
+
+static Dimension getTensorInfoWidthDim(const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    return getTensorInfoDimFromEnd(tensorInfo, isPlanarLayout(tensorInfo) ? /*CHW*/ 1 : /*HWC*/ 2);
+}
+
+static Dimension getTensorInfoChannelsDim(const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    return getTensorInfoDimFromEnd(tensorInfo, isPlanarLayout(tensorInfo) ? /*CHW*/ 3 : /*HWC*/ 1);
 }
 
 static Status validateNumberOfChannels(const std::shared_ptr<const TensorInfo>& tensorInfo,
     const cv::Mat input,
-    cv::Mat* firstBatchImage) {
+    const cv::Mat* firstBatchImage) {
     OVMS_PROFILE_FUNCTION();
 
-    // At this point we can either have nhwc format or pretendant to be nhwc but with ANY layout in pipeline info
+    // At this point we can either have nhwc or nchw format or pretendant to be nhwc but with ANY layout in pipeline info
     Dimension numberOfChannels;
-    if (tensorInfo->getShape().size() == 4) {
-        numberOfChannels = tensorInfo->getShape()[3];
-    } else if (tensorInfo->isInfluencedByDemultiplexer() && tensorInfo->getShape().size() == 5) {
-        numberOfChannels = tensorInfo->getShape()[4];
+    if (tensorInfo->getShape().size() == 4 ||
+        (tensorInfo->isInfluencedByDemultiplexer() && tensorInfo->getShape().size() == 5)) {
+        numberOfChannels = getTensorInfoChannelsDim(tensorInfo);
     } else {
         return StatusCode::INVALID_NO_OF_CHANNELS;
     }
@@ -155,7 +237,7 @@ static Status validateNumberOfChannels(const std::shared_ptr<const TensorInfo>&
     return StatusCode::OK;
 }
 
-static Status validateResolutionAgainstFirstBatchImage(const cv::Mat input, cv::Mat* firstBatchImage) {
+static Status validateResolutionAgainstFirstBatchImage(const cv::Mat input, const cv::Mat* firstBatchImage) {
     OVMS_PROFILE_FUNCTION();
     if (input.cols == firstBatchImage->cols && input.rows == firstBatchImage->rows) {
         return StatusCode::OK;
@@ -174,7 +256,7 @@ static bool checkBatchSizeMismatch(const std::shared_ptr<const TensorInfo>& tens
     return !tensorInfo->getBatchSize().value().match(batchSize);
 }
 
-static Status validateInput(const std::shared_ptr<const TensorInfo>& tensorInfo, const cv::Mat input, cv::Mat* firstBatchImage, bool enforceResolutionAlignment) {
+static Status validateInput(const std::shared_ptr<const TensorInfo>& tensorInfo, const cv::Mat input, const cv::Mat* firstBatchImage, bool enforceResolutionAlignment) {
     // Binary inputs are supported for any endpoint that is compatible with N...HWC layout.
     // With unknown layout, there is no way to deduce expected endpoint input resolution.
     // This forces binary utility to create tensors with resolution inherited from first batch of binary input image (request).
@@ -272,24 +354,6 @@ static Status validateTensor(const std::shared_ptr<const TensorInfo>& tensorInfo
     return StatusCode::OK;
 }
 
-static Dimension getTensorInfoHeightDim(const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    size_t numberOfShapeDimensions = tensorInfo->getShape().size();
-    if (numberOfShapeDimensions < 4 || numberOfShapeDimensions > 5) {
-        throw std::logic_error("wrong number of shape dimensions");
-    }
-    size_t position = numberOfShapeDimensions == 4 ? /*NHWC*/ 1 : /*N?HWC*/ 2;
-    return tensorInfo->getShape()[position];
-}
-
-static Dimension getTensorInfoWidthDim(const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    size_t numberOfShapeDimensions = tensorInfo->getShape().size();
-    if (numberOfShapeDimensions < 4 || numberOfShapeDimensions > 5) {
-        throw std::logic_error("wrong number of shape dimensions");
-    }
-    size_t position = numberOfShapeDimensions == 4 ? /*NHWC*/ 2 : /*N?HWC*/ 3;
-    return tensorInfo->getShape()[position];
-}
-
 static void updateTargetResolution(Dimension& height, Dimension& width, const cv::Mat& image) {
     if (height.isAny()) {
         height = image.rows;
@@ -327,6 +391,8 @@ static bool isResizeSupported(const std::shared_ptr<const TensorInfo>& tensorInf
     }
     if (tensorInfo->getLayout() != "NHWC" &&
         tensorInfo->getLayout() != "N?HWC" &&
+        tensorInfo->getLayout() != "NCHW" &&
+        tensorInfo->getLayout() != "N?CHW" &&
         tensorInfo->getLayout() != Layout::getUnspecifiedLayout()) {
         return false;
     }
@@ -349,7 +415,7 @@ inline static int getBinaryInputsSize(const ::KFSRequest::InferInputTensor& tens
     return tensor.contents().bytes_contents_size();
 }
 
-inline static Status getInputs(const std::string* buffer, std::vector<std::string>& inputs) {
+inline static Status getInputs(const std::string* buffer, std::vector<std::string_view>& inputs) {
     if (buffer == nullptr) {
         return StatusCode::OK;
     }
@@ -359,7 +425,7 @@ inline static Status getInputs(const std::string* buffer, std::vector<std::strin
         offset += sizeof(uint32_t);
         if (offset + inputSize > buffer->size())
             break;
-        inputs.push_back(buffer->substr(offset, inputSize));
+        inputs.emplace_back(buffer->data() + offset, inputSize);
         offset += inputSize;
     }
     if (offset != buffer->size()) {
@@ -368,114 +434,205 @@ inline static Status getInputs(const std::string* buffer, std::vector<std::strin
     return StatusCode::OK;
 }
 
-template <typename TensorType>
-static Status convertTensorToMatsMatchingTensorInfo(const TensorType& src, std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer) {
-    OVMS_PROFILE_FUNCTION();
-    Dimension targetHeight = getTensorInfoHeightDim(tensorInfo);
-    Dimension targetWidth = getTensorInfoWidthDim(tensorInfo);
+static WorkerPool& getImageDecodingPool() {
+    // request thread decodes images as well, so pool has one thread less than configured
+    static WorkerPool pool(std::max(Config::instance().imageDecodingThreads(), 1u) - 1);
+    return pool;
+}
 
-    // Enforce resolution alignment against first image in the batch if resize is not supported.
-    bool resizeSupported = isResizeSupported(tensorInfo);
-    bool enforceResolutionAlignment = !resizeSupported;
+// Intermediate results of larger images are not kept by threads between requests
+static const size_t MAX_RETAINED_SCRATCH_SIZE = 16 * 1024 * 1024;
 
-    bool rawInputsContentsUsed = (buffer != nullptr);
-    std::vector<std::string> inputs;
-    auto status = getInputs(buffer, inputs);
-    if (status != StatusCode::OK) {
-        return status;
+static void releaseLargeScratch(cv::Mat& scratch) {
+    if (scratch.total() * scratch.elemSize() > MAX_RETAINED_SCRATCH_SIZE) {
+        scratch.release();
     }
-    int numberOfInputs = (!rawInputsContentsUsed ? getBinaryInputsSize(src) : inputs.size());
-    for (int i = 0; i < numberOfInputs; i++) {
-        cv::Mat image = convertStringToMat(!rawInputsContentsUsed ? getBinaryInput(src, i) : inputs[i]);
-        if (image.data == nullptr)
-            return StatusCode::IMAGE_PARSING_FAILED;
-        cv::Mat* firstImage = images.size() == 0 ? nullptr : &images.at(0);
-        auto status = validateInput(tensorInfo, image, firstImage, enforceResolutionAlignment);
-        if (status != StatusCode::OK) {
-            return status;
-        }
-        if (i == 0) {
-            updateTargetResolution(targetHeight, targetWidth, image);
-        }
+}
 
-        if (!isPrecisionEqual(image.depth(), tensorInfo->getPrecision())) {
-            cv::Mat imageCorrectPrecision;
-            status = convertPrecision(image, imageCorrectPrecision, tensorInfo->getPrecision());
+// Precision, resolution and layout to which all images of the batch are converted
+struct ImageConversionTarget {
+    int depth;
+    int height;
+    int width;
+    bool resizeSupported;
+    bool enforceResolutionAlignment;
+    bool planar;
+    bool scaledDecoding;
+};
 
-            if (status != StatusCode::OK) {
-                return status;
-            }
-            image = std::move(imageCorrectPrecision);
+static cv::Mat decodeImage(std::string_view input, const ImageConversionTarget& target) {
+    return convertStringToMat(input, target.scaledDecoding ? getScaledDecodingFlags(input, target.height, target.width) : cv::IMREAD_UNCHANGED);
+}
+
+// Converts decoded image to tensor precision, target resolution and layout, with the last step
+// writing directly into image slot of the batch tensor. Intermediate results of precision conversion
+// and resize are stored in scratch buffers of the calling thread, reused by following images.
+static Status convertImageIntoSlot(const cv::Mat& image, char* slot, const ImageConversionTarget& target) {
+    OVMS_PROFILE_FUNCTION();
+    thread_local cv::Mat converted;
+    thread_local cv::Mat resized;
+    bool conversionRequired = image.depth() != target.depth;
+    bool resizeRequired = resizeNeeded(image, target.height, target.width);
+    if (resizeRequired && !target.resizeSupported) {
+        return StatusCode::INVALID_SHAPE;
+    }
+    const int channels = image.channels();
+    cv::Mat interleavedSlot;
+    if (!target.planar) {
+        interleavedSlot = cv::Mat(target.height, target.width, CV_MAKETYPE(target.depth, channels), slot);
+    }
+    const cv::Mat* current = &image;
+    if (conversionRequired) {
+        cv::Mat& output = (!target.planar && !resizeRequired) ? interleavedSlot : converted;
+        current->convertTo(output, target.depth);
+        current = &output;
+    }
+    if (resizeRequired) {
+        cv::Mat& output = !target.planar ? interleavedSlot : resized;
+        cv::resize(*current, output, cv::Size(target.width, target.height));
+        current = &output;
+    }
+    bool writtenToSlot = true;
+    if (target.planar) {
+        const size_t planeSize = static_cast<size_t>(target.height) * target.width * CV_ELEM_SIZE1(target.depth);
+        std::vector<cv::Mat> planes;
+        planes.reserve(channels);
+        for (int c = 0; c < channels; c++) {
+            planes.emplace_back(target.height, target.width, target.depth, slot + c * planeSize);
         }
-        if (!targetHeight.isStatic() || !targetWidth.isStatic()) {
-            return StatusCode::INTERNAL_ERROR;
+        cv::split(*current, planes.data());
+        for (int c = 0; c < channels; c++) {
+            writtenToSlot &= (planes[c].data == reinterpret_cast<uchar*>(slot + c * planeSize));
         }
-        if (resizeNeeded(image, targetHeight.getStaticValue(), targetWidth.getStaticValue())) {
-            if (!resizeSupported) {
-                return StatusCode::INVALID_SHAPE;
-            }
-            cv::Mat imageResized;
-            status = resizeMat(image, imageResized, targetHeight.getStaticValue(), targetWidth.getStaticValue());
-            if (!status.ok()) {
-                return status;
-            }
-            image = std::move(imageResized);
+    } else {
+        if (current->data != interleavedSlot.data) {
+            // image already has precision and resolution of the tensor
+            current->copyTo(interleavedSlot);
         }
-
-        // if (i == 0 && src.contents().bytes_contents_size() > 1) {
-        //     // Multiply src.string_val_size() * image resolution * precision size
-        // }
-        images.push_back(image);
+        writtenToSlot = (interleavedSlot.data == reinterpret_cast<uchar*>(slot));
+    }
+    releaseLargeScratch(converted);
+    releaseLargeScratch(resized);
+    if (!writtenToSlot) {
+        // should not happen, slot size and type match converted image
+        SPDLOG_DEBUG("Binary input conversion did not write image into tensor memory");
+        return StatusCode::INTERNAL_ERROR;
     }
     return StatusCode::OK;
 }
 
-static shape_t getShapeFromImages(const std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
+// Decodes image of the batch, validates it against the first one and converts it into its slot of the batch tensor
+static Status convertBatchImage(std::string_view input, const cv::Mat& firstImage, char* slot, const std::shared_ptr<const TensorInfo>& tensorInfo, const ImageConversionTarget& target) {
+    OVMS_PROFILE_FUNCTION();
+    cv::Mat image = decodeImage(input, target);
+    if (image.data == nullptr)
+        return StatusCode::IMAGE_PARSING_FAILED;
+    auto status = validateInput(tensorInfo, image, &firstImage, target.enforceResolutionAlignment);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    if (image.channels() != firstImage.channels()) {
+        SPDLOG_DEBUG("Each binary image in request needs to have the same number of channels. First: {}, current: {}", firstImage.channels(), image.channels());
+        return StatusCode::INVALID_NO_OF_CHANNELS;
+    }
+    return convertImageIntoSlot(image, slot, target);
+}
+
+static shape_t getShapeFromImages(size_t numberOfImages, int height, int width, int channels, bool planar, const std::shared_ptr<const TensorInfo>& tensorInfo) {
     OVMS_PROFILE_FUNCTION();
     shape_t dims;
-    dims.push_back(images.size());
+    dims.push_back(numberOfImages);
     if (tensorInfo->isInfluencedByDemultiplexer()) {
         dims.push_back(1);
     }
-    dims.push_back(images[0].rows);
-    dims.push_back(images[0].cols);
-    dims.push_back(images[0].channels());
+    if (planar) {
+        dims.push_back(channels);
+    }
+    dims.push_back(height);
+    dims.push_back(width);
+    if (!planar) {
+        dims.push_back(channels);
+    }
     return dims;
 }
 
-static ov::Tensor createTensorFromMats(const std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
+// First image of the batch is decoded in request thread since it determines resolution of the whole batch.
+// Then batch tensor is allocated and images are converted in parallel by image decoding pool,
+// each written directly into its slot of the tensor, which is passed to inference without copying.
+template <typename TensorType>
+static Status convertImagesToTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer) {
     OVMS_PROFILE_FUNCTION();
-    ov::Shape shape = getShapeFromImages(images, tensorInfo);
-    ov::element::Type precision = tensorInfo->getOvPrecision();
-    ov::Tensor tensor(precision, shape);
-    char* ptr = (char*)tensor.data();
-    for (cv::Mat image : images) {
-        memcpy(ptr, (char*)image.data, image.total() * image.elemSize());
-        ptr += (image.total() * image.elemSize());
+    Dimension targetHeight = getTensorInfoHeightDim(tensorInfo);
+    Dimension targetWidth = getTensorInfoWidthDim(tensorInfo);
+    const bool planar = isPlanarLayout(tensorInfo);
+
+    // Enforce resolution alignment against first image in the batch if resize is not supported.
+    bool resizeSupported = isResizeSupported(tensorInfo);
+    bool enforceResolutionAlignment = !resizeSupported;
+
+    bool rawInputsContentsUsed = (buffer != nullptr);
+    std::vector<std::string_view> inputs;
+    auto status = getInputs(buffer, inputs);
+    if (status != StatusCode::OK) {
+        return status;
     }
-    return tensor;
-}
+    int numberOfInputs = (!rawInputsContentsUsed ? getBinaryInputsSize(src) : inputs.size());
+    if (numberOfInputs == 0) {
+        return StatusCode::IMAGE_PARSING_FAILED;
+    }
+    auto getInput = [&](int i) -> std::string_view {
+        return !rawInputsContentsUsed ? std::string_view(getBinaryInput(src, i)) : inputs[i];
+    };
 
-static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    OVMS_PROFILE_FUNCTION();
-    switch (tensorInfo->getPrecision()) {
-    case ovms::Precision::FP32:
-    case ovms::Precision::I32:
-    case ovms::Precision::FP64:
-    case ovms::Precision::I8:
-    case ovms::Precision::U8:
-    case ovms::Precision::FP16:
-    case ovms::Precision::U16:
-    case ovms::Precision::I16:
-        return createTensorFromMats(images, tensorInfo);
-    case ovms::Precision::MIXED:
-    case ovms::Precision::Q78:
-    case ovms::Precision::BIN:
-    case ovms::Precision::BOOL:
-    case ovms::Precision::CUSTOM:
-    default:
-        return ov::Tensor();
+    // JPEG images can be decoded at reduced scale only when target resolution does not depend on them
+    const bool scaledDecoding = Config::instance().jpegScaledDecoding() && resizeSupported && targetHeight.isStatic() && targetWidth.isStatic();
+    cv::Mat firstImage = scaledDecoding ? convertStringToMat(getInput(0), getScaledDecodingFlags(getInput(0), targetHeight.getStaticValue(), targetWidth.getStaticValue())) : convertStringToMat(getInput(0));
+    if (firstImage.data == nullptr)
+        return StatusCode::IMAGE_PARSING_FAILED;
+    status = validateInput(tensorInfo, firstImage, nullptr, enforceResolutionAlignment);
+    if (status != StatusCode::OK) {
+        return status;
     }
+    updateTargetResolution(targetHeight, targetWidth, firstImage);
+    int targetDepth = getMatTypeFromTensorPrecision(tensorInfo->getPrecision());
+    if (targetDepth == -1) {
+        SPDLOG_DEBUG("Error during binary input conversion: not supported precision: {}", toString(tensorInfo->getPrecision()));
+        return StatusCode::INVALID_PRECISION;
+    }
+    if (!targetHeight.isStatic() || !targetWidth.isStatic()) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const ImageConversionTarget target{targetDepth, static_cast<int>(targetHeight.getStaticValue()), static_cast<int>(targetWidth.getStaticValue()),
+        resizeSupported, enforceResolutionAlignment, planar, scaledDecoding};
+
+    ov::Tensor batchTensor(tensorInfo->getOvPrecision(), getShapeFromImages(numberOfInputs, target.height, target.width, firstImage.channels(), planar, tensorInfo));
+    const size_t imageSize = batchTensor.get_byte_size() / numberOfInputs;
+    char* data = reinterpret_cast<char*>(batchTensor.data());
+
+    std::vector<Status> statuses(numberOfInputs);
+    getImageDecodingPool().parallelFor(numberOfInputs, Config::instance().imageDecodingThreads(), [&](size_t i) {
+        try {
+            if (i == 0) {
+                statuses[i] = convertImageIntoSlot(firstImage, data, target);
+            } else {
+                statuses[i] = convertBatchImage(getInput(i), firstImage, data + i * imageSize, tensorInfo, target);
+            }
+        } catch (const cv::Exception& e) {
+            SPDLOG_DEBUG("Error during binary input conversion: {}", e.what());
+            statuses[i] = StatusCode::IMAGE_PARSING_FAILED;
+        } catch (const std::exception& e) {
+            SPDLOG_DEBUG("Error during binary input conversion: {}", e.what());
+            statuses[i] = StatusCode::INTERNAL_ERROR;
+        }
+    });
+    // report error of the first failing image, the same as sequential conversion would
+    for (const auto& imageStatus : statuses) {
+        if (imageStatus != StatusCode::OK) {
+            return imageStatus;
+        }
+    }
+    tensor = std::move(batchTensor);
+    return StatusCode::OK;
 }
 
 template <typename TensorType>
@@ -486,17 +643,11 @@ static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& s
         SPDLOG_DEBUG("Input native file format validation failed");
         return status;
     }
-    std::vector<cv::Mat> images;
-    status = convertTensorToMatsMatchingTensorInfo(src, images, tensorInfo, buffer);
+    status = convertImagesToTensor(src, tensor, tensorInfo, buffer);
     if (!status.ok()) {
         SPDLOG_DEBUG("Input native file format conversion failed");
         return status;
     }
-    tensor = convertMatsToTensor(images, tensorInfo);
-    if (!tensor) {
-        SPDLOG_DEBUG("Input native file format conversion failed");
-        return StatusCode::IMAGE_PARSING_FAILED;
-    }
     return StatusCode::OK;
 }
 
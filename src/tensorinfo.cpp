@@ -210,6 +210,18 @@ std::shared_ptr<const TensorInfo> TensorInfo::createIntersection(const TensorInf
         layout.value());
 }
 
+void TensorInfo::setAcceptedPrecisions(const std::set<Precision>& acceptedPrecisions) {
+    this->acceptedPrecisions = acceptedPrecisions;
+}
+
+const std::set<Precision>& TensorInfo::getAcceptedPrecisions() const {
+    return this->acceptedPrecisions;
+}
+
+bool TensorInfo::isPrecisionAccepted(Precision requestPrecision) const {
+    return (requestPrecision == this->precision) || (this->acceptedPrecisions.count(requestPrecision) > 0);
+}
+
 bool TensorInfo::isTensorSpecEqual(const TensorInfo& other) const {
     return (this->getShape() == other.getShape()) &&
            (this->getPrecision() == other.getPrecision()) &&
@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -191,6 +192,17 @@ public:
 
     const std::optional<Dimension> getBatchSize() const;
 
+    /**
+         * @brief Sets request precisions converted to tensor precision during deserialization
+         */
+    void setAcceptedPrecisions(const std::set<Precision>& acceptedPrecisions);
+    const std::set<Precision>& getAcceptedPrecisions() const;
+
+    /**
+         * @brief Checks if request data in given precision can be used for this tensor, either directly or after conversion
+         */
+    bool isPrecisionAccepted(Precision requestPrecision) const;
+
 protected:
     /**
          * @brief Input name
@@ -219,6 +231,11 @@ protected:
          */
     bool influencedByDemultiplexer = false;
 
+    /**
+         * @brief Request precisions other than tensor precision which are converted during deserialization
+         */
+    std::set<Precision> acceptedPrecisions;
+
     void createProcessingHints();
     TensorInfo::ProcessingHint preProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
     TensorInfo::ProcessingHint postProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
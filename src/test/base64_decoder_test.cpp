@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../base64_decoder.hpp"
+#include "absl/strings/escaping.h"
+
+using ovms::base64DecodedMaxSize;
+
+namespace {
+bool decode(const std::string& encoded, std::string& decoded) {
+    decoded.resize(base64DecodedMaxSize(encoded.size()));
+    size_t decodedSize = 0;
+    if (!ovms::decodeBase64(encoded.data(), encoded.size(), decoded.data(), decodedSize)) {
+        return false;
+    }
+    EXPECT_LE(decodedSize, decoded.size());
+    decoded.resize(decodedSize);
+    return true;
+}
+
+std::string randomBytes(size_t size, std::mt19937& generator) {
+    std::string bytes(size, '\0');
+    for (auto& byte : bytes) {
+        byte = static_cast<char>(generator());
+    }
+    return bytes;
+}
+}  // namespace
+
+TEST(Base64Decoder, Padding) {
+    std::string decoded;
+    ASSERT_TRUE(decode("", decoded));
+    EXPECT_EQ(decoded, "");
+    ASSERT_TRUE(decode("abcd", decoded));
+    EXPECT_EQ(decoded, "i\xB7\x1D");
+    ASSERT_TRUE(decode("YQ==", decoded));
+    EXPECT_EQ(decoded, "a");
+    ASSERT_TRUE(decode("YQ", decoded));
+    EXPECT_EQ(decoded, "a");
+    ASSERT_TRUE(decode("YWI=", decoded));
+    EXPECT_EQ(decoded, "ab");
+    ASSERT_TRUE(decode("YWI", decoded));
+    EXPECT_EQ(decoded, "ab");
+    EXPECT_FALSE(decode("abcde", decoded));
+    EXPECT_FALSE(decode("YQ=", decoded));
+    EXPECT_FALSE(decode("YWI==", decoded));
+    EXPECT_FALSE(decode("abcd==", decoded));
+    EXPECT_FALSE(decode("a===", decoded));
+    EXPECT_FALSE(decode("YQ==YQ==", decoded));
+}
+
+TEST(Base64Decoder, SkipsWhitespace) {
+    std::string decoded;
+    ASSERT_TRUE(decode(" Y W\nI=\r\n", decoded));
+    EXPECT_EQ(decoded, "ab");
+    ASSERT_TRUE(decode("YQ\n==\n", decoded));
+    EXPECT_EQ(decoded, "a");
+}
+
+TEST(Base64Decoder, DecodesLongTextSameAsAbsl) {
+    std::mt19937 generator(42);
+    for (size_t size = 0; size < 300; ++size) {
+        const std::string bytes = randomBytes(size, generator);
+        std::string encoded = absl::Base64Escape(bytes);
+        std::string decoded;
+        ASSERT_TRUE(decode(encoded, decoded)) << encoded;
+        EXPECT_EQ(decoded, bytes);
+        // whitespace in the middle of long text moves remaining blocks off group boundary
+        encoded.insert(encoded.size() / 3, "\n");
+        std::string expected;
+        ASSERT_TRUE(absl::Base64Unescape(encoded, &expected));
+        ASSERT_TRUE(decode(encoded, decoded)) << encoded;
+        EXPECT_EQ(decoded, expected);
+    }
+}
+
+TEST(Base64Decoder, RejectsInvalidCharacterAtAnyPosition) {
+    std::mt19937 generator(42);
+    const std::string encoded = absl::Base64Escape(randomBytes(120, generator));
+    std::string decoded;
+    for (char invalid : {'-', '_', '.', '!', '\0', '\x80', '\xFF'}) {
+        for (size_t position = 0; position < encoded.size(); ++position) {
+            std::string corrupted = encoded;
+            corrupted[position] = invalid;
+            EXPECT_FALSE(decode(corrupted, decoded)) << position;
+        }
+    }
+}
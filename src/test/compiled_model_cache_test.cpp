@@ -0,0 +1,249 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../compiled_model_cache.hpp"
+#include "../metric_config.hpp"
+#include "../metric_registry.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "test_utils.hpp"
+
+using testing::HasSubstr;
+
+static std::unique_ptr<ovms::CompiledModelVariant> createVariant(const std::string& inputName) {
+    auto variant = std::make_unique<ovms::CompiledModelVariant>();
+    variant->inputsInfo[inputName] = nullptr;
+    return variant;
+}
+
+TEST(CompiledModelCache, TakeReturnsStoredVariantOnce) {
+    ovms::CompiledModelCache cache(2);
+    cache.put("a", createVariant("a"));
+    EXPECT_EQ(cache.take("b"), nullptr);
+    auto variant = cache.take("a");
+    ASSERT_NE(variant, nullptr);
+    EXPECT_EQ(variant->inputsInfo.count("a"), 1);
+    EXPECT_EQ(cache.take("a"), nullptr);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(CompiledModelCache, LeastRecentlyUsedEvicted) {
+    ovms::CompiledModelCache cache(2);
+    cache.put("a", createVariant("a"));
+    cache.put("b", createVariant("b"));
+    // "a" becomes the most recently used one
+    cache.put("a", cache.take("a"));
+    cache.put("c", createVariant("c"));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.contains("a"));
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_TRUE(cache.contains("c"));
+}
+
+TEST(CompiledModelCache, ZeroCapacityStoresNothing) {
+    ovms::CompiledModelCache cache(0);
+    cache.put("a", createVariant("a"));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(CompiledModelCache, ShapesSignatureDependsOnNamesAndShapes) {
+    std::map<std::string, ovms::Shape> first{{"a", ovms::Shape{1, 10}}, {"b", ovms::Shape{2, 3}}};
+    std::map<std::string, ovms::Shape> second{{"a", ovms::Shape{2, 10}}, {"b", ovms::Shape{2, 3}}};
+    std::map<std::string, ovms::Shape> third{{"c", ovms::Shape{1, 10}}, {"b", ovms::Shape{2, 3}}};
+    EXPECT_EQ(ovms::createShapesSignature(first), ovms::createShapesSignature(first));
+    EXPECT_NE(ovms::createShapesSignature(first), ovms::createShapesSignature(second));
+    EXPECT_NE(ovms::createShapesSignature(first), ovms::createShapesSignature(third));
+}
+
+class ShapeCacheTest : public ::testing::Test {
+protected:
+    std::unique_ptr<ov::Core> ieCore;
+    ovms::MetricRegistry registry;
+    ovms::MetricConfig metricConfig;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+
+    void SetUp() override {
+        ieCore = std::make_unique<ov::Core>();
+        ASSERT_EQ(metricConfig.loadFromCLIString(true, ovms::METRIC_NAME_SHAPE_CACHE_HITS + "," + ovms::METRIC_NAME_SHAPE_CACHE_MISSES), ovms::StatusCode::OK);
+        config.setShapeCacheSize(1);
+    }
+
+    void checkShapeCacheMetrics(int hits, int misses) {
+        auto metrics = registry.collect();
+        EXPECT_THAT(metrics, HasSubstr(ovms::METRIC_NAME_SHAPE_CACHE_HITS + std::string{"{name=\"UNUSED_NAME\",version=\"1\"} "} + std::to_string(hits)));
+        EXPECT_THAT(metrics, HasSubstr(ovms::METRIC_NAME_SHAPE_CACHE_MISSES + std::string{"{name=\"UNUSED_NAME\",version=\"1\"} "} + std::to_string(misses)));
+    }
+};
+
+class ShapeCacheModelInstance : public ovms::ModelInstance {
+public:
+    bool failCompilation = false;
+
+    ShapeCacheModelInstance(ov::Core& ieCore, ovms::MetricRegistry* registry, const ovms::MetricConfig* metricConfig) :
+        ModelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore, registry, metricConfig) {}
+
+    const std::shared_ptr<ov::Model>& getModel() const {
+        return this->model;
+    }
+
+protected:
+    ovms::Status loadOVCompiledModel(const ovms::ModelConfig& config) override {
+        if (failCompilation) {
+            return ovms::StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
+        }
+        return ModelInstance::loadOVCompiledModel(config);
+    }
+};
+
+TEST_F(ShapeCacheTest, BatchSizeChangeReusesPreviouslyCompiledModel) {
+    config.setBatchingParams("auto");
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    const auto* initialQueue = &modelInstance.getInferRequestsQueue();
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{3, 10}));
+    EXPECT_NE(&modelInstance.getInferRequestsQueue(), initialQueue);
+    checkShapeCacheMetrics(0, 1);
+
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(1), {}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{1, 10}));
+    EXPECT_EQ(&modelInstance.getInferRequestsQueue(), initialQueue);
+    checkShapeCacheMetrics(1, 1);
+
+    // batch size 3 variant is still cached since only one variant is kept besides the used one
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{3, 10}));
+    checkShapeCacheMetrics(2, 1);
+
+    // batch size 5 was not seen before, batch size 1 variant is evicted afterwards
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(5), {}, unloadGuard), ovms::StatusCode::OK);
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(1), {}, unloadGuard), ovms::StatusCode::OK);
+    checkShapeCacheMetrics(2, 3);
+}
+
+TEST_F(ShapeCacheTest, SwitchingToCachedModelReportsItsQueueSize) {
+    ASSERT_EQ(metricConfig.loadFromCLIString(true, ovms::METRIC_NAME_SHAPE_CACHE_HITS + "," + ovms::METRIC_NAME_SHAPE_CACHE_MISSES + "," + ovms::METRIC_NAME_INFER_REQ_QUEUE_SIZE + "," + ovms::METRIC_NAME_STREAMS), ovms::StatusCode::OK);
+    config.setBatchingParams("auto");
+    config.setNireq(2);
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    // metrics are reported anew for the compiled model taken from cache
+    ASSERT_NE(modelInstance.getMetricReporter().inferReqQueueSize, nullptr);
+    modelInstance.getMetricReporter().inferReqQueueSize->set(0);
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(1), {}, unloadGuard), ovms::StatusCode::OK);
+    checkShapeCacheMetrics(1, 1);
+    EXPECT_EQ(modelInstance.getInferRequestsQueue().getSize(), 2);
+    EXPECT_THAT(registry.collect(), HasSubstr(ovms::METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\"UNUSED_NAME\",version=\"1\"} 2"}));
+}
+
+TEST_F(ShapeCacheTest, FailedCompilationKeepsCurrentCompiledModel) {
+    config.setBatchingParams("auto");
+    ShapeCacheModelInstance modelInstance(*ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    const auto* initialQueue = &modelInstance.getInferRequestsQueue();
+    const auto* initialModel = modelInstance.getModel().get();
+
+    modelInstance.failCompilation = true;
+    EXPECT_EQ(modelInstance.reloadModel(config, ovms::DynamicModelParameter(3)), ovms::StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE);
+    EXPECT_EQ(&modelInstance.getInferRequestsQueue(), initialQueue);
+    EXPECT_EQ(modelInstance.getModel().get(), initialModel);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{1, 10}));
+
+    // variant used before failure was not put into cache, so it is compiled again
+    modelInstance.failCompilation = false;
+    ASSERT_EQ(modelInstance.reloadModel(config, ovms::DynamicModelParameter(3)), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{3, 10}));
+    checkShapeCacheMetrics(0, 2);
+}
+
+TEST_F(ShapeCacheTest, SwitchingToCachedModelRestoresItsModel) {
+    config.setBatchingParams("auto");
+    ShapeCacheModelInstance modelInstance(*ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    const auto* initialModel = modelInstance.getModel().get();
+    ASSERT_EQ(modelInstance.reloadModel(config, ovms::DynamicModelParameter(3)), ovms::StatusCode::OK);
+    EXPECT_NE(modelInstance.getModel().get(), initialModel);
+    EXPECT_EQ(modelInstance.getModel()->input(DUMMY_MODEL_INPUT_NAME).get_partial_shape(), (ov::PartialShape{3, 10}));
+
+    ASSERT_EQ(modelInstance.reloadModel(config, ovms::DynamicModelParameter(1)), ovms::StatusCode::OK);
+    checkShapeCacheMetrics(1, 1);
+    EXPECT_EQ(modelInstance.getModel().get(), initialModel);
+    EXPECT_EQ(modelInstance.getModel()->input(DUMMY_MODEL_INPUT_NAME).get_partial_shape(), (ov::PartialShape{1, 10}));
+}
+
+TEST_F(ShapeCacheTest, ShapeChangeReusesPreviouslyCompiledModel) {
+    config.parseShapeParameter("auto");
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    std::map<std::string, ovms::shape_t> requestShapes = {{DUMMY_MODEL_INPUT_NAME, {2, 10}}};
+    ASSERT_EQ(modelInstance.reloadModel(std::nullopt, requestShapes, unloadGuard), ovms::StatusCode::OK);
+    const auto* queue = &modelInstance.getInferRequestsQueue();
+    requestShapes = {{DUMMY_MODEL_INPUT_NAME, {4, 10}}};
+    ASSERT_EQ(modelInstance.reloadModel(std::nullopt, requestShapes, unloadGuard), ovms::StatusCode::OK);
+    requestShapes = {{DUMMY_MODEL_INPUT_NAME, {2, 10}}};
+    ASSERT_EQ(modelInstance.reloadModel(std::nullopt, requestShapes, unloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), (ovms::Shape{2, 10}));
+    EXPECT_EQ(&modelInstance.getInferRequestsQueue(), queue);
+    checkShapeCacheMetrics(1, 2);
+}
+
+TEST_F(ShapeCacheTest, InferenceAfterSwitchingToCachedModel) {
+    config.setBatchingParams("auto");
+    ConstructorEnabledModelManager manager;
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    for (size_t batchSize : {1, 2, 1, 2}) {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+        ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+        std::vector<float> data(batchSize * DUMMY_MODEL_INPUT_SIZE, 3);
+        tensorflow::serving::PredictRequest request;
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{static_cast<int64_t>(batchSize), DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+        tensorflow::serving::PredictResponse response;
+        ASSERT_EQ(modelInstance->infer(&request, &response, unloadGuard), ovms::StatusCode::OK);
+        const auto& output = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.tensor_content().size(), batchSize * DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        const float* outputData = reinterpret_cast<const float*>(output.tensor_content().data());
+        EXPECT_EQ(std::vector<float>(outputData, outputData + batchSize * DUMMY_MODEL_INPUT_SIZE), std::vector<float>(batchSize * DUMMY_MODEL_INPUT_SIZE, 4));
+    }
+}
+
+TEST_F(ShapeCacheTest, ConfigReloadClearsCache) {
+    config.setBatchingParams("auto");
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    unloadGuard.reset();
+    ASSERT_EQ(modelInstance.reloadModel(config), ovms::StatusCode::OK);
+    ASSERT_EQ(modelInstance.reloadModel(ovms::Dimension(3), {}, unloadGuard), ovms::StatusCode::OK);
+    checkShapeCacheMetrics(0, 2);
+}
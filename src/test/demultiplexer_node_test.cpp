@@ -40,10 +40,7 @@ public:
     DemultiplexerDLNode(const std::string& nodeName, const std::string& modelName, std::optional<model_version_t> modelVersion, ModelManager& modelManager, std::unordered_map<std::string, std::string> nodeOutputNameAlias, std::optional<int32_t> demultiplyCount, const NodeSessionMetadata& meta) :
         DLNode(nodeName, modelName, modelVersion, modelManager, nodeOutputNameAlias, demultiplyCount.value_or(0)) {
         // createSession to have source session for fetchResults()
-        CollapseDetails collapsingDetails;
-        std::unique_ptr<NodeSession> nodeSession = createNodeSession(meta, collapsingDetails);
-        auto emplacePair = nodeSessions.emplace(meta.getSessionKey(), std::move(nodeSession));
-        EXPECT_TRUE(emplacePair.second);
+        EXPECT_NE(getNodeSession(meta), nullptr);
     }
 
     void setFetchResult(const TensorWithSourceMap& intermediateResults) {
@@ -262,14 +259,14 @@ TEST(DemultiplexerTest, GatherShardsWithExistingSourceTensors) {
         TensorWithSourceMap tensorMap{{DUMMY_MODEL_INPUT_NAME, tensorWithSource}};
         SessionResult result{subMetas[i], tensorMap};
         SessionResults results{
-            {"unused_session_key", result}};
+            {subMetas[i].getSessionKey(), result}};
         // Last ::setInput will trigger gathering step.
         dl_gather->setInputs(*dl_demulti, results);
         tensors[i].reset();
     }
 
     // Fetch session and its gathered input.
-    auto sessions = dl_gather->getReadySessions();
+    auto sessions = dl_gather->takeReadySessions();
     ASSERT_EQ(sessions.size(), 1);
     const auto& inputs = dl_gather->getInputs(sessions[0]);
     ASSERT_EQ(inputs.size(), 1);
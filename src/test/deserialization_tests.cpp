@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -632,3 +633,141 @@ INSTANTIATE_TEST_SUITE_P(
     [](const ::testing::TestParamInfo<DeserializeKFSTensorProto::ParamType>& info) {
         return toString(info.param);
     });
+
+template <typename T>
+static std::vector<T> tensorToVector(const ov::Tensor& tensor) {
+    const T* data = reinterpret_cast<const T*>(tensor.data());
+    return std::vector<T>(data, data + tensor.get_size());
+}
+
+static ::KFSRequest::InferInputTensor prepareKFSTypedInput(const std::string& datatype, int64_t size) {
+    ::KFSRequest::InferInputTensor tensorProto;
+    tensorProto.set_name("input");
+    tensorProto.set_datatype(datatype);
+    tensorProto.mutable_shape()->Add(size);
+    return tensorProto;
+}
+
+TEST(DeserializeKFSTypedContents, IntContentsTruncatedToTensorPrecision) {
+    auto tensorProto = prepareKFSTypedInput("INT8", 4);
+    for (int32_t value : {-128, -1, 0, 127}) {
+        tensorProto.mutable_contents()->add_int_contents(value);
+    }
+    auto tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::I8, ovms::Shape{4}, Layout{"C"});
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<int8_t>(tensor), ElementsAre(-128, -1, 0, 127));
+
+    tensorProto = prepareKFSTypedInput("INT16", 3);
+    for (int32_t value : {-32768, 5, 32767}) {
+        tensorProto.mutable_contents()->add_int_contents(value);
+    }
+    tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::I16, ovms::Shape{3}, Layout{"C"});
+    tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<int16_t>(tensor), ElementsAre(-32768, 5, 32767));
+}
+
+TEST(DeserializeKFSTypedContents, UintContentsTruncatedToTensorPrecision) {
+    auto tensorProto = prepareKFSTypedInput("UINT16", 3);
+    for (uint32_t value : {0, 300, 65535}) {
+        tensorProto.mutable_contents()->add_uint_contents(value);
+    }
+    auto tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::U16, ovms::Shape{3}, Layout{"C"});
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<uint16_t>(tensor), ElementsAre(0, 300, 65535));
+}
+
+TEST(DeserializeKFSTypedContents, SameSizeContentsCopied) {
+    auto tensorProto = prepareKFSTypedInput("FP32", 3);
+    for (float value : {1.5, -2.0, 3.25}) {
+        tensorProto.mutable_contents()->add_fp32_contents(value);
+    }
+    auto tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::FP32, ovms::Shape{3}, Layout{"C"});
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<float>(tensor), ElementsAre(1.5, -2.0, 3.25));
+
+    tensorProto = prepareKFSTypedInput("INT64", 2);
+    tensorProto.mutable_contents()->add_int64_contents(-1);
+    tensorProto.mutable_contents()->add_int64_contents(std::numeric_limits<int64_t>::max());
+    tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::I64, ovms::Shape{2}, Layout{"C"});
+    tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<int64_t>(tensor), ElementsAre(-1, std::numeric_limits<int64_t>::max()));
+}
+
+TEST(DeserializeTFSTypedValues, HalfAndIntValuesNarrowedTo16Bits) {
+    TFTensorProto tensorProto;
+    tensorProto.set_dtype(tensorflow::DataType::DT_HALF);
+    tensorProto.mutable_tensor_shape()->add_dim()->set_size(2);
+    // 1.0 and -2.0 in IEEE half precision
+    tensorProto.add_half_val(0x3C00);
+    tensorProto.add_half_val(0xC000);
+    auto tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::FP16, ovms::Shape{2}, Layout{"C"});
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<uint16_t>(tensor), ElementsAre(0x3C00, 0xC000));
+
+    tensorProto = TFTensorProto();
+    tensorProto.set_dtype(tensorflow::DataType::DT_UINT16);
+    tensorProto.mutable_tensor_shape()->add_dim()->set_size(2);
+    tensorProto.add_int_val(7);
+    tensorProto.add_int_val(65535);
+    tensorInfo = std::make_shared<const ovms::TensorInfo>("input", ovms::Precision::U16, ovms::Shape{2}, Layout{"C"});
+    tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_THAT(tensorToVector<uint16_t>(tensor), ElementsAre(7, 65535));
+}
+
+static std::shared_ptr<const ovms::TensorInfo> prepareTensorInfoAcceptingFP32(ovms::Precision precision, size_t size) {
+    auto tensorInfo = std::make_shared<ovms::TensorInfo>("input", precision, ovms::Shape{static_cast<int64_t>(size)}, Layout{"C"});
+    tensorInfo->setAcceptedPrecisions({ovms::Precision::FP32});
+    return tensorInfo;
+}
+
+TEST(DeserializeWithPrecisionConversion, KFSRawContentsConvertedToFP16) {
+    std::vector<float> data{1.0, -2.0, 0.5};
+    auto tensorProto = prepareKFSTypedInput("FP32", data.size());
+    std::string buffer(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    auto tensorInfo = prepareTensorInfoAcceptingFP32(ovms::Precision::FP16, data.size());
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, &buffer);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_EQ(tensor.get_element_type(), ov::element::f16);
+    EXPECT_THAT(tensorToVector<uint16_t>(tensor), ElementsAre(0x3C00, 0xC000, 0x3800));
+}
+
+TEST(DeserializeWithPrecisionConversion, KFSTypedContentsConvertedToI8) {
+    auto tensorProto = prepareKFSTypedInput("FP32", 3);
+    for (float value : {1.4, -200.0, 99.5}) {
+        tensorProto.mutable_contents()->add_fp32_contents(value);
+    }
+    auto tensorInfo = prepareTensorInfoAcceptingFP32(ovms::Precision::I8, 3);
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, nullptr);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_EQ(tensor.get_element_type(), ov::element::i8);
+    EXPECT_THAT(tensorToVector<int8_t>(tensor), ElementsAre(1, -128, 100));
+}
+
+TEST(DeserializeWithPrecisionConversion, TFSTensorContentConvertedToBF16) {
+    std::vector<float> data{1.0, -2.0};
+    TFTensorProto tensorProto;
+    tensorProto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    tensorProto.mutable_tensor_shape()->add_dim()->set_size(data.size());
+    tensorProto.set_tensor_content(std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)));
+    auto tensorInfo = prepareTensorInfoAcceptingFP32(ovms::Precision::BF16, data.size());
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_EQ(tensor.get_element_type(), ov::element::bf16);
+    EXPECT_THAT(tensorToVector<uint16_t>(tensor), ElementsAre(0x3F80, 0xC000));
+}
+
+TEST(DeserializeWithPrecisionConversion, InvalidDataSizeFails) {
+    std::vector<float> data{1.0, -2.0};
+    auto tensorProto = prepareKFSTypedInput("FP32", 3);
+    std::string buffer(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    auto tensorInfo = prepareTensorInfoAcceptingFP32(ovms::Precision::FP16, 3);
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, &buffer);
+    EXPECT_FALSE((bool)tensor);
+}
@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../dynamic_batching_scheduler.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "test_utils.hpp"
+
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+TEST(DynamicBatchingCopy, CopyToAndFromBatchFirstDimension) {
+    std::vector<float> first{1, 2, 3, 4};
+    std::vector<float> second{5, 6};
+    ov::Tensor firstTensor(ov::element::f32, {2, 2}, first.data());
+    ov::Tensor secondTensor(ov::element::f32, {1, 2}, second.data());
+    ov::Tensor batched(ov::element::f32, {3, 2});
+    ovms::copyToBatch(firstTensor, batched, 0, 0);
+    ovms::copyToBatch(secondTensor, batched, 0, 2);
+    float* data = reinterpret_cast<float*>(batched.data());
+    EXPECT_THAT(std::vector<float>(data, data + 6), ElementsAre(1, 2, 3, 4, 5, 6));
+
+    ov::Tensor out(ov::element::f32, {1, 2});
+    ovms::copyFromBatch(batched, out, 0, 2);
+    float* outData = reinterpret_cast<float*>(out.data());
+    EXPECT_THAT(std::vector<float>(outData, outData + 2), ElementsAre(5, 6));
+}
+
+TEST(DynamicBatchingCopy, CopyToAndFromBatchInnerDimension) {
+    // CN layout - batch is second dimension
+    std::vector<int32_t> first{1, 2};
+    std::vector<int32_t> second{3, 4, 5, 6};
+    ov::Tensor firstTensor(ov::element::i32, {2, 1}, first.data());
+    ov::Tensor secondTensor(ov::element::i32, {2, 2}, second.data());
+    ov::Tensor batched(ov::element::i32, {2, 3});
+    ovms::copyToBatch(firstTensor, batched, 1, 0);
+    ovms::copyToBatch(secondTensor, batched, 1, 1);
+    int32_t* data = reinterpret_cast<int32_t*>(batched.data());
+    EXPECT_THAT(std::vector<int32_t>(data, data + 6), ElementsAre(1, 3, 4, 2, 5, 6));
+
+    ov::Tensor out(ov::element::i32, {2, 2});
+    ovms::copyFromBatch(batched, out, 1, 1);
+    int32_t* outData = reinterpret_cast<int32_t*>(out.data());
+    EXPECT_THAT(std::vector<int32_t>(outData, outData + 4), ElementsAreArray(second));
+}
+
+class DynamicBatchingTest : public ::testing::Test {
+protected:
+    ConstructorEnabledModelManager manager;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+
+    void SetUp() override {
+        config.setBatchingParams("0");
+        config.setNireq(1);
+        config.setMaxBatchSize(8);
+        // long delay ensures that concurrently sent requests are merged
+        config.setMaxQueueDelayUs(200000);
+    }
+
+    void performDummyPrediction(size_t batchSize, float value) {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+        ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+        std::vector<float> data(batchSize * DUMMY_MODEL_INPUT_SIZE, value);
+        tensorflow::serving::PredictRequest request;
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{static_cast<int64_t>(batchSize), DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+        tensorflow::serving::PredictResponse response;
+        auto status = modelInstance->infer(&request, &response, unloadGuard);
+        ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+        ASSERT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+        const auto& output = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.tensor_shape().dim_size(), 2);
+        EXPECT_EQ(output.tensor_shape().dim(0).size(), batchSize);
+        EXPECT_EQ(output.tensor_shape().dim(1).size(), DUMMY_MODEL_INPUT_SIZE);
+        ASSERT_EQ(output.tensor_content().size(), batchSize * DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> actual(batchSize * DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(actual.data(), output.tensor_content().data(), output.tensor_content().size());
+        std::vector<float> expected(batchSize * DUMMY_MODEL_INPUT_SIZE, value + 1);
+        EXPECT_EQ(actual, expected);
+    }
+};
+
+TEST_F(DynamicBatchingTest, ModelLoadedWithDynamicBatchDimension) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    auto modelInstance = manager.findModelInstance(config.getName(), config.getVersion());
+    ASSERT_NE(modelInstance, nullptr);
+    const auto& inputShape = modelInstance->getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape();
+    EXPECT_EQ(inputShape[0], ovms::Dimension(1, 8));
+}
+
+TEST_F(DynamicBatchingTest, SingleRequest) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    performDummyPrediction(3, 7);
+}
+
+TEST_F(DynamicBatchingTest, ConcurrentRequestsWithDifferentBatchSizes) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 6; ++i) {
+        threads.emplace_back([this, i]() {
+            performDummyPrediction(1 + (i % 3), static_cast<float>(i));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(DynamicBatchingTest, RequestAboveMaxBatchSizeRejected) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+    tensorflow::serving::PredictRequest request;
+    preparePredictRequest(request,
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::signed_shape_t, ovms::Precision>{{9, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}});
+    tensorflow::serving::PredictResponse response;
+    EXPECT_EQ(modelInstance->infer(&request, &response, unloadGuard), ovms::StatusCode::INVALID_BATCH_SIZE);
+}
+
+class DynamicBatchingSchedulerWithCountersExposed : public ovms::DynamicBatchingScheduler {
+public:
+    using ovms::DynamicBatchingScheduler::DynamicBatchingScheduler;
+    size_t getExecutedBatchesCount() const { return executedBatchesCount.load(); }
+};
+
+TEST_F(DynamicBatchingTest, RequestsScheduledFromSingleThreadAreMerged) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+    DynamicBatchingSchedulerWithCountersExposed scheduler(*modelInstance, 8, std::chrono::microseconds(200000));
+    const size_t requestsCount = 4;
+    std::vector<std::vector<float>> data(requestsCount);
+    std::vector<ovms::TensorMap> inputs(requestsCount);
+    std::vector<ovms::TensorMap> outputs(requestsCount);
+    std::vector<std::promise<ovms::Status>> completed(requestsCount);
+    std::vector<std::future<ovms::Status>> futures;
+    for (size_t i = 0; i < requestsCount; ++i) {
+        data[i] = std::vector<float>(DUMMY_MODEL_INPUT_SIZE, static_cast<float>(i));
+        inputs[i][DUMMY_MODEL_INPUT_NAME] = ov::Tensor(ov::element::f32, {1, DUMMY_MODEL_INPUT_SIZE}, data[i].data());
+        futures.push_back(completed[i].get_future());
+        ASSERT_EQ(scheduler.scheduleAsync(inputs[i], outputs[i], [&completed, i](ovms::Status status) {
+            completed[i].set_value(status);
+        }),
+            ovms::StatusCode::OK);
+    }
+    // scheduling thread does not wait for the batch to fill, batch is not full so it waits for max queue delay
+    for (auto& future : futures) {
+        EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+    }
+    for (size_t i = 0; i < requestsCount; ++i) {
+        ASSERT_EQ(futures[i].wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        EXPECT_EQ(futures[i].get(), ovms::StatusCode::OK);
+        ASSERT_EQ(outputs[i].count(DUMMY_MODEL_OUTPUT_NAME), 1);
+        const auto& output = outputs[i].at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.get_shape(), (ov::Shape{1, DUMMY_MODEL_INPUT_SIZE}));
+        const float* outputData = reinterpret_cast<const float*>(output.data());
+        EXPECT_EQ(std::vector<float>(outputData, outputData + DUMMY_MODEL_INPUT_SIZE), std::vector<float>(DUMMY_MODEL_INPUT_SIZE, i + 1));
+    }
+    EXPECT_EQ(scheduler.getExecutedBatchesCount(), 1);
+}
+
+TEST_F(DynamicBatchingTest, FullBatchExecutedWithoutWaitingForDelay) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+    DynamicBatchingSchedulerWithCountersExposed scheduler(*modelInstance, 2, std::chrono::microseconds(60000000));
+    std::vector<float> data(2 * DUMMY_MODEL_INPUT_SIZE, 1);
+    ovms::TensorMap inputs{{DUMMY_MODEL_INPUT_NAME, ov::Tensor(ov::element::f32, {2, DUMMY_MODEL_INPUT_SIZE}, data.data())}};
+    ovms::TensorMap outputs;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(scheduler.schedule(inputs, outputs), ovms::StatusCode::OK);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+    EXPECT_EQ(scheduler.getExecutedBatchesCount(), 1);
+}
+
+TEST_F(DynamicBatchingTest, InferAsyncRequestsFromSingleThreadAreMerged) {
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    const size_t requestsCount = 4;
+    std::vector<tensorflow::serving::PredictRequest> requests(requestsCount);
+    std::vector<tensorflow::serving::PredictResponse> responses(requestsCount);
+    std::vector<std::promise<ovms::Status>> completed(requestsCount);
+    std::vector<std::future<ovms::Status>> futures;
+    // single thread sends all requests, as completion queue thread of asynchronous gRPC server does
+    for (size_t i = 0; i < requestsCount; ++i) {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+        ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+        std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, static_cast<float>(i));
+        preparePredictRequest(requests[i],
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+        futures.push_back(completed[i].get_future());
+        auto status = modelInstance->inferAsync(&requests[i], &responses[i], unloadGuard, [&completed, i](ovms::Status status) {
+            completed[i].set_value(status);
+        });
+        ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    }
+    for (auto& future : futures) {
+        EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+    }
+    for (size_t i = 0; i < requestsCount; ++i) {
+        ASSERT_EQ(futures[i].wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        EXPECT_EQ(futures[i].get(), ovms::StatusCode::OK);
+        const auto& output = responses[i].outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.tensor_content().size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> actual(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(actual.data(), output.tensor_content().data(), output.tensor_content().size());
+        EXPECT_EQ(actual, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, i + 1));
+    }
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../float_formatter.hpp"
+
+using ovms::formatFloat;
+
+namespace {
+std::string format(float value) {
+    char buffer[ovms::FORMATTED_FLOAT_MAX_LENGTH];
+    char* end = formatFloat(value, buffer);
+    EXPECT_LE(static_cast<size_t>(end - buffer), ovms::FORMATTED_FLOAT_MAX_LENGTH);
+    return std::string(buffer, end);
+}
+
+size_t countSignificantDigits(const std::string& text) {
+    std::string digits;
+    for (char c : text) {
+        if (c == 'e') {
+            break;
+        }
+        if (c >= '0' && c <= '9') {
+            digits += c;
+        }
+    }
+    digits.erase(0, digits.find_first_not_of('0'));
+    digits.erase(digits.find_last_not_of('0') + 1);
+    return digits.empty() ? 1 : digits.size();
+}
+
+// Number of significant digits of the shortest %g representation parsed back to the same float
+size_t shortestPrecision(float value) {
+    char buffer[64];
+    for (int precision = 1; precision < 9; ++precision) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if (std::strtof(buffer, nullptr) == value) {
+            return precision;
+        }
+    }
+    return 9;
+}
+}  // namespace
+
+TEST(FloatFormatter, Notation) {
+    EXPECT_EQ(format(0.0f), "0.0");
+    EXPECT_EQ(format(-0.0f), "-0.0");
+    EXPECT_EQ(format(1.0f), "1.0");
+    EXPECT_EQ(format(-92.5f), "-92.5");
+    EXPECT_EQ(format(0.1f), "0.1");
+    EXPECT_EQ(format(1.0f / 3), "0.33333334");
+    EXPECT_EQ(format(0.001234f), "0.001234");
+    EXPECT_EQ(format(1.5e-7f), "1.5e-7");
+    EXPECT_EQ(format(123456792.0f), "123456790.0");
+    EXPECT_EQ(format(1e21f), "1e21");
+    EXPECT_EQ(format(1e20f), "100000000000000000000.0");
+    EXPECT_EQ(format(1.25e30f), "1.25e30");
+    EXPECT_EQ(format(std::numeric_limits<float>::max()), "3.4028235e38");
+    EXPECT_EQ(format(std::numeric_limits<float>::min()), "1.1754944e-38");
+    EXPECT_EQ(format(std::numeric_limits<float>::denorm_min()), "1e-45");
+    EXPECT_EQ(format(-std::numeric_limits<float>::denorm_min()), "-1e-45");
+}
+
+TEST(FloatFormatter, RoundTripsWithShortestRepresentation) {
+    for (uint64_t bits = 0; bits < 0x7F800000; bits += 7919) {
+        uint32_t floatBits = static_cast<uint32_t>(bits);
+        float value;
+        std::memcpy(&value, &floatBits, sizeof(value));
+        const std::string text = format(value);
+        ASSERT_EQ(std::strtof(text.c_str(), nullptr), value) << text;
+        ASSERT_EQ(countSignificantDigits(text), shortestPrecision(value)) << text;
+    }
+}
@@ -252,9 +252,11 @@ TEST_F(GatherNodeTest, FullFlowGatherInNonExitNode) {
     oneDummyNodeSessionResults2.insert({subsessions[1].getSessionKey(), {subsessions[1], dummy2Result}});
     // actual test steps
     ASSERT_EQ(gather2DummyNode.setInputs(oneDummyNode1, oneDummyNodeSessionResults1), StatusCode::OK);
+    EXPECT_TRUE(gather2DummyNode.takeReadySessions().empty());
     ASSERT_EQ(gather2DummyNode.setInputs(oneDummyNode1, oneDummyNodeSessionResults2), StatusCode::OK);
-    auto readySessions = gather2DummyNode.getReadySessions();
+    auto readySessions = gather2DummyNode.takeReadySessions();
     ASSERT_EQ(readySessions.size(), 1);
+    EXPECT_TRUE(gather2DummyNode.takeReadySessions().empty());
     const auto& inputs = gather2DummyNode.getInputsFromInputHandler(subsessions[0].getSessionKey({demultiplexerNodeName}));
     EXPECT_EQ(inputs.size(), 1);
     ASSERT_NE(inputs.find(DUMMY_MODEL_INPUT_NAME), inputs.end());
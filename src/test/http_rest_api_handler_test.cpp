@@ -990,6 +990,20 @@ TEST_F(ConfigReload, StartWith1DummyPipelineThenReloadToAddPipeline) {
     EXPECT_EQ(status, ovms::StatusCode::OK_RELOADED);
 }
 
+class SystemSharedMemoryApi : public ConfigApi {};
+
+TEST_F(SystemSharedMemoryApi, disabledByDefault) {
+    ovms::Server& ovmsServer = ovms::Server::instance();
+    TestHelper1 t(*this);
+    auto handler = ovms::HttpRestApiHandler(ovmsServer, 10);
+    std::string response;
+    ovms::HttpRequestComponents comp;
+    comp.shared_memory_region_name = "region";
+    EXPECT_EQ(handler.processSystemSharedMemoryRegisterKFSRequest(comp, response, "{\"key\":\"/region\",\"byte_size\":16}"), ovms::StatusCode::SHARED_MEMORY_DISABLED);
+    EXPECT_EQ(handler.processSystemSharedMemoryStatusKFSRequest(comp, response, ""), ovms::StatusCode::SHARED_MEMORY_DISABLED);
+    EXPECT_EQ(handler.processSystemSharedMemoryUnregisterKFSRequest(comp, response, ""), ovms::StatusCode::SHARED_MEMORY_DISABLED);
+}
+
 class ConfigStatus : public ConfigApi {};
 
 TEST_F(ConfigStatus, configWithPipelines) {
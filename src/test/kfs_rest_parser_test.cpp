@@ -13,12 +13,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <cstring>
 #include <regex>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../capi_frontend/buffer.hpp"
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferencetensor.hpp"
+#include "../request_arena.hpp"
 #include "../rest_parser.hpp"
 #include "../status.hpp"
 
@@ -981,3 +987,108 @@ TEST_F(KFSRestParserTest, parseNegativeBatch) {
         ASSERT_NE(status, StatusCode::OK) << "for value: " << replace;
     }
 }
+
+TEST(KFSRestParserArena, ParsesRequestOnArena) {
+    std::string request = R"({"id":"1","inputs":[{"name":"input0","shape":[2,2],"datatype":"FP32","data":[1.0,2.0,3.0,4.0]},{"name":"input1","shape":[1],"datatype":"BYTES","data":["abc"]}]})";
+    RequestArena arena;
+    KFSRestParser arenaParser(arena.get());
+    KFSRestParser heapParser;
+    ASSERT_EQ(arenaParser.parse(request.c_str()), StatusCode::OK);
+    ASSERT_EQ(heapParser.parse(request.c_str()), StatusCode::OK);
+    EXPECT_EQ(heapParser.getProto().GetArena(), nullptr);
+    EXPECT_EQ(arenaParser.getProto().GetArena(), arena.get());
+    ASSERT_EQ(arenaParser.getProto().inputs_size(), 2);
+    EXPECT_EQ(arenaParser.getProto().inputs(0).GetArena(), arena.get());
+    EXPECT_EQ(arenaParser.getProto().DebugString(), heapParser.getProto().DebugString());
+
+    // swapping messages of the same arena moves inputs without copying them
+    auto* swapped = arena.create<::KFSRequest>();
+    const auto* input = &arenaParser.getProto().inputs(0);
+    swapped->Swap(&arenaParser.getProto());
+    EXPECT_EQ(&swapped->inputs(0), input);
+    EXPECT_EQ(swapped->DebugString(), heapParser.getProto().DebugString());
+}
+
+class KFSRestTensorParserTest : public Test {
+public:
+    InferenceRequest request{"dummy", 1};
+    KFSRestTensorParser parser{request};
+
+    bool parse(const std::string& body) {
+        return parser.parse(body, body.size());
+    }
+};
+
+TEST_F(KFSRestTensorParserTest, ParsesDataIntoTensors) {
+    std::string body = R"({"id":"abc","inputs":[{"name":"input0","shape":[2,2],"datatype":"FP32","data":[[1,2.5],[3,4]]},{"name":"input1","shape":[3],"datatype":"INT8","data":[-1,0,1]}]})";
+    ASSERT_TRUE(parse(body));
+    EXPECT_EQ(parser.getId(), "abc");
+    EXPECT_TRUE(parser.getBinaryOutputsNames().empty());
+    ASSERT_EQ(request.getInputsSize(), 2);
+
+    const InferenceTensor* tensor = nullptr;
+    ASSERT_EQ(request.getInput("input0", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getDataType(), OVMS_DATATYPE_FP32);
+    EXPECT_THAT(tensor->getShape(), ElementsAre(2, 2));
+    ASSERT_EQ(tensor->getBuffer()->getByteSize(), 4 * sizeof(float));
+    const float* floats = static_cast<const float*>(tensor->getBuffer()->data());
+    EXPECT_THAT(std::vector<float>(floats, floats + 4), ElementsAre(1, 2.5, 3, 4));
+
+    ASSERT_EQ(request.getInput("input1", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getDataType(), OVMS_DATATYPE_I8);
+    const int8_t* ints = static_cast<const int8_t*>(tensor->getBuffer()->data());
+    EXPECT_THAT(std::vector<int8_t>(ints, ints + 3), ElementsAre(-1, 0, 1));
+}
+
+TEST_F(KFSRestTensorParserTest, BinaryInputsFollowJsonInOrder) {
+    std::string json = R"({"inputs":[{"name":"input0","shape":[2],"datatype":"INT32","parameters":{"binary_data_size":8}},{"name":"input1","shape":[1],"datatype":"INT16"}]})";
+    std::vector<int32_t> first{7, -7};
+    int16_t second = 3;
+    std::string body = json;
+    body.append(reinterpret_cast<const char*>(first.data()), first.size() * sizeof(int32_t));
+    body.append(reinterpret_cast<const char*>(&second), sizeof(second));
+    ASSERT_TRUE(parser.parse(body, json.size()));
+
+    const InferenceTensor* tensor = nullptr;
+    ASSERT_EQ(request.getInput("input0", &tensor), StatusCode::OK);
+    ASSERT_EQ(tensor->getBuffer()->getByteSize(), 8);
+    EXPECT_EQ(std::memcmp(tensor->getBuffer()->data(), first.data(), 8), 0);
+    // aligned binary input is used in place
+    if (reinterpret_cast<uintptr_t>(body.data() + json.size()) % sizeof(int32_t) == 0) {
+        EXPECT_EQ(tensor->getBuffer()->data(), body.data() + json.size());
+    }
+    ASSERT_EQ(request.getInput("input1", &tensor), StatusCode::OK);
+    ASSERT_EQ(tensor->getBuffer()->getByteSize(), sizeof(second));
+    EXPECT_EQ(*static_cast<const int16_t*>(tensor->getBuffer()->data()), second);
+}
+
+TEST_F(KFSRestTensorParserTest, BinaryOutputsNames) {
+    std::string body = R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP32","data":[1]}],"parameters":{"binary_data_output":true},"outputs":[{"name":"output0"},{"name":"output1","parameters":{"binary_data":false}},{"name":"output2","parameters":{"binary_data":true}}]})";
+    ASSERT_TRUE(parse(body));
+    EXPECT_THAT(parser.getBinaryOutputsNames(), ElementsAre("output0", "output2"));
+}
+
+TEST_F(KFSRestTensorParserTest, LeavesUnsupportedRequestsToRequestProto) {
+    for (std::string body : std::vector<std::string>{
+             // datatypes without direct tensor representation
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"BYTES","data":["abc"]}]})",
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP16","data":[1.0]}]})",
+             // data preceding metadata of input
+             R"({"inputs":[{"name":"input0","data":[1.0],"shape":[1],"datatype":"FP32"}]})",
+             // input in shared memory
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP32","parameters":{"shared_memory_region":"r","shared_memory_byte_size":4}}]})",
+             // request parameters other than binary_data_output
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP32","data":[1.0]}],"parameters":{"sequence_id":1}})",
+             // invalid requests are reported by request proto processing
+             R"({"inputs":[{"name":"input0","shape":[2],"datatype":"FP32","data":[1.0]}]})",
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"INT32","data":[1.5]}]})",
+             R"({"inputs":[{"name":"input0","shape":[0],"datatype":"FP32","data":[]}]})",
+             R"({"inputs":[]})",
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP32"}]})",
+             R"({"id":1,"inputs":[{"name":"input0","shape":[1],"datatype":"FP32","data":[1.0]}]})",
+             R"({"inputs":[{"name":"input0","shape":[1],"datatype":"FP32","data":[1.0]}],"inputs":[]})"}) {
+        InferenceRequest request("dummy", 1);
+        KFSRestTensorParser parser(request);
+        EXPECT_FALSE(parser.parse(body, body.size())) << body;
+    }
+}
@@ -13,6 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <memory>
 #include <string>
 
@@ -65,10 +69,11 @@ public:
             (char*)"auto",
             (char*)"--port",
             (char*)port.c_str(),
+            (char*)"--allow_system_shared_memory",
             nullptr};
         thread = std::make_unique<std::thread>(
             [&argv]() {
-                ASSERT_EQ(EXIT_SUCCESS, server->start(11, argv));
+                ASSERT_EQ(EXIT_SUCCESS, server->start(12, argv));
             });
         auto start = std::chrono::high_resolution_clock::now();
         while ((server->getModuleState(SERVABLE_MANAGER_MODULE_NAME) != ovms::ModuleState::INITIALIZED) &&
@@ -524,6 +529,14 @@ TEST_F(HttpRestApiHandlerTest, binaryInputsBYTES_BinaryDataSizeBiggerThanActualB
     // Data correctness will be checked at the stage of grpc input deserialization
 }
 
+TEST_F(HttpRestApiHandlerTest, binaryInputs_InferenceHeaderContentLengthBiggerThanBody) {
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1],\"datatype\":\"BYTES\",\"parameters\":{\"binary_data_size\":8}}]}";
+
+    ::KFSRequest grpc_request;
+    int inferenceHeaderContentLength = request_body.size() + 1;
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, inferenceHeaderContentLength), ovms::StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID);
+}
+
 static void assertBinaryInputsINT16(const std::string& modelName, const std::optional<uint64_t>& modelVersion, ::KFSRequest& grpc_request, std::string binaryData) {
     assertSingleBinaryInput(modelName, modelVersion, grpc_request);
 
@@ -794,3 +807,88 @@ TEST_F(HttpRestApiHandlerTest, serverMetadata) {
     ASSERT_EQ(std::string(doc["name"].GetString()), PROJECT_NAME);
     ASSERT_EQ(std::string(doc["version"].GetString()), PROJECT_VERSION);
 }
+
+TEST_F(HttpRestApiHandlerTest, RegexParseSystemSharedMemory) {
+    ovms::HttpRequestComponents comp;
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v2/systemsharedmemory/status"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::KFS_SystemSharedMemoryStatus);
+    ASSERT_EQ(comp.shared_memory_region_name, "");
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/systemsharedmemory/region/input/register"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::KFS_SystemSharedMemoryRegister);
+    ASSERT_EQ(comp.shared_memory_region_name, "input");
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/systemsharedmemory/region/input/unregister"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::KFS_SystemSharedMemoryUnregister);
+    ASSERT_EQ(comp.shared_memory_region_name, "input");
+
+    comp = ovms::HttpRequestComponents();
+    EXPECT_EQ(handler->parseRequestComponents(comp, "GET", "/v2/systemsharedmemory/region/input/register"), StatusCode::REST_INVALID_URL);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferRequestWithSystemSharedMemory) {
+    const std::string key = "/ovms_kfs_rest_test_" + std::to_string(getpid());
+    const size_t objectSize = 4096;
+    int fd = shm_open(key.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    ASSERT_NE(fd, -1);
+    ASSERT_EQ(ftruncate(fd, objectSize), 0);
+    void* address = mmap(nullptr, objectSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(address, MAP_FAILED);
+    float* clientMemory = static_cast<float*>(address);
+    for (int i = 0; i < 10; ++i) {
+        clientMemory[i] = i;
+    }
+
+    std::string response;
+    ovms::HttpResponseComponents responseComponents;
+    ovms::HttpRequestComponents comp;
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/systemsharedmemory/region/input/register"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("{\"key\":\"" + key + "\",\"offset\":0,\"byte_size\":40}", &response, comp, responseComponents), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("{\"key\":\"" + key + "\",\"offset\":0,\"byte_size\":40}", &response, comp, responseComponents), StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED);
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/systemsharedmemory/region/output/register"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("{\"key\":\"" + key + "\",\"offset\":1024,\"byte_size\":1024}", &response, comp, responseComponents), StatusCode::OK);
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v2/systemsharedmemory/region/output/status"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("", &response, comp, responseComponents), StatusCode::OK);
+    rapidjson::Document statusDoc;
+    statusDoc.Parse(response.c_str());
+    ASSERT_TRUE(statusDoc.IsArray());
+    ASSERT_EQ(statusDoc.Size(), 1);
+    EXPECT_EQ(std::string(statusDoc[0]["name"].GetString()), "output");
+    EXPECT_EQ(std::string(statusDoc[0]["key"].GetString()), key);
+    EXPECT_EQ(statusDoc[0]["offset"].GetUint64(), 1024);
+    EXPECT_EQ(statusDoc[0]["byte_size"].GetUint64(), 1024);
+
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,10],\"datatype\":\"FP32\","
+                               "\"parameters\":{\"shared_memory_region\":\"input\",\"shared_memory_byte_size\":40}}],"
+                               "\"outputs\":[{\"name\":\"a\",\"parameters\":{\"shared_memory_region\":\"output\",\"shared_memory_byte_size\":40,\"shared_memory_offset\":8}}]}";
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/models/dummy/versions/1/infer"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor(request_body, &response, comp, responseComponents), StatusCode::OK);
+    rapidjson::Document doc;
+    doc.Parse(response.c_str());
+    auto output = doc["outputs"].GetArray()[0].GetObject();
+    EXPECT_EQ(std::string(output["name"].GetString()), "a");
+    EXPECT_FALSE(output.HasMember("data"));
+    EXPECT_EQ(std::string(output["parameters"]["shared_memory_region"].GetString()), "output");
+    EXPECT_EQ(output["parameters"]["shared_memory_byte_size"].GetInt64(), 40);
+    const float* outputMemory = reinterpret_cast<const float*>(static_cast<char*>(address) + 1024 + 8);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(outputMemory[i], i + 1);
+    }
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v2/systemsharedmemory/unregister"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("", &response, comp, responseComponents), StatusCode::OK);
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v2/systemsharedmemory/status"), StatusCode::OK);
+    ASSERT_EQ(handler->dispatchToProcessor("", &response, comp, responseComponents), StatusCode::OK);
+    EXPECT_EQ(response, "[]");
+    munmap(address, objectSize);
+    shm_unlink(key.c_str());
+}
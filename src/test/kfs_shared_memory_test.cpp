@@ -0,0 +1,296 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../kfs_frontend/kfs_shared_memory.hpp"
+#include "../serialization.hpp"
+#include "../status.hpp"
+#include "../tensorinfo.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+using testing::ElementsAre;
+
+namespace {
+constexpr size_t OBJECT_SIZE = 4096;
+
+void setSharedMemoryParameters(google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, const std::string& region, int64_t byteSize, int64_t offset) {
+    parameters[SHARED_MEMORY_REGION_PARAMETER].set_string_param(region);
+    parameters[SHARED_MEMORY_BYTE_SIZE_PARAMETER].set_int64_param(byteSize);
+    parameters[SHARED_MEMORY_OFFSET_PARAMETER].set_int64_param(offset);
+}
+}  // namespace
+
+class KFSSharedMemoryTest : public ::testing::Test {
+protected:
+    std::string key;
+    char* clientMemory = nullptr;
+
+    void SetUp() override {
+        // client side of shared memory, as created by local KServe client
+        key = "/ovms_shared_memory_test_" + std::to_string(getpid());
+        int fd = shm_open(key.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+        ASSERT_NE(fd, -1) << std::strerror(errno);
+        ASSERT_EQ(ftruncate(fd, OBJECT_SIZE), 0);
+        void* address = mmap(nullptr, OBJECT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        ASSERT_NE(address, MAP_FAILED);
+        clientMemory = static_cast<char*>(address);
+        std::memset(clientMemory, 0, OBJECT_SIZE);
+    }
+
+    void TearDown() override {
+        SharedMemoryRegistry::instance().unregisterAllRegions();
+        if (clientMemory != nullptr) {
+            munmap(clientMemory, OBJECT_SIZE);
+        }
+        shm_unlink(key.c_str());
+    }
+
+    float* clientFloats(size_t offset) {
+        return reinterpret_cast<float*>(clientMemory + offset);
+    }
+};
+
+TEST_F(KFSSharedMemoryTest, RegisterAndUnregister) {
+    auto& registry = SharedMemoryRegistry::instance();
+    ASSERT_EQ(registry.registerRegion("input", key, 0, 1024), StatusCode::OK);
+    ASSERT_EQ(registry.registerRegion("output", key, 1024, 2048), StatusCode::OK);
+    EXPECT_EQ(registry.registerRegion("input", key, 0, 16), StatusCode::SHARED_MEMORY_REGION_ALREADY_REGISTERED);
+
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    ASSERT_EQ(registry.getRegions("", regions), StatusCode::OK);
+    ASSERT_EQ(regions.size(), 2);
+    EXPECT_EQ(regions[0]->getName(), "input");
+    EXPECT_EQ(regions[1]->getName(), "output");
+    EXPECT_EQ(regions[1]->getKey(), key);
+    EXPECT_EQ(regions[1]->getOffset(), 1024);
+    EXPECT_EQ(regions[1]->getByteSize(), 2048);
+    // regions of the same object are mapped at the same offsets as in client memory
+    regions[1]->data()[0] = 42;
+    EXPECT_EQ(clientMemory[1024], 42);
+
+    regions.clear();
+    ASSERT_EQ(registry.getRegions("output", regions), StatusCode::OK);
+    ASSERT_EQ(regions.size(), 1);
+    EXPECT_EQ(registry.getRegions("missing", regions), StatusCode::SHARED_MEMORY_REGION_NOT_FOUND);
+
+    EXPECT_EQ(registry.unregisterRegion("input"), StatusCode::OK);
+    EXPECT_EQ(registry.unregisterRegion("input"), StatusCode::SHARED_MEMORY_REGION_NOT_FOUND);
+    registry.unregisterAllRegions();
+    regions.clear();
+    ASSERT_EQ(registry.getRegions("", regions), StatusCode::OK);
+    EXPECT_TRUE(regions.empty());
+}
+
+TEST_F(KFSSharedMemoryTest, RegisterInvalidRegion) {
+    auto& registry = SharedMemoryRegistry::instance();
+    EXPECT_EQ(registry.registerRegion("region", "/ovms_shared_memory_test_missing", 0, 16), StatusCode::SHARED_MEMORY_REGION_OPEN_FAILED);
+    EXPECT_EQ(registry.registerRegion("region", key, 0, OBJECT_SIZE + 1), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+    EXPECT_EQ(registry.registerRegion("region", key, OBJECT_SIZE, 1), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+    EXPECT_EQ(registry.registerRegion("region", key, 0, 0), StatusCode::SHARED_MEMORY_INVALID_PARAMETERS);
+    EXPECT_EQ(registry.registerRegion("region", key, OBJECT_SIZE - 16, 16), StatusCode::OK);
+}
+
+TEST_F(KFSSharedMemoryTest, GetMemoryChecksRange) {
+    auto& registry = SharedMemoryRegistry::instance();
+    ASSERT_EQ(registry.registerRegion("region", key, 64, 1024), StatusCode::OK);
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data = nullptr;
+    ASSERT_EQ(registry.getMemory({"region", 16, 8}, region, data), StatusCode::OK);
+    ASSERT_NE(region, nullptr);
+    data[0] = 7;
+    EXPECT_EQ(clientMemory[64 + 8], 7);
+    EXPECT_EQ(registry.getMemory({"region", 1024, 0}, region, data), StatusCode::OK);
+    EXPECT_EQ(registry.getMemory({"region", 1017, 8}, region, data), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+    EXPECT_EQ(registry.getMemory({"region", 1, 1024}, region, data), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+    EXPECT_EQ(registry.getMemory({"missing", 1, 0}, region, data), StatusCode::SHARED_MEMORY_REGION_NOT_FOUND);
+}
+
+TEST_F(KFSSharedMemoryTest, GetMemoryRejectsTruncatedObject) {
+    auto& registry = SharedMemoryRegistry::instance();
+    ASSERT_EQ(registry.registerRegion("region", key, 64, 1024), StatusCode::OK);
+    int fd = shm_open(key.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    ASSERT_NE(fd, -1) << std::strerror(errno);
+    ASSERT_EQ(ftruncate(fd, 512), 0);
+    close(fd);
+    std::shared_ptr<const SharedMemoryRegion> region;
+    char* data = nullptr;
+    EXPECT_EQ(registry.getMemory({"region", 16, 0}, region, data), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+    EXPECT_EQ(data, nullptr);
+}
+
+TEST_F(KFSSharedMemoryTest, GetReferenceFromParameters) {
+    ::KFSRequest::InferInputTensor input;
+    EXPECT_FALSE(usesSharedMemory(input.parameters()));
+    setSharedMemoryParameters(*input.mutable_parameters(), "region", 40, 8);
+    EXPECT_TRUE(usesSharedMemory(input.parameters()));
+    SharedMemoryReference reference;
+    ASSERT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::OK);
+    EXPECT_EQ(reference.regionName, "region");
+    EXPECT_EQ(reference.byteSize, 40);
+    EXPECT_EQ(reference.offset, 8);
+
+    // offset is optional
+    input.mutable_parameters()->erase(SHARED_MEMORY_OFFSET_PARAMETER);
+    reference = SharedMemoryReference();
+    ASSERT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::OK);
+    EXPECT_EQ(reference.offset, 0);
+
+    (*input.mutable_parameters())[SHARED_MEMORY_OFFSET_PARAMETER].set_int64_param(-1);
+    EXPECT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::SHARED_MEMORY_INVALID_PARAMETERS);
+    input.mutable_parameters()->erase(SHARED_MEMORY_OFFSET_PARAMETER);
+    (*input.mutable_parameters())[SHARED_MEMORY_BYTE_SIZE_PARAMETER].set_string_param("40");
+    EXPECT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::SHARED_MEMORY_INVALID_PARAMETERS);
+    input.mutable_parameters()->erase(SHARED_MEMORY_BYTE_SIZE_PARAMETER);
+    EXPECT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::SHARED_MEMORY_INVALID_PARAMETERS);
+    (*input.mutable_parameters())[SHARED_MEMORY_REGION_PARAMETER].set_int64_param(1);
+    EXPECT_EQ(getSharedMemoryReference(input.parameters(), reference), StatusCode::SHARED_MEMORY_INVALID_PARAMETERS);
+}
+
+TEST_F(KFSSharedMemoryTest, MakeTensorWrapsRegionMemory) {
+    ASSERT_EQ(SharedMemoryRegistry::instance().registerRegion("input", key, 128, 256), StatusCode::OK);
+    for (int i = 0; i < DUMMY_MODEL_INPUT_SIZE; ++i) {
+        clientFloats(128 + 16)[i] = i;
+    }
+    ::KFSRequest::InferInputTensor input;
+    input.set_name(DUMMY_MODEL_INPUT_NAME);
+    input.set_datatype("FP32");
+    input.add_shape(1);
+    input.add_shape(DUMMY_MODEL_INPUT_SIZE);
+    setSharedMemoryParameters(*input.mutable_parameters(), "input", DUMMY_MODEL_INPUT_SIZE * sizeof(float), 16);
+    TensorInfo tensorInfo(DUMMY_MODEL_INPUT_NAME, Precision::FP32, Shape{1, DUMMY_MODEL_INPUT_SIZE}, Layout{"NC"});
+
+    ov::Tensor tensor;
+    ASSERT_EQ(makeTensorFromSharedMemory(input, tensorInfo, tensor), StatusCode::OK);
+    EXPECT_EQ(tensor.data(), static_cast<void*>(clientMemory + 128 + 16));
+    EXPECT_EQ(tensor.get_element_type(), ov::element::f32);
+    EXPECT_EQ(tensor.get_shape(), ov::Shape({1, DUMMY_MODEL_INPUT_SIZE}));
+
+    // tensor keeps region mapped when it is unregistered during inference
+    ASSERT_EQ(SharedMemoryRegistry::instance().unregisterRegion("input"), StatusCode::OK);
+    EXPECT_EQ(tensor.data<float>()[DUMMY_MODEL_INPUT_SIZE - 1], DUMMY_MODEL_INPUT_SIZE - 1);
+    ov::Tensor missingRegionTensor;
+    EXPECT_EQ(makeTensorFromSharedMemory(input, tensorInfo, missingRegionTensor), StatusCode::SHARED_MEMORY_REGION_NOT_FOUND);
+}
+
+TEST_F(KFSSharedMemoryTest, MakeTensorRequiresMatchingPrecisionAndSize) {
+    ASSERT_EQ(SharedMemoryRegistry::instance().registerRegion("input", key, 0, 1024), StatusCode::OK);
+    ::KFSRequest::InferInputTensor input;
+    input.set_name(DUMMY_MODEL_INPUT_NAME);
+    input.set_datatype("FP64");
+    input.add_shape(1);
+    input.add_shape(DUMMY_MODEL_INPUT_SIZE);
+    setSharedMemoryParameters(*input.mutable_parameters(), "input", DUMMY_MODEL_INPUT_SIZE * sizeof(double), 0);
+    TensorInfo tensorInfo(DUMMY_MODEL_INPUT_NAME, Precision::FP32, Shape{1, DUMMY_MODEL_INPUT_SIZE}, Layout{"NC"});
+    ov::Tensor tensor;
+    EXPECT_EQ(makeTensorFromSharedMemory(input, tensorInfo, tensor), StatusCode::INVALID_PRECISION);
+
+    input.set_datatype("FP32");
+    EXPECT_EQ(makeTensorFromSharedMemory(input, tensorInfo, tensor), StatusCode::INVALID_CONTENT_SIZE);
+    setSharedMemoryParameters(*input.mutable_parameters(), "input", DUMMY_MODEL_INPUT_SIZE * sizeof(float), 1000);
+    EXPECT_EQ(makeTensorFromSharedMemory(input, tensorInfo, tensor), StatusCode::SHARED_MEMORY_INVALID_RANGE);
+}
+
+TEST_F(KFSSharedMemoryTest, PrepareOutputsRequestedInSharedMemory) {
+    ASSERT_EQ(SharedMemoryRegistry::instance().registerRegion("output", key, 0, 1024), StatusCode::OK);
+    ::KFSRequest request;
+    request.add_outputs()->set_name("regular");
+    auto* requestedOutput = request.add_outputs();
+    requestedOutput->set_name(DUMMY_MODEL_OUTPUT_NAME);
+    setSharedMemoryParameters(*requestedOutput->mutable_parameters(), "output", 40, 8);
+    (*requestedOutput->mutable_parameters())["binary_data"].set_bool_param(true);
+
+    ::KFSResponse response;
+    ASSERT_EQ(prepareSharedMemoryOutputs(request, response), StatusCode::OK);
+    ASSERT_EQ(response.outputs_size(), 1);
+    const auto& output = response.outputs(0);
+    EXPECT_EQ(output.name(), DUMMY_MODEL_OUTPUT_NAME);
+    EXPECT_EQ(output.parameters().size(), 3);
+    EXPECT_EQ(output.parameters().at(SHARED_MEMORY_REGION_PARAMETER).string_param(), "output");
+    EXPECT_EQ(output.parameters().at(SHARED_MEMORY_BYTE_SIZE_PARAMETER).int64_param(), 40);
+    EXPECT_EQ(output.parameters().at(SHARED_MEMORY_OFFSET_PARAMETER).int64_param(), 8);
+
+    setSharedMemoryParameters(*requestedOutput->mutable_parameters(), "missing", 40, 8);
+    ::KFSResponse missingRegionResponse;
+    EXPECT_EQ(prepareSharedMemoryOutputs(request, missingRegionResponse), StatusCode::SHARED_MEMORY_REGION_NOT_FOUND);
+}
+
+TEST_F(KFSSharedMemoryTest, SerializeOutputToRegion) {
+    ASSERT_EQ(SharedMemoryRegistry::instance().registerRegion("output", key, 256, 1024), StatusCode::OK);
+    auto outputInfo = std::make_shared<TensorInfo>(DUMMY_MODEL_OUTPUT_NAME, Precision::FP32, Shape{1, DUMMY_MODEL_INPUT_SIZE}, Layout{"NC"});
+    std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, 2.5);
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1, DUMMY_MODEL_INPUT_SIZE}, data.data());
+
+    ::KFSResponse response;
+    auto* output = response.add_outputs();
+    output->set_name(DUMMY_MODEL_OUTPUT_NAME);
+    setSharedMemoryParameters(*output->mutable_parameters(), "output", DUMMY_MODEL_INPUT_SIZE * sizeof(float), 4);
+    ASSERT_EQ(serializeTensorToSharedMemory(*output, outputInfo, tensor), StatusCode::OK);
+    EXPECT_EQ(output->datatype(), "FP32");
+    EXPECT_THAT(output->shape(), ElementsAre(1, DUMMY_MODEL_INPUT_SIZE));
+    EXPECT_EQ(std::vector<float>(clientFloats(256 + 4), clientFloats(256 + 4) + DUMMY_MODEL_INPUT_SIZE), data);
+
+    setSharedMemoryParameters(*output->mutable_parameters(), "output", DUMMY_MODEL_INPUT_SIZE * sizeof(float) - 1, 4);
+    EXPECT_EQ(serializeTensorToSharedMemory(*output, outputInfo, tensor), StatusCode::INVALID_CONTENT_SIZE);
+}
+
+TEST_F(KFSSharedMemoryTest, InferenceWritesOutputDirectlyToRegion) {
+    ov::Core ieCore;
+    std::shared_ptr<ov::Model> model = ieCore.read_model(std::filesystem::current_path().u8string() + "/src/test/dummy/1/dummy.xml");
+    ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
+    ov::InferRequest inferRequest = compiledModel.create_infer_request();
+    tensor_map_t outputsInfo;
+    outputsInfo[DUMMY_MODEL_OUTPUT_NAME] = std::make_shared<TensorInfo>(DUMMY_MODEL_OUTPUT_NAME, Precision::FP32, Shape{1, DUMMY_MODEL_INPUT_SIZE}, Layout{"NC"});
+    ASSERT_EQ(SharedMemoryRegistry::instance().registerRegion("output", key, 0, 1024), StatusCode::OK);
+
+    ::KFSRequest request;
+    auto* requestedOutput = request.add_outputs();
+    requestedOutput->set_name(DUMMY_MODEL_OUTPUT_NAME);
+    setSharedMemoryParameters(*requestedOutput->mutable_parameters(), "output", DUMMY_MODEL_INPUT_SIZE * sizeof(float), 64);
+    ::KFSResponse response;
+    ASSERT_EQ(prepareSharedMemoryOutputs(request, response), StatusCode::OK);
+    void* originalData = inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data();
+    {
+        OutputBinding outputBinding(inferRequest);
+        outputBinding.bindOutputs(outputsInfo, &response, true);
+        ASSERT_EQ(outputBinding.getBoundOutputsCount(), 1);
+        EXPECT_EQ(inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data(), static_cast<void*>(clientMemory + 64));
+        std::vector<float> input(DUMMY_MODEL_INPUT_SIZE, 3);
+        std::memcpy(inferRequest.get_tensor(DUMMY_MODEL_INPUT_NAME).data(), input.data(), input.size() * sizeof(float));
+        inferRequest.infer();
+        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        ASSERT_EQ(serializePredictResponse(outputGetter, "dummy", 1, outputsInfo, &response, getTensorInfoName), StatusCode::OK);
+    }
+    EXPECT_EQ(inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data(), originalData);
+    ASSERT_EQ(response.outputs_size(), 1);
+    EXPECT_EQ(response.outputs(0).datatype(), "FP32");
+    ASSERT_EQ(response.raw_output_contents_size(), 1);
+    EXPECT_TRUE(response.raw_output_contents(0).empty());
+    EXPECT_EQ(std::vector<float>(clientFloats(64), clientFloats(64) + DUMMY_MODEL_INPUT_SIZE), std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 4));
+}
@@ -121,6 +121,21 @@ TEST_F(MetricsConfigNegativeTest, MissingPort) {
     ASSERT_EQ(status, StatusCode::METRICS_REST_PORT_MISSING);
 }
 
+TEST_F(MetricsConfigNegativeTest, RestUdsPathWithoutPort) {
+    char* n_argv[] = {(char*)"ovms", (char*)"--model_path", (char*)"/path/to/model", (char*)"--model_name", (char*)"some_name", (char*)"--rest_uds_path", (char*)"/tmp/ovms_rest.sock"};
+    int arg_count = 7;
+    ovms::Config::instance().parse(arg_count, n_argv);
+    SetUpConfig(createModelMetricsChangedConfig());
+    std::filesystem::copy("/ovms/src/test/dummy", modelPath, std::filesystem::copy_options::recursive);
+    createConfigFileWithContent(ovmsConfig, configFilePath);
+
+    ConstructorEnabledModelManager manager;
+
+    auto status = manager.loadConfig(configFilePath);
+    ASSERT_TRUE(status.ok()) << status.string();
+    ASSERT_EQ(manager.getMetricConfig().metricsEnabled, true);
+}
+
 static const char* modelDefaultConfig = R"(
 {
     "model_config_list": [
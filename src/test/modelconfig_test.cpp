@@ -542,6 +542,28 @@ TEST(ModelConfig, plugin_config_legacy_gpu_num) {
     EXPECT_EQ(actualPluginConfig["NUM_STREAMS"], "5");
 }
 
+TEST(ModelConfig, parseAcceptPrecisions) {
+    ovms::ModelConfig config;
+    rapidjson::Document node;
+    node.Parse(R"({"input": "FP32", "other_input": ["FP32", "FP16"]})");
+    auto status = config.parseAcceptPrecisions(node);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    const auto& acceptPrecisions = config.getAcceptPrecisions();
+    ASSERT_EQ(acceptPrecisions.size(), 2);
+    EXPECT_THAT(acceptPrecisions.at("input"), UnorderedElementsAre(ovms::Precision::FP32));
+    EXPECT_THAT(acceptPrecisions.at("other_input"), UnorderedElementsAre(ovms::Precision::FP32, ovms::Precision::FP16));
+
+    std::vector<std::string> invalidConfigs{
+        R"(["FP32"])",
+        R"({"input": "NOT_A_PRECISION"})",
+        R"({"input": ["FP32", 16]})",
+        R"({"input": 32})"};
+    for (const auto& invalidConfig : invalidConfigs) {
+        node.Parse(invalidConfig.c_str());
+        EXPECT_EQ(config.parseAcceptPrecisions(node), ovms::StatusCode::INVALID_ACCEPT_PRECISIONS) << invalidConfig;
+    }
+}
+
 TEST(ModelConfig, mappingInputs) {
     ovms::ModelConfig config;
     ovms::mapping_config_t mapping{
@@ -1124,6 +1146,140 @@ static std::string config_low_invalid_max_seq = R"#(
 }
 )#";
 
+static std::string config_dynamic_batching_should_pass = R"#(
+    {
+    "model_config_list": [
+        {
+            "config": {
+                "name": "config_dynamic_batching_should_pass",
+                "base_path": "/tmp/models/dummy1",
+                "max_batch_size": 16,
+                "max_queue_delay_us": 1000
+            }
+        }
+    ]
+}
+)#";
+
+static std::string config_dynamic_batching_delay_without_max_batch_size = R"#(
+    {
+    "model_config_list": [
+        {
+            "config": {
+                "name": "config_dynamic_batching_delay_without_max_batch_size",
+                "base_path": "/tmp/models/dummy1",
+                "max_queue_delay_us": 1000
+            }
+        }
+    ]
+}
+)#";
+
+static std::string config_dynamic_batching_stateful = R"#(
+    {
+    "model_config_list": [
+        {
+            "config": {
+                "name": "config_dynamic_batching_stateful",
+                "base_path": "/tmp/models/dummy1",
+                "stateful": true,
+                "max_batch_size": 16
+            }
+        }
+    ]
+}
+)#";
+
+static std::string config_dynamic_batching_batch_size_auto = R"#(
+    {
+    "model_config_list": [
+        {
+            "config": {
+                "name": "config_dynamic_batching_batch_size_auto",
+                "base_path": "/tmp/models/dummy1",
+                "batch_size": "auto",
+                "max_batch_size": 16
+            }
+        }
+    ]
+}
+)#";
+
+static std::string config_dynamic_batching_shape_auto = R"#(
+    {
+    "model_config_list": [
+        {
+            "config": {
+                "name": "config_dynamic_batching_shape_auto",
+                "base_path": "/tmp/models/dummy1",
+                "shape": "auto",
+                "max_batch_size": 16
+            }
+        }
+    ]
+}
+)#";
+
+class ModelConfigParseDynamicBatching : public ::testing::TestWithParam<std::pair<std::string, ovms::StatusCode>> {
+};
+
+TEST_P(ModelConfigParseDynamicBatching, Parse) {
+    std::pair<std::string, ovms::StatusCode> testPair = GetParam();
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(testPair.first.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    const auto& configs = configJson.FindMember("model_config_list")->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+    ASSERT_EQ(status, testPair.second) << status.string();
+    if (testPair.second == ovms::StatusCode::OK) {
+        EXPECT_TRUE(modelConfig.isDynamicBatchingEnabled());
+        EXPECT_EQ(modelConfig.getMaxBatchSize(), 16);
+        EXPECT_EQ(modelConfig.getMaxQueueDelayUs(), 1000);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Test,
+    ModelConfigParseDynamicBatching,
+    ::testing::Values(
+        std::make_pair(config_dynamic_batching_should_pass, ovms::StatusCode::OK),
+        std::make_pair(config_dynamic_batching_delay_without_max_batch_size, ovms::StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER),
+        std::make_pair(config_dynamic_batching_stateful, ovms::StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER),
+        std::make_pair(config_dynamic_batching_batch_size_auto, ovms::StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER),
+        std::make_pair(config_dynamic_batching_shape_auto, ovms::StatusCode::INVALID_DYNAMIC_BATCHING_PARAMETER)));
+
+TEST(ModelConfig, DynamicBatchingParamsChangeRequiresReload) {
+    ovms::ModelConfig config;
+    ovms::ModelConfig changed;
+    changed.setMaxBatchSize(8);
+    EXPECT_TRUE(config.isReloadRequired(changed));
+    config.setMaxBatchSize(8);
+    EXPECT_FALSE(config.isReloadRequired(changed));
+    changed.setMaxQueueDelayUs(10);
+    EXPECT_TRUE(config.isReloadRequired(changed));
+}
+
+TEST(ModelConfig, ShapeCacheSize) {
+    std::string json = R"#(
+    {
+        "name": "model",
+        "base_path": "/tmp/models/dummy1",
+        "batch_size": "auto",
+        "shape_cache_size": 4
+    }
+    )#";
+    rapidjson::Document configJson;
+    ASSERT_FALSE(configJson.Parse(json.c_str()).HasParseError());
+    ovms::ModelConfig config;
+    ASSERT_EQ(config.parseNode(configJson), ovms::StatusCode::OK);
+    EXPECT_EQ(config.getShapeCacheSize(), 4);
+    ovms::ModelConfig changed = config;
+    changed.setShapeCacheSize(2);
+    EXPECT_TRUE(config.isReloadRequired(changed));
+}
+
 class ModelConfigParseModel : public ::testing::TestWithParam<std::pair<std::string, ovms::StatusCode>> {
 };
 
@@ -13,9 +13,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -1143,3 +1149,198 @@ TEST(TensorMap, TestProcessingHintFromShape_Demultiplexer) {
     EXPECT_EQ(servableInputs["Input_U8_1_1_3_NCHW"]->getPreProcessingHint(), ovms::TensorInfo::ProcessingHint::NO_PROCESSING);  // due to demultiplexer
     EXPECT_EQ(servableInputs["Input_U8_1_3_N"]->getPreProcessingHint(), ovms::TensorInfo::ProcessingHint::NO_PROCESSING);       // due to demultiplexer
 }
+
+class TestInferAsync : public ::testing::Test {
+protected:
+    ConstructorEnabledModelManager manager;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+
+    void SetUp() override {
+        config.setNireq(1);
+        ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+        ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard), ovms::StatusCode::OK);
+    }
+
+    void prepareRequest(tensorflow::serving::PredictRequest& request, float value) {
+        std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, value);
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+    }
+
+    void checkResponse(const tensorflow::serving::PredictResponse& response, float value) {
+        ASSERT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+        const auto& output = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.tensor_content().size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> actual(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(actual.data(), output.tensor_content().data(), output.tensor_content().size());
+        EXPECT_EQ(actual, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, value + 1));
+    }
+};
+
+TEST_F(TestInferAsync, CompletionCallbackReceivesSerializedResponse) {
+    tensorflow::serving::PredictRequest request;
+    tensorflow::serving::PredictResponse response;
+    prepareRequest(request, 3);
+    std::promise<ovms::Status> completed;
+    bool unloadBlockedDuringCallback = false;
+    auto status = modelInstance->inferAsync(&request, &response, unloadGuard, [this, &completed, &unloadBlockedDuringCallback](ovms::Status status) {
+        unloadBlockedDuringCallback = !modelInstance->canUnloadInstance();
+        completed.set_value(status);
+    });
+    ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    EXPECT_EQ(unloadGuard, nullptr) << "unload guard should be owned by pending inference";
+    auto future = completed.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(future.get(), ovms::StatusCode::OK);
+    checkResponse(response, 3);
+    EXPECT_TRUE(unloadBlockedDuringCallback) << "unload guard should be held until completion callback returns";
+    // guard is released as the last action of completion callback
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!modelInstance->canUnloadInstance() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(modelInstance->canUnloadInstance());
+}
+
+TEST_F(TestInferAsync, InvalidRequestDoesNotInvokeCallback) {
+    tensorflow::serving::PredictRequest request;
+    tensorflow::serving::PredictResponse response;
+    preparePredictRequest(request,
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, DUMMY_MODEL_INPUT_SIZE + 1}, ovms::Precision::FP32}}});
+    bool called = false;
+    auto status = modelInstance->inferAsync(&request, &response, unloadGuard, [&called](ovms::Status status) {
+        called = true;
+    });
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_SHAPE);
+    EXPECT_FALSE(called);
+    EXPECT_NE(unloadGuard, nullptr) << "unload guard should stay with the caller";
+}
+
+TEST_F(TestInferAsync, WaitsInLineWithoutBlockingWhenNoInferRequestIdle) {
+    tensorflow::serving::PredictRequest request;
+    tensorflow::serving::PredictResponse response;
+    prepareRequest(request, 5);
+    auto& inferRequestsQueue = modelInstance->getInferRequestsQueue();
+    int heldStreamId = inferRequestsQueue.getIdleStream();
+    std::promise<ovms::Status> completed;
+    auto status = modelInstance->inferAsync(&request, &response, unloadGuard, [&completed](ovms::Status status) {
+        completed.set_value(status);
+    });
+    ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    EXPECT_EQ(unloadGuard, nullptr) << "unload guard should be owned by waiting inference";
+    auto future = completed.get_future();
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    // returning the stream starts inference of the waiting request
+    inferRequestsQueue.returnStream(heldStreamId);
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(future.get(), ovms::StatusCode::OK);
+    checkResponse(response, 5);
+}
+
+TEST_F(TestInferAsync, MoreRequestsThanStreamsComplete) {
+    const size_t requestsCount = 20;
+    std::vector<tensorflow::serving::PredictRequest> requests(requestsCount);
+    std::vector<tensorflow::serving::PredictResponse> responses(requestsCount);
+    std::vector<std::promise<ovms::Status>> completed(requestsCount);
+    unloadGuard.reset();
+    for (size_t i = 0; i < requestsCount; ++i) {
+        prepareRequest(requests[i], static_cast<float>(i));
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> requestUnloadGuard;
+        ASSERT_EQ(manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, requestUnloadGuard), ovms::StatusCode::OK);
+        auto status = modelInstance->inferAsync(&requests[i], &responses[i], requestUnloadGuard, [&completed, i](ovms::Status status) {
+            completed[i].set_value(status);
+        });
+        ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    }
+    for (size_t i = 0; i < requestsCount; ++i) {
+        auto future = completed[i].get_future();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        EXPECT_EQ(future.get(), ovms::StatusCode::OK);
+        checkResponse(responses[i], static_cast<float>(i));
+    }
+}
+
+class TestBoundedDynamicShape : public ::testing::Test {
+protected:
+    ConstructorEnabledModelManager manager;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+
+    ovms::Status performDummyPrediction(int64_t batchSize, const ovms::OVInferRequestsQueue*& usedQueue) {
+        std::shared_ptr<ovms::ModelInstance> modelInstance;
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+        auto status = manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, unloadGuard);
+        if (!status.ok()) {
+            return status;
+        }
+        std::vector<float> data(batchSize * DUMMY_MODEL_INPUT_SIZE, 1);
+        tensorflow::serving::PredictRequest request;
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{batchSize, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+        tensorflow::serving::PredictResponse response;
+        status = modelInstance->infer(&request, &response, unloadGuard);
+        usedQueue = &modelInstance->getInferRequestsQueue();
+        return status;
+    }
+
+    void checkRequestsInRangeDoNotReload() {
+        ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+        auto modelInstance = manager.findModelInstance(config.getName(), config.getVersion());
+        ASSERT_NE(modelInstance, nullptr);
+        EXPECT_EQ(modelInstance->getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape()[0], ovms::Dimension(1, 8));
+        const ovms::OVInferRequestsQueue* initialQueue = &modelInstance->getInferRequestsQueue();
+        for (int64_t batchSize : {1, 8, 3, 5}) {
+            const ovms::OVInferRequestsQueue* usedQueue = nullptr;
+            ASSERT_EQ(performDummyPrediction(batchSize, usedQueue), ovms::StatusCode::OK);
+            // model compiled with bounded dimension is not reloaded
+            EXPECT_EQ(usedQueue, initialQueue);
+        }
+        const ovms::OVInferRequestsQueue* usedQueue = nullptr;
+        EXPECT_NE(performDummyPrediction(9, usedQueue), ovms::StatusCode::OK);
+        EXPECT_EQ(usedQueue, initialQueue);
+    }
+};
+
+TEST_F(TestBoundedDynamicShape, ShapeWithRangeAcceptsRequestsWithoutReload) {
+    ASSERT_EQ(config.parseShapeParameter("(1:8,10)"), ovms::StatusCode::OK);
+    checkRequestsInRangeDoNotReload();
+}
+
+TEST_F(TestBoundedDynamicShape, BatchSizeRangeAcceptsRequestsWithoutReload) {
+    config.setBatchingParams("1:8");
+    checkRequestsInRangeDoNotReload();
+}
+
+class TestAcceptPrecisions : public ::testing::Test {
+protected:
+    std::unique_ptr<ov::Core> ieCore;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    void SetUp() {
+        ieCore = std::make_unique<ov::Core>();
+    }
+};
+
+TEST_F(TestAcceptPrecisions, SameAsModelPrecisionIsIgnored) {
+    config.setAcceptPrecisions({{DUMMY_MODEL_INPUT_NAME, {ovms::Precision::FP32}}});
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    EXPECT_TRUE(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getAcceptedPrecisions().empty());
+}
+
+TEST_F(TestAcceptPrecisions, UnsupportedConversionFailsLoad) {
+    config.setAcceptPrecisions({{DUMMY_MODEL_INPUT_NAME, {ovms::Precision::FP16}}});
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::INVALID_ACCEPT_PRECISIONS);
+}
+
+TEST_F(TestAcceptPrecisions, UnknownInputFailsLoad) {
+    config.setAcceptPrecisions({{"NOT_EXISTING_INPUT", {ovms::Precision::FP32}}});
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::INVALID_ACCEPT_PRECISIONS);
+}
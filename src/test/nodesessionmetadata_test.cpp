@@ -16,6 +16,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../dags/nodesession.hpp"
 #include "../dags/nodesessionmetadata.hpp"
 #include "../logging.hpp"
 #include "test_utils.hpp"
@@ -32,15 +33,29 @@ class NodeSessionMetadataTest : public ::testing::Test {};
 
 TEST_F(NodeSessionMetadataTest, GenerateSessionKeyWhenNoSubsessions) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
-    EXPECT_EQ(meta.getSessionKey(), "");
+    EXPECT_EQ(meta.getSessionKey(), 0);
+    EXPECT_EQ(meta.toString(), "");
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateSubsession) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
     auto demultiplexedMetas = meta.generateSubsessions("request", 2);
     ASSERT_EQ(demultiplexedMetas.size(), 2);
-    EXPECT_EQ(demultiplexedMetas[0].getSessionKey(), "request_0");
-    EXPECT_EQ(demultiplexedMetas[1].getSessionKey(), "request_1");
+    EXPECT_EQ(demultiplexedMetas[0].getSessionKey(), 0);
+    EXPECT_EQ(demultiplexedMetas[1].getSessionKey(), 1);
+    EXPECT_EQ(demultiplexedMetas[0].toString(), "request_0");
+    EXPECT_EQ(demultiplexedMetas[1].toString(), "request_1");
+}
+
+TEST_F(NodeSessionMetadataTest, NodeSessionIsNamedAfterItsMetadata) {
+    NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
+    auto firstLevelMetas = meta.generateSubsessions("request", 2);
+    auto secondLevelMetas = firstLevelMetas[1].generateSubsessions("extract", 3);
+    const std::string nodeName = "node";
+    NodeSession session(secondLevelMetas[2], nodeName, 1, {});
+    // keys are indexes shared by sessions of different nodes, name tells which subsession it is
+    EXPECT_EQ(session.getSessionKey(), 5);
+    EXPECT_EQ(session.getSessionName(), "extract_2_request_1");
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateTwoLevelsOfSubsession) {
@@ -55,13 +70,17 @@ TEST_F(NodeSessionMetadataTest, GenerateTwoLevelsOfSubsession) {
         std::move(newLevelMetas.begin(), newLevelMetas.end(), secondLevelMetas.begin() + demMetaId * secondLevelDemultiplexSize);
     }
     for (size_t demMetaId = 0; demMetaId != demultiplexedMetas.size(); ++demMetaId) {
-        EXPECT_EQ(demultiplexedMetas[demMetaId].getSessionKey(), std::string("request_") + std::to_string(demMetaId));
+        EXPECT_EQ(demultiplexedMetas[demMetaId].getSessionKey(), demMetaId);
+        EXPECT_EQ(demultiplexedMetas[demMetaId].toString(), std::string("request_") + std::to_string(demMetaId));
     }
     for (size_t demMetaId = 0; demMetaId != firstLevelDemultiplexSize; ++demMetaId) {
         for (size_t demMetaLev2Id = 0; demMetaLev2Id != secondLevelDemultiplexSize; ++demMetaLev2Id) {
-            auto hash = secondLevelMetas[demMetaLev2Id + demMetaId * secondLevelDemultiplexSize].getSessionKey();
-            EXPECT_THAT(hash, HasSubstr(std::string("request_") + std::to_string(demMetaId)));
-            EXPECT_THAT(hash, HasSubstr(std::string("2ndDemultiplexer_") + std::to_string(demMetaLev2Id)));
+            const auto& secondLevelMeta = secondLevelMetas[demMetaLev2Id + demMetaId * secondLevelDemultiplexSize];
+            // session keys of the same level are dense
+            EXPECT_EQ(secondLevelMeta.getSessionKey(), demMetaLev2Id + demMetaId * secondLevelDemultiplexSize);
+            auto name = secondLevelMeta.toString();
+            EXPECT_THAT(name, HasSubstr(std::string("request_") + std::to_string(demMetaId)));
+            EXPECT_THAT(name, HasSubstr(std::string("2ndDemultiplexer_") + std::to_string(demMetaLev2Id)));
         }
     }
 }
@@ -75,10 +94,11 @@ TEST_F(NodeSessionMetadataTest, GenerateThreeLevelsOfSubsession) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
-    EXPECT_THAT(hash, HasSubstr("request_2"));
-    EXPECT_THAT(hash, HasSubstr("extract1st_0"));
-    EXPECT_THAT(hash, HasSubstr("extract2nd_2"));
+    EXPECT_EQ(demultiplexedMetaLev3.getSessionKey(), (2 * secondLevelDemultiplexSize + 0) * thirdLevelDemultiplexSize + 2);
+    auto name = demultiplexedMetaLev3.toString();
+    EXPECT_THAT(name, HasSubstr("request_2"));
+    EXPECT_THAT(name, HasSubstr("extract1st_0"));
+    EXPECT_THAT(name, HasSubstr("extract2nd_2"));
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateSubsessionWithEmptyNameShouldThrow) {
@@ -108,20 +128,22 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsession1Level) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
-    ASSERT_THAT(hash, HasSubstr("request_2"));
-    ASSERT_THAT(hash, HasSubstr("extract1st_0"));
-    ASSERT_THAT(hash, HasSubstr("extract2nd_2"));
+    auto name = demultiplexedMetaLev3.toString();
+    ASSERT_THAT(name, HasSubstr("request_2"));
+    ASSERT_THAT(name, HasSubstr("extract1st_0"));
+    ASSERT_THAT(name, HasSubstr("extract2nd_2"));
     NodeSessionMetadata metaCollapsedOnExtract1st{DEFAULT_TEST_CONTEXT};
     CollapseDetails collapsingDetails;
     std::tie(metaCollapsedOnExtract1st, collapsingDetails) = demultiplexedMetaLev3.getCollapsedSessionMetadata({"extract2nd"});
-    auto hashCollapsed = metaCollapsedOnExtract1st.getSessionKey();
+    auto keyCollapsed = metaCollapsedOnExtract1st.getSessionKey();
     // need to ensure that generated collapsed session key before collapsing and after are the same
-    EXPECT_EQ(hashCollapsed, demultiplexedMetaLev3.getSessionKey({std::string("extract2nd")}));
+    EXPECT_EQ(keyCollapsed, demultiplexedMetaLev3.getSessionKey({std::string("extract2nd")}));
+    EXPECT_EQ(keyCollapsed, 2 * secondLevelDemultiplexSize + 0);
 
-    ASSERT_THAT(hashCollapsed, HasSubstr("request_2"));
-    ASSERT_THAT(hashCollapsed, HasSubstr("extract1st_0"));
-    ASSERT_THAT(hashCollapsed, Not(HasSubstr("extract2nd_2")));
+    auto nameCollapsed = metaCollapsedOnExtract1st.toString();
+    ASSERT_THAT(nameCollapsed, HasSubstr("request_2"));
+    ASSERT_THAT(nameCollapsed, HasSubstr("extract1st_0"));
+    ASSERT_THAT(nameCollapsed, Not(HasSubstr("extract2nd_2")));
     ASSERT_EQ(collapsingDetails.collapsedSessionNames.size(), 1);
     ASSERT_EQ(collapsingDetails.collapsedSessionSizes.size(), 1);
     ASSERT_EQ(collapsingDetails.collapsedSessionNames[0], "extract2nd");
@@ -137,10 +159,10 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsession1LevelNotInLIFOOrderShouldThro
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
-    ASSERT_THAT(hash, HasSubstr("request_2"));
-    ASSERT_THAT(hash, HasSubstr("extract1st_0"));
-    ASSERT_THAT(hash, HasSubstr("extract2nd_2"));
+    auto name = demultiplexedMetaLev3.toString();
+    ASSERT_THAT(name, HasSubstr("request_2"));
+    ASSERT_THAT(name, HasSubstr("extract1st_0"));
+    ASSERT_THAT(name, HasSubstr("extract2nd_2"));
     NodeSessionMetadata metaCollapsedOnExtract1st{DEFAULT_TEST_CONTEXT};
     CollapseDetails collapsingDetails;
     EXPECT_THROW(demultiplexedMetaLev3.getCollapsedSessionMetadata({"extract1st"}), std::logic_error);
@@ -155,18 +177,20 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsessions2LevelsAtOnce) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[12]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[32]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[512];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
-    ASSERT_THAT(hash, HasSubstr("request_12"));
-    ASSERT_THAT(hash, HasSubstr("extract1st_32"));
-    ASSERT_THAT(hash, HasSubstr("extract2nd_512"));
+    EXPECT_EQ(demultiplexedMetaLev3.getSessionKey(), (12 * secondLevelDemultiplexSize + 32) * thirdLevelDemultiplexSize + 512);
+    auto name = demultiplexedMetaLev3.toString();
+    ASSERT_THAT(name, HasSubstr("request_12"));
+    ASSERT_THAT(name, HasSubstr("extract1st_32"));
+    ASSERT_THAT(name, HasSubstr("extract2nd_512"));
 
     NodeSessionMetadata metaCollapsed{DEFAULT_TEST_CONTEXT};
     CollapseDetails collapsingDetails;
     std::tie(metaCollapsed, collapsingDetails) = demultiplexedMetaLev3.getCollapsedSessionMetadata({"extract1st", "extract2nd"});
-    auto hashCollapsed = metaCollapsed.getSessionKey();
-    ASSERT_THAT(hashCollapsed, HasSubstr("request_12"));
-    ASSERT_THAT(hashCollapsed, Not(HasSubstr("extract1st")));
-    ASSERT_THAT(hashCollapsed, Not(HasSubstr("extract2nd")));
+    EXPECT_EQ(metaCollapsed.getSessionKey(), 12);
+    auto nameCollapsed = metaCollapsed.toString();
+    ASSERT_THAT(nameCollapsed, HasSubstr("request_12"));
+    ASSERT_THAT(nameCollapsed, Not(HasSubstr("extract1st")));
+    ASSERT_THAT(nameCollapsed, Not(HasSubstr("extract2nd")));
     ASSERT_EQ(collapsingDetails.collapsedSessionNames.size(), 2);
     ASSERT_EQ(collapsingDetails.collapsedSessionSizes.size(), 2);
     EXPECT_THAT(collapsingDetails.collapsedSessionNames,
@@ -190,22 +214,19 @@ TEST_F(NodeSessionMetadataTest, CollapsingManySubsessionsButOneNonExistingShould
 
 TEST_F(NodeSessionMetadataTest, GenerateCollapsedSubsessionKey) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
-    auto subsessionMeta = meta.generateSubsessions("request", 2)[0]
-                              .generateSubsessions("anotherSession", 5)[1];
-    auto hash = subsessionMeta.getSessionKey({"anotherSession"});
-    ASSERT_THAT(hash, HasSubstr("request_0"));
-    ASSERT_THAT(hash, Not(HasSubstr("anotherSession")));
+    auto requestMeta = meta.generateSubsessions("request", 2)[1];
+    auto subsessionMeta = requestMeta.generateSubsessions("anotherSession", 5)[3];
+    EXPECT_EQ(subsessionMeta.getSessionKey(), 1 * 5 + 3);
+    EXPECT_EQ(subsessionMeta.getSessionKey({"anotherSession"}), requestMeta.getSessionKey());
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateCollapsedSeveralSubsessionsAtOnceKey) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
-    auto subsessionMeta = meta.generateSubsessions("request", 2)[0]
-                              .generateSubsessions("anotherSession", 5)[1]
+    auto requestMeta = meta.generateSubsessions("request", 2)[1];
+    auto subsessionMeta = requestMeta.generateSubsessions("anotherSession", 5)[1]
                               .generateSubsessions("yetAnotherSession", 3)[2];
-    auto hash = subsessionMeta.getSessionKey({"anotherSession", "yetAnotherSession"});
-    ASSERT_THAT(hash, HasSubstr("request"));
-    ASSERT_THAT(hash, Not(HasSubstr("anotherSession")));
-    ASSERT_THAT(hash, Not(HasSubstr("yetAnotherSession")));
+    EXPECT_EQ(subsessionMeta.getSessionKey({"anotherSession", "yetAnotherSession"}), requestMeta.getSessionKey());
+    EXPECT_EQ(subsessionMeta.getSessionKey({"yetAnotherSession"}), 1 * 5 + 1);
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateCollapsedSubsessionKeyShouldThrowWhenNonExistingSubsession) {
@@ -14,11 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -36,14 +44,14 @@ TEST(OVInferRequestQueue, ShortQueue) {
     ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
     ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, 3);
     int reqid;
-    reqid = inferRequestsQueue.getIdleStream().get();
+    reqid = inferRequestsQueue.getIdleStream();
     EXPECT_EQ(reqid, 0);
-    reqid = inferRequestsQueue.getIdleStream().get();
+    reqid = inferRequestsQueue.getIdleStream();
     EXPECT_EQ(reqid, 1);
-    reqid = inferRequestsQueue.getIdleStream().get();
+    reqid = inferRequestsQueue.getIdleStream();
     EXPECT_EQ(reqid, 2);
     inferRequestsQueue.returnStream(0);
-    reqid = inferRequestsQueue.getIdleStream().get();
+    reqid = inferRequestsQueue.getIdleStream();
     EXPECT_EQ(reqid, 0);
 }
 
@@ -65,12 +73,12 @@ TEST(OVInferRequestQueue, FullQueue) {
     ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, 50);
     int reqid;
     for (int i = 0; i < 50; i++) {
-        reqid = inferRequestsQueue.getIdleStream().get();
+        reqid = inferRequestsQueue.getIdleStream();
     }
     timer.start(QUEUE);
     std::thread th(&releaseStream, std::ref(inferRequestsQueue));
     th.detach();
-    reqid = inferRequestsQueue.getIdleStream().get();  // it should wait 1s for released request
+    reqid = inferRequestsQueue.getIdleStream();  // it should wait 1s for released request
     timer.stop(QUEUE);
 
     EXPECT_GT(timer.elapsed<std::chrono::microseconds>(QUEUE), 1'000'000);
@@ -79,7 +87,7 @@ TEST(OVInferRequestQueue, FullQueue) {
 
 static void inferenceSimulate(ovms::OVInferRequestsQueue& ms, std::vector<int>& tv) {
     for (int i = 1; i <= 10; i++) {
-        int st = ms.getIdleStream().get();
+        int st = ms.getIdleStream();
         int rd = std::rand();
         tv[st] = rd;
         std::mt19937_64 eng{std::random_device{}()};
@@ -112,22 +120,247 @@ TEST(OVInferRequestQueue, MultiThread) {
     // wait for all thread to complete successfully
 }
 
-TEST(OVInferRequestQueue, AsyncGetInferRequest) {
+TEST(OVInferRequestQueue, TryToGetIdleStreamWithTimeout) {
     ov::Core ieCore;
     auto model = ieCore.read_model(DUMMY_MODEL_PATH);
     ov::CompiledModel compiledModel = ieCore.compile_model(model, "CPU");
     const int nireq = 1;
     ovms::OVInferRequestsQueue inferRequestsQueue(compiledModel, nireq);
 
-    std::future<int> firstStreamRequest = inferRequestsQueue.getIdleStream();
-    std::future<int> secondStreamRequest = inferRequestsQueue.getIdleStream();
+    std::optional<int> firstStreamId = inferRequestsQueue.tryToGetIdleStream(std::chrono::microseconds(1));
+    ASSERT_TRUE(firstStreamId.has_value());
+    EXPECT_FALSE(inferRequestsQueue.tryToGetIdleStream().has_value());
+    EXPECT_FALSE(inferRequestsQueue.tryToGetIdleStream(std::chrono::milliseconds(1)).has_value());
 
-    EXPECT_EQ(std::future_status::ready, firstStreamRequest.wait_for(std::chrono::microseconds(1)));
-    EXPECT_EQ(std::future_status::timeout, secondStreamRequest.wait_for(std::chrono::milliseconds(1)));
+    std::thread th([&inferRequestsQueue, &firstStreamId]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        inferRequestsQueue.returnStream(firstStreamId.value());
+    });
+    std::optional<int> secondStreamId = inferRequestsQueue.tryToGetIdleStream(std::chrono::seconds(10));
+    th.join();
+    ASSERT_TRUE(secondStreamId.has_value());
+    EXPECT_EQ(firstStreamId.value(), secondStreamId.value());
+}
+
+TEST(OVInferRequestQueue, EachStreamReturnedOnceUnderContention) {
+    const int nireq = 4;
+    ovms::Queue<int> queue(nireq);
+    std::vector<std::atomic<int>> owners(nireq);
+    std::vector<std::thread> clients;
+    std::atomic<bool> collision{false};
+    for (int i = 0; i < 16; ++i) {
+        clients.emplace_back([&queue, &owners, &collision]() {
+            for (int j = 0; j < 10000; ++j) {
+                int streamId = queue.getIdleStream();
+                if (owners[streamId].fetch_add(1) != 0) {
+                    collision = true;
+                }
+                owners[streamId].fetch_sub(1);
+                queue.returnStream(streamId);
+            }
+        });
+    }
+    for (auto& t : clients) {
+        t.join();
+    }
+    EXPECT_FALSE(collision);
+    std::vector<int> streams;
+    for (int i = 0; i < nireq; ++i) {
+        auto streamId = queue.tryToGetIdleStream();
+        ASSERT_TRUE(streamId.has_value());
+        streams.push_back(streamId.value());
+    }
+    EXPECT_FALSE(queue.tryToGetIdleStream().has_value());
+    std::sort(streams.begin(), streams.end());
+    EXPECT_THAT(streams, ElementsAre(0, 1, 2, 3));
+}
+
+namespace {
+class RecordingWaiter : public ovms::IdleStreamWaiter {
+public:
+    RecordingWaiter(std::function<void(int)> callback = nullptr) :
+        callback(std::move(callback)) {}
+    void onStreamAssigned(int streamId) override {
+        assignedStreamId = streamId;
+        if (callback) {
+            callback(streamId);
+        }
+    }
+    std::optional<int> assignedStreamId;
+
+private:
+    std::function<void(int)> callback;
+};
+}  // namespace
+
+TEST(OVInferRequestQueue, WaiterGetsReturnedStreamAssigned) {
+    ovms::Queue<int> queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    RecordingWaiter waiter;
+    EXPECT_FALSE(queue.tryToGetIdleStream(waiter).has_value());
+    EXPECT_FALSE(waiter.assignedStreamId.has_value());
+    queue.returnStream(streamId.value());
+    ASSERT_TRUE(waiter.assignedStreamId.has_value());
+    EXPECT_EQ(waiter.assignedStreamId.value(), streamId.value());
+    // stream was assigned to waiter instead of becoming idle
+    EXPECT_FALSE(queue.tryToGetIdleStream().has_value());
+}
+
+TEST(OVInferRequestQueue, WaiterNotQueuedWhenStreamIdle) {
+    ovms::Queue<int> queue(1);
+    RecordingWaiter waiter;
+    auto streamId = queue.tryToGetIdleStream(waiter);
+    ASSERT_TRUE(streamId.has_value());
+    queue.returnStream(streamId.value());
+    EXPECT_FALSE(waiter.assignedStreamId.has_value());
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+}
+
+TEST(OVInferRequestQueue, WaitersGetStreamsInRegistrationOrder) {
+    ovms::Queue<int> queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    std::vector<int> order;
+    RecordingWaiter first([&order](int id) { order.push_back(1); });
+    RecordingWaiter second([&order](int id) { order.push_back(2); });
+    ASSERT_FALSE(queue.tryToGetIdleStream(first).has_value());
+    ASSERT_FALSE(queue.tryToGetIdleStream(second).has_value());
+    queue.returnStream(streamId.value());
+    EXPECT_THAT(order, ElementsAre(1));
+    queue.returnStream(streamId.value());
+    EXPECT_THAT(order, ElementsAre(1, 2));
+    EXPECT_FALSE(queue.tryToGetIdleStream().has_value());
+}
 
-    const int firstStreamId = firstStreamRequest.get();
-    inferRequestsQueue.returnStream(firstStreamId);
-    EXPECT_EQ(std::future_status::ready, secondStreamRequest.wait_for(std::chrono::microseconds(1)));
-    const int secondStreamId = secondStreamRequest.get();
-    EXPECT_EQ(firstStreamId, secondStreamId);
+TEST(OVInferRequestQueue, RemovedWaiterIsNotCalled) {
+    ovms::Queue<int> queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    RecordingWaiter waiter;
+    ASSERT_FALSE(queue.tryToGetIdleStream(waiter).has_value());
+    queue.removeIdleStreamWaiter(waiter);
+    queue.returnStream(streamId.value());
+    EXPECT_FALSE(waiter.assignedStreamId.has_value());
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+}
+
+TEST(OVInferRequestQueue, RemovingWaiterFromMiddleKeepsOrderOfOthers) {
+    ovms::Queue<int> queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    std::vector<int> order;
+    RecordingWaiter first([&order](int id) { order.push_back(1); });
+    RecordingWaiter second([&order](int id) { order.push_back(2); });
+    RecordingWaiter third([&order](int id) { order.push_back(3); });
+    ASSERT_FALSE(queue.tryToGetIdleStream(first).has_value());
+    ASSERT_FALSE(queue.tryToGetIdleStream(second).has_value());
+    ASSERT_FALSE(queue.tryToGetIdleStream(third).has_value());
+    queue.removeIdleStreamWaiter(second);
+    // removing waiter twice or after assignment has no effect
+    queue.removeIdleStreamWaiter(second);
+    queue.returnStream(streamId.value());
+    queue.removeIdleStreamWaiter(first);
+    queue.returnStream(streamId.value());
+    EXPECT_THAT(order, ElementsAre(1, 3));
+    queue.returnStream(streamId.value());
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+}
+
+class QueueWithWaitingCountExposed : public ovms::Queue<int> {
+public:
+    using ovms::Queue<int>::Queue;
+    void waitForWaitingCount(uint32_t count) {
+        while (this->waitingCount.load() != count) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+TEST(OVInferRequestQueue, BlockedThreadGetsReturnedStreamBeforeNewCaller) {
+    QueueWithWaitingCountExposed queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    std::optional<int> blockedThreadStreamId;
+    std::thread blocked([&queue, &blockedThreadStreamId]() {
+        blockedThreadStreamId = queue.getIdleStream();
+    });
+    queue.waitForWaitingCount(1);
+    queue.returnStream(streamId.value());
+    // stream was handed over to blocked thread, new caller cannot take it
+    EXPECT_FALSE(queue.tryToGetIdleStream().has_value());
+    blocked.join();
+    ASSERT_TRUE(blockedThreadStreamId.has_value());
+    EXPECT_EQ(blockedThreadStreamId.value(), streamId.value());
+}
+
+TEST(OVInferRequestQueue, BlockedThreadsAndWaitersServedInArrivalOrder) {
+    QueueWithWaitingCountExposed queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    std::atomic<bool> blockedThreadServed{false};
+    std::thread blocked([&queue, &blockedThreadServed]() {
+        int id = queue.getIdleStream();
+        blockedThreadServed = true;
+        queue.returnStream(id);
+    });
+    queue.waitForWaitingCount(1);
+    RecordingWaiter waiter;
+    ASSERT_FALSE(queue.tryToGetIdleStream(waiter).has_value());
+    queue.returnStream(streamId.value());
+    blocked.join();
+    EXPECT_TRUE(blockedThreadServed);
+    // blocked thread returned the stream and it went to waiter registered later
+    ASSERT_TRUE(waiter.assignedStreamId.has_value());
+    EXPECT_EQ(waiter.assignedStreamId.value(), streamId.value());
+}
+
+TEST(OVInferRequestQueue, TimedOutWaiterDoesNotGetStream) {
+    QueueWithWaitingCountExposed queue(1);
+    auto streamId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(streamId.has_value());
+    EXPECT_FALSE(queue.tryToGetIdleStream(std::chrono::milliseconds(1)).has_value());
+    queue.waitForWaitingCount(0);
+    queue.returnStream(streamId.value());
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+}
+
+TEST(OVInferRequestQueue, EachStreamAssignedOnceToWaitersUnderContention) {
+    const int nireq = 2;
+    ovms::Queue<int> queue(nireq);
+    std::vector<std::atomic<int>> owners(nireq);
+    std::atomic<bool> collision{false};
+    std::vector<std::thread> clients;
+    for (int i = 0; i < 8; ++i) {
+        clients.emplace_back([&queue, &owners, &collision]() {
+            for (int j = 0; j < 2000; ++j) {
+                std::mutex mtx;
+                std::condition_variable cv;
+                std::optional<int> assignedStreamId;
+                RecordingWaiter waiter([&](int id) {
+                    std::lock_guard<std::mutex> lk(mtx);
+                    assignedStreamId = id;
+                    cv.notify_one();
+                });
+                auto streamId = queue.tryToGetIdleStream(waiter);
+                if (!streamId.has_value()) {
+                    std::unique_lock<std::mutex> lk(mtx);
+                    cv.wait(lk, [&assignedStreamId]() { return assignedStreamId.has_value(); });
+                    streamId = assignedStreamId;
+                }
+                if (owners[streamId.value()].fetch_add(1) != 0) {
+                    collision = true;
+                }
+                owners[streamId.value()].fetch_sub(1);
+                queue.returnStream(streamId.value());
+            }
+        });
+    }
+    for (auto& t : clients) {
+        t.join();
+    }
+    EXPECT_FALSE(collision);
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+    EXPECT_TRUE(queue.tryToGetIdleStream().has_value());
+    EXPECT_FALSE(queue.tryToGetIdleStream().has_value());
 }
@@ -196,6 +196,12 @@ TEST_F(OvmsConfigDeathTest, restWorkersDefinedRestPortUndefined) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_workers is set but rest_port is not set");
 }
 
+TEST_F(OvmsConfigDeathTest, imageDecodingThreadsZero) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "8080", "--image_decoding_threads", "0"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "image_decoding_threads count should be from 1 to ");
+}
+
 TEST_F(OvmsConfigDeathTest, invalidRestBindAddress) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "8081", "--port", "8080", "--rest_bind_address", "192.0.2"};
     int arg_count = 9;
@@ -208,6 +214,31 @@ TEST_F(OvmsConfigDeathTest, invalidGrpcBindAddress) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_bind_address has invalid format");
 }
 
+TEST_F(OvmsConfigDeathTest, invalidGrpcUdsPath) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "8080", "--grpc_uds_path", "relative/ovms.sock"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_uds_path has invalid format");
+}
+
+TEST_F(OvmsConfigDeathTest, invalidRestUdsPath) {
+    std::string tooLongPath = "/" + std::string(200, 'a');
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "8080", "--rest_uds_path", (char*)tooLongPath.c_str()};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_uds_path has invalid format");
+}
+
+TEST_F(OvmsConfigDeathTest, negativeSameUdsPaths) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "8080", "--grpc_uds_path", "/tmp/ovms.sock", "--rest_uds_path", "/tmp/ovms.sock"};
+    int arg_count = 9;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_uds_path and rest_uds_path cannot");
+}
+
+TEST_F(OvmsConfigDeathTest, negativeZeroPortsWithoutGrpcUdsPath) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "0", "--rest_uds_path", "/tmp/ovms_rest.sock"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "port and rest_port cannot");
+}
+
 TEST_F(OvmsConfigDeathTest, negativeMultiParams) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--batch_size", "10"};
     int arg_count = 5;
@@ -320,6 +351,8 @@ TEST(OvmsConfigTest, positiveMulti) {
         "--rest_port", "45",
         "--rest_workers", "46",
         "--rest_bind_address", "2.2.2.2",
+        "--rest_pretty_json",
+        "--allow_system_shared_memory",
         "--grpc_channel_arguments", "grpc_channel_args",
         "--file_system_poll_wait_seconds", "2",
         "--sequence_cleaner_poll_wait_minutes", "7",
@@ -330,7 +363,7 @@ TEST(OvmsConfigTest, positiveMulti) {
         "--log_level", "ERROR",
 
         "--config_path", "/config.json"};
-    int arg_count = 31;
+    int arg_count = 33;
     ConstructorEnabledConfig config;
     config.parse(arg_count, n_argv);
 
@@ -340,6 +373,8 @@ TEST(OvmsConfigTest, positiveMulti) {
     EXPECT_EQ(config.restPort(), 45);
     EXPECT_EQ(config.restWorkers(), 46);
     EXPECT_EQ(config.restBindAddress(), "2.2.2.2");
+    EXPECT_TRUE(config.restPrettyJson());
+    EXPECT_TRUE(config.allowSystemSharedMemory());
     EXPECT_EQ(config.grpcChannelArguments(), "grpc_channel_args");
     EXPECT_EQ(config.filesystemPollWaitSeconds(), 2);
     EXPECT_EQ(config.sequenceCleanerPollWaitMinutes(), 7);
@@ -421,6 +456,7 @@ TEST(OvmsConfigTest, positiveSingle) {
     EXPECT_EQ(config.restPort(), 45);
     EXPECT_EQ(config.restWorkers(), 46);
     EXPECT_EQ(config.restBindAddress(), "2.2.2.2");
+    EXPECT_FALSE(config.allowSystemSharedMemory());
     EXPECT_EQ(config.grpcChannelArguments(), "grpc_channel_args");
     EXPECT_EQ(config.filesystemPollWaitSeconds(), 2);
     EXPECT_EQ(config.sequenceCleanerPollWaitMinutes(), 7);
@@ -447,4 +483,24 @@ TEST(OvmsConfigTest, positiveSingle) {
     EXPECT_EQ(config.maxSequenceNumber(), 52);
 }
 
+TEST(OvmsConfigTest, positiveUnixDomainSocketsOnly) {
+    char* n_argv[] = {"ovms",
+        "--port", "0",
+        "--grpc_uds_path", "/tmp/ovms_grpc.sock",
+        "--rest_uds_path", "/tmp/ovms_rest.sock",
+        "--rest_workers", "4",
+        "--metrics_enable",
+        "--config_path", "/config.json"};
+    int arg_count = 12;
+    ConstructorEnabledConfig config;
+    config.parse(arg_count, n_argv);
+
+    EXPECT_EQ(config.port(), 0);
+    EXPECT_EQ(config.restPort(), 0);
+    EXPECT_EQ(config.grpcUdsPath(), "/tmp/ovms_grpc.sock");
+    EXPECT_EQ(config.restUdsPath(), "/tmp/ovms_rest.sock");
+    EXPECT_EQ(config.restWorkers(), 4);
+    EXPECT_TRUE(config.metricsEnabled());
+}
+
 #pragma GCC diagnostic pop
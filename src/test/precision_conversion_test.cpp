@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+
+#include "../precision_conversion.hpp"
+
+using testing::ElementsAre;
+
+static std::vector<float> getTestValues() {
+    std::vector<float> values{0.0f, -0.0f, 1.0f, -1.0f, 0.1f, -2.5f, 3.14159f, 65504.0f, 65519.0f, 65520.0f, 1e6f, -1e6f,
+        6.1e-5f, 6.0e-8f, 3.0e-8f, 1e-10f, 1.17549435e-38f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+    for (int i = -1000; i <= 1000; ++i) {
+        values.push_back(i * 0.37f);
+    }
+    return values;
+}
+
+TEST(PrecisionConversion, SupportedConversions) {
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(ovms::Precision::FP32, ovms::Precision::FP16));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(ovms::Precision::FP32, ovms::Precision::BF16));
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(ovms::Precision::FP32, ovms::Precision::I8));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(ovms::Precision::FP32, ovms::Precision::U8));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(ovms::Precision::FP16, ovms::Precision::FP32));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(ovms::Precision::I32, ovms::Precision::I8));
+}
+
+TEST(PrecisionConversion, Fp32ToFp16MatchesOpenVINO) {
+    auto values = getTestValues();
+    std::vector<uint16_t> converted(values.size());
+    ovms::convertFp32ToFp16(values.data(), converted.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(converted[i], ov::float16(values[i]).to_bits()) << "value: " << values[i];
+    }
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    ovms::convertFp32ToFp16(&nan, converted.data(), 1);
+    EXPECT_TRUE(std::isnan(static_cast<float>(ov::float16::from_bits(converted[0]))));
+}
+
+TEST(PrecisionConversion, Fp32ToBf16MatchesOpenVINO) {
+    auto values = getTestValues();
+    std::vector<uint16_t> converted(values.size());
+    ovms::convertFp32ToBf16(values.data(), converted.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(converted[i], ov::bfloat16(values[i]).to_bits()) << "value: " << values[i];
+    }
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    ovms::convertFp32ToBf16(&nan, converted.data(), 1);
+    EXPECT_TRUE(std::isnan(static_cast<float>(ov::bfloat16::from_bits(converted[0]))));
+}
+
+TEST(PrecisionConversion, Fp32ToI8RoundsAndSaturates) {
+    std::vector<float> values{0.0f, 0.4f, 0.5f, -0.5f, 1.49f, -2.5f, 126.6f, 127.0f, 1000.0f, -128.0f, -1000.0f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+    std::vector<int8_t> converted(values.size());
+    ovms::convertFp32ToI8(values.data(), converted.data(), values.size());
+    EXPECT_THAT(converted, ElementsAre(0, 0, 1, -1, 1, -3, 127, 127, 127, -128, -128, 127, -128, -128));
+}
+
+TEST(PrecisionConversion, ConvertPrecisionRejectsUnsupported) {
+    std::vector<float> source{1.0f, 2.0f};
+    std::vector<uint16_t> target(2);
+    EXPECT_TRUE(ovms::convertPrecision(source.data(), ovms::Precision::FP32, target.data(), ovms::Precision::FP16, source.size()));
+    EXPECT_THAT(target, ElementsAre(0x3C00, 0x4000));
+    EXPECT_FALSE(ovms::convertPrecision(source.data(), ovms::Precision::FP32, target.data(), ovms::Precision::U16, source.size()));
+}
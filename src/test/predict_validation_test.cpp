@@ -800,6 +800,20 @@ TEST_F(KFSPredictValidation, ValidRequest) {
     EXPECT_TRUE(status.ok()) << status.string();
 }
 
+TEST_F(KFSPredictValidation, RequestPrecisionAcceptedForConversion) {
+    auto inputInfo = std::make_shared<ovms::TensorInfo>("Input_FP16_1_10", ovms::Precision::FP16, ovms::shape_t{1, 10}, ovms::Layout{"NC"});
+    servableInputs = ovms::tensor_map_t({{"Input_FP16_1_10", inputInfo}});
+    preparePredictRequest(request,
+        {{"Input_FP16_1_10",
+            std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, 10}, ovms::Precision::FP32}}});
+    auto status = instance->mockValidate(&request);
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_PRECISION) << status.string();
+
+    inputInfo->setAcceptedPrecisions({ovms::Precision::FP32});
+    status = instance->mockValidate(&request);
+    EXPECT_TRUE(status.ok()) << status.string();
+}
+
 TEST_F(KFSPredictValidation, RequestWithScalar) {
     servableInputs = ovms::tensor_map_t({{"Input_FP32_Scalar",
         std::make_shared<ovms::TensorInfo>("Input_FP32_Scalar", ovms::Precision::FP32, ovms::shape_t{}, ovms::Layout{"..."})}});
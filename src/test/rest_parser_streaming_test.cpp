@@ -0,0 +1,176 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../rest_parser.hpp"
+#include "../status.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+using namespace testing;
+using ::testing::ElementsAre;
+
+namespace {
+void assertTFSStreamingSameAsDocument(const std::unordered_map<std::string, ovms::Shape>& tensors, const char* json, ovms::Precision precision = ovms::Precision::FP32) {
+    TFSRestParser streamingParser(prepareTensors(std::unordered_map<std::string, ovms::Shape>(tensors), precision));
+    TFSRestParser documentParser(prepareTensors(std::unordered_map<std::string, ovms::Shape>(tensors), precision));
+    ASSERT_TRUE(streamingParser.parseStreaming(json, std::strlen(json))) << json;
+    ASSERT_EQ(documentParser.parseDocument(json), StatusCode::OK) << json;
+    EXPECT_EQ(streamingParser.getOrder(), documentParser.getOrder()) << json;
+    EXPECT_EQ(streamingParser.getFormat(), documentParser.getFormat()) << json;
+    EXPECT_EQ(streamingParser.getProto().DebugString(), documentParser.getProto().DebugString()) << json;
+}
+
+void assertTFSStreamingRejected(const std::unordered_map<std::string, ovms::Shape>& tensors, const char* json, ovms::Precision precision = ovms::Precision::FP32) {
+    TFSRestParser parser(prepareTensors(std::unordered_map<std::string, ovms::Shape>(tensors), precision));
+    TFSRestParser notUsedParser(prepareTensors(std::unordered_map<std::string, ovms::Shape>(tensors), precision));
+    ASSERT_FALSE(parser.parseStreaming(json, std::strlen(json))) << json;
+    EXPECT_EQ(parser.getOrder(), Order::UNKNOWN) << json;
+    EXPECT_EQ(parser.getFormat(), Format::UNKNOWN) << json;
+    EXPECT_EQ(parser.getProto().DebugString(), notUsedParser.getProto().DebugString()) << json;
+}
+
+void assertKFSStreamingSameAsDocument(const std::string& json) {
+    KFSRestParser streamingParser;
+    KFSRestParser documentParser;
+    ASSERT_TRUE(streamingParser.parseStreaming(json.data(), json.size())) << json;
+    ASSERT_EQ(documentParser.parseDocument(json.data(), json.size()), StatusCode::OK) << json;
+    EXPECT_EQ(streamingParser.getProto().DebugString(), documentParser.getProto().DebugString()) << json;
+}
+
+void assertKFSStreamingRejected(const std::string& json) {
+    KFSRestParser parser;
+    ASSERT_FALSE(parser.parseStreaming(json.data(), json.size())) << json;
+    EXPECT_EQ(parser.getProto().ByteSizeLong(), 0u) << json;
+}
+}  // namespace
+
+TEST(TFSRestParserStreaming, SameResultsAsDocumentParser) {
+    assertTFSStreamingSameAsDocument({{"i", {2, 2}}}, R"({"signature_name":"","inputs":{"i":[[155.0, 9.0], [513.0, -5.0]]}})");
+    assertTFSStreamingSameAsDocument({{"i", {2, 2}}}, R"({"inputs":[[1, 2], [3, 4]], "signature_name":{"a":[1, {"b":null}]}})");
+    assertTFSStreamingSameAsDocument({{"i", {2, 1, 3}}}, R"({"instances":[[[5.0,9.0,2.0]],[[-5.0,-2.0,-10.0]]]})");
+    assertTFSStreamingSameAsDocument({{"i", {3}}}, R"({"instances":[1, 2.5, -3]})");
+    assertTFSStreamingSameAsDocument({{"a", {2, 2}}, {"b", {2, 3}}}, R"({"instances":[
+        {"a":[1, 2], "b":[1, 2, 3]},
+        {"b":[4, 5, 6], "a":[3, 4]}
+    ]})");
+    assertTFSStreamingSameAsDocument({{"a", {1, 2}}, {"b", {1, 3}}}, R"({"inputs":{"b":[[1, 2, 3]]}})");
+    assertTFSStreamingSameAsDocument({{"i", {1, 4}}}, R"({"inputs":[[0, 4294967295, 18446744073709551615, -9223372036854775808]]})", ovms::Precision::U64);
+    assertTFSStreamingSameAsDocument({{"i", {1, 4}}}, R"({"inputs":[[1, -2, 3.7, 300]]})", ovms::Precision::I8);
+    assertTFSStreamingSameAsDocument({{"i", {1, 3}}}, R"({"inputs":[[1, -2, 3.7]]})", ovms::Precision::FP64);
+    assertTFSStreamingSameAsDocument({{"i", {1, 3}}}, R"({"inputs":[[1, -2, 3.7]]})", ovms::Precision::FP16);
+    assertTFSStreamingSameAsDocument({{"i", {1, 3}}}, R"({"inputs":[[1, 2, 3.7]]})", ovms::Precision::U16);
+}
+
+TEST(TFSRestParserStreaming, LearnsShapeFromArrays) {
+    TFSRestParser parser(prepareTensors({{"i", {ovms::Dimension::any(), ovms::Dimension::any()}}}));
+    std::string json = R"({"instances":[)";
+    for (int i = 0; i < 1000; i++) {
+        json += (i ? ",[" : "[") + std::to_string(i) + ", " + std::to_string(-i) + "]";
+    }
+    json += "]}";
+    ASSERT_TRUE(parser.parseStreaming(json.c_str(), json.size()));
+    EXPECT_EQ(parser.getOrder(), Order::ROW);
+    EXPECT_EQ(parser.getFormat(), Format::NONAMED);
+    const auto& input = parser.getProto().inputs().at("i");
+    EXPECT_THAT(asVector(input.tensor_shape()), ElementsAre(1000, 2));
+    auto values = asVector<float>(input.tensor_content());
+    ASSERT_EQ(values.size(), 2000u);
+    EXPECT_EQ(values[1998], 999.0);
+    EXPECT_EQ(values[1999], -999.0);
+}
+
+TEST(TFSRestParserStreaming, LeavesUnsupportedRequestsToDocumentParser) {
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"inputs":{"i":[[{"b64":"ORw0"}]]}})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"instances":[{"b64":"ORw0"}]})", ovms::Precision::U8);
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"inputs":{"i":["abc"]}})", ovms::Precision::U8);
+    assertTFSStreamingRejected({{"sequence_id", {1}}}, R"({"inputs":{"sequence_id":[1]}})");
+    assertTFSStreamingRejected({{"i", {1, 2}}}, R"({"inputs":{"i":[[1, 2]], "unknown":[[1]]}})");
+    assertTFSStreamingRejected({{"i", {1, 2}}}, R"({"inputs":{"i":[[1, 2]], "i":[[1, 2]]}})");
+    assertTFSStreamingRejected({{"i", {2, 2}}}, R"({"inputs":{"i":[[1, 2], [3]]}})");
+    assertTFSStreamingRejected({{"i", {2, 1}}}, R"({"inputs":{"i":[[1], [[3]]]}})");
+    assertTFSStreamingRejected({{"i", {2, 1}}}, R"({"inputs":{"i":[[1], 3]}})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"inputs":{"i":[[]]}})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"inputs":{"i":[[true]]}})");
+    assertTFSStreamingRejected({{"a", {1, 1}}, {"b", {1, 1}}}, R"({"instances":[{"a":[1], "b":[2]}, {"a":[3]}]})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"instances":[[1]], "inputs":[[1]]})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"signature_name":""})");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"({"inputs":[[1]]} trailing)");
+    assertTFSStreamingRejected({{"i", {1, 1}}}, R"([[1]])");
+}
+
+TEST(KFSRestParserStreaming, SameResultsAsDocumentParser) {
+    assertKFSStreamingSameAsDocument(R"({
+        "id": "request",
+        "parameters": {"sequence_id": 3, "sequence_start": true, "name": "x"},
+        "outputs": [{"name": "output0", "parameters": {"binary_data": false}}],
+        "inputs": [
+            {"name": "input0", "shape": [2, 2], "datatype": "FP32", "data": [[1, 2.5], [3, -4]]},
+            {"datatype": "UINT32", "name": "input1", "data": [1, 2, [3]], "shape": [3]},
+            {"name": "input2", "shape": [2], "datatype": "BOOL", "parameters": {"a": 1}, "data": [true, false]},
+            {"name": "input3", "shape": [1], "datatype": "BYTES", "data": ["abc"]},
+            {"name": "input4", "shape": [2], "datatype": "INT64", "data": [-1, 2147483647]},
+            {"name": "input5", "shape": [1], "datatype": "FP64", "data": [0.1]}
+        ],
+        "other": [null, {"inputs": 1}]
+    })");
+    assertKFSStreamingSameAsDocument(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "INT8", "datatype": "FP32", "data": [1]}], "id": "a", "id": 1})");
+    assertKFSStreamingSameAsDocument(R"({"inputs": [{"name": "in", "shape": [1, 2], "datatype": "FP32", "data": [[]]}]})");
+}
+
+TEST(KFSRestParserStreaming, LeavesUnsupportedRequestsToDocumentParser) {
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "data": [1], "datatype": "FP32"}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "FP16", "data": [1]}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "INT32", "data": [1.5]}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "UINT8", "data": [-1]}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "BYTES", "parameters": {"binary_data_size": 3}}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [0], "datatype": "FP32", "data": [1]}]})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "FP32", "data": [1]}], "id": 1})");
+    assertKFSStreamingRejected(R"({"inputs": []})");
+    assertKFSStreamingRejected(R"({"id": "a"})");
+    assertKFSStreamingRejected(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "FP32", "data": [1]}]},)");
+}
+
+TEST(KFSRestParserStreaming, ParseFallsBackToDocumentParser) {
+    KFSRestParser parser;
+    std::string json = R"({"inputs": [{"name": "in", "shape": [1], "data": [1], "datatype": "FP32"}]})";
+    ASSERT_EQ(parser.parse(json.c_str()), StatusCode::OK);
+    ASSERT_EQ(parser.getProto().inputs_size(), 1);
+    EXPECT_THAT(parser.getProto().inputs(0).contents().fp32_contents(), ElementsAre(1.0));
+
+    KFSRestParser invalidParser;
+    EXPECT_EQ(invalidParser.parse(R"({"inputs": [{"name": "in", "shape": [1], "datatype": "FP32", "data": [1]}], "id": 1})"), StatusCode::REST_COULD_NOT_PARSE_INPUT);
+}
+
+TEST(KFSRestParserStreaming, ReservationLimitedByRequestSize) {
+    for (const std::string datatype : {"FP64", "BYTES"}) {
+        KFSRestParser parser;
+        const std::string data = datatype == "BYTES" ? R"(["a"])" : "[1]";
+        std::string json = R"({"inputs": [{"name": "in", "shape": [2147483647], "datatype": ")" + datatype + R"(", "data": )" + data + "}]}";
+        ASSERT_TRUE(parser.parseStreaming(json.data(), json.size())) << json;
+        ASSERT_EQ(parser.getProto().inputs_size(), 1);
+        const auto& contents = parser.getProto().inputs(0).contents();
+        const int capacity = datatype == "BYTES" ? contents.bytes_contents().Capacity() : contents.fp64_contents().Capacity();
+        EXPECT_LE(capacity, static_cast<int>(json.size())) << json;
+    }
+}
@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../rest_url_router.hpp"
+
+using namespace ovms;
+
+TEST(RestUrlRouter, Prediction) {
+    RestUrlComponents components;
+    ASSERT_TRUE(matchPredictionUrl("/v1/models/resnet/versions/12:predict", components));
+    EXPECT_EQ(components.modelName, "resnet");
+    EXPECT_EQ(components.modelVersion, "12");
+    EXPECT_EQ(components.modelVersionLabel, "");
+    EXPECT_EQ(components.processingMethod, "predict");
+
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchPredictionUrl("/v1/models/resnet/labels/stable_1:classify", components));
+    EXPECT_EQ(components.modelName, "resnet");
+    EXPECT_EQ(components.modelVersion, "");
+    EXPECT_EQ(components.modelVersionLabel, "stable_1");
+    EXPECT_EQ(components.processingMethod, "classify");
+
+    EXPECT_TRUE(matchPredictionUrl("x/v1/models/resnet:regress", components));
+    EXPECT_FALSE(matchPredictionUrl("xy/v1/models/resnet:predict", components));
+    EXPECT_FALSE(matchPredictionUrl("/v1/models/resnet:predicted", components));
+    EXPECT_FALSE(matchPredictionUrl("/v1/models/resnet/versions/a:predict", components));
+    EXPECT_FALSE(matchPredictionUrl("/v1/models/:predict", components));
+}
+
+TEST(RestUrlRouter, ModelStatus) {
+    RestUrlComponents components;
+    ASSERT_TRUE(matchModelStatusUrl("/v1/models/resnet/versions/1/metadata", components));
+    EXPECT_EQ(components.modelName, "resnet");
+    EXPECT_EQ(components.modelVersion, "1");
+    EXPECT_EQ(components.modelSubresource, "metadata");
+
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchModelStatusUrl("/v1/models", components));
+    EXPECT_EQ(components.modelName, "");
+
+    // model name is optional, so version may directly follow models segment
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchModelStatusUrl("/v1/models/versions/1", components));
+    EXPECT_EQ(components.modelName, "");
+    EXPECT_EQ(components.modelVersion, "1");
+
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchModelStatusUrl("/v1/models/metadata", components));
+    EXPECT_EQ(components.modelName, "metadata");
+    EXPECT_EQ(components.modelSubresource, "");
+
+    EXPECT_FALSE(matchModelStatusUrl("/v1/models/resnet/status", components));
+    EXPECT_FALSE(matchModelStatusUrl("/v1/models/resnet:predict", components));
+}
+
+TEST(RestUrlRouter, KFSModelEndpoints) {
+    RestUrlComponents components;
+    ASSERT_TRUE(matchKFSInferUrl("/v2/models/resnet:a/versions/3/infer", components));
+    EXPECT_EQ(components.modelName, "resnet:a");
+    EXPECT_EQ(components.modelVersion, "3");
+
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchKFSModelReadyUrl("/v2/models/resnet/ready", components));
+    EXPECT_EQ(components.modelName, "resnet");
+    EXPECT_EQ(components.modelVersion, "");
+
+    components = RestUrlComponents();
+    ASSERT_TRUE(matchKFSModelMetadataUrl("/v2/models/resnet/versions/2/", components));
+    EXPECT_EQ(components.modelName, "resnet");
+    EXPECT_EQ(components.modelVersion, "2");
+
+    EXPECT_FALSE(matchKFSModelMetadataUrl("/v2/models/resnet/ready", components));
+    EXPECT_FALSE(matchKFSInferUrl("/v2/models/resnet/versions/infer", components));
+    EXPECT_FALSE(matchKFSInferUrl("x/v2/models/resnet/infer", components));
+}
+
+TEST(RestUrlRouter, FixedEndpoints) {
+    EXPECT_TRUE(matchConfigReloadUrl("/v1/config/reload"));
+    EXPECT_TRUE(matchConfigStatusUrl("/v1/config"));
+    EXPECT_FALSE(matchConfigStatusUrl("/v1/config/"));
+    EXPECT_TRUE(matchMetricsUrl("/metrics"));
+    EXPECT_TRUE(matchMetricsUrl("//metrics"));
+    EXPECT_FALSE(matchMetricsUrl("\n/metrics"));
+    EXPECT_TRUE(matchKFSServerReadyUrl("/v2/health/ready"));
+    EXPECT_TRUE(matchKFSServerLiveUrl("/v2/health/live"));
+    EXPECT_TRUE(matchKFSServerMetadataUrl("/v2"));
+    EXPECT_FALSE(matchKFSServerMetadataUrl("/v2/"));
+}
+
+TEST(RestUrlRouter, KFSSystemSharedMemory) {
+    RestUrlComponents components;
+    ASSERT_TRUE(matchKFSSystemSharedMemoryStatusUrl("/v2/systemsharedmemory/status", components));
+    EXPECT_EQ(components.sharedMemoryRegionName, "");
+    ASSERT_TRUE(matchKFSSystemSharedMemoryStatusUrl("/v2/systemsharedmemory/region/input_0/status", components));
+    EXPECT_EQ(components.sharedMemoryRegionName, "input_0");
+    ASSERT_TRUE(matchKFSSystemSharedMemoryRegisterUrl("/v2/systemsharedmemory/region/output/register", components));
+    EXPECT_EQ(components.sharedMemoryRegionName, "output");
+    ASSERT_TRUE(matchKFSSystemSharedMemoryUnregisterUrl("/v2/systemsharedmemory/unregister", components));
+    EXPECT_EQ(components.sharedMemoryRegionName, "");
+    ASSERT_TRUE(matchKFSSystemSharedMemoryUnregisterUrl("/v2/systemsharedmemory/region/output/unregister", components));
+    EXPECT_EQ(components.sharedMemoryRegionName, "output");
+    EXPECT_FALSE(matchKFSSystemSharedMemoryRegisterUrl("/v2/systemsharedmemory/register", components));
+    EXPECT_FALSE(matchKFSSystemSharedMemoryRegisterUrl("/v2/systemsharedmemory/region//register", components));
+    EXPECT_FALSE(matchKFSSystemSharedMemoryStatusUrl("/v2/systemsharedmemory/region/status", components));
+    EXPECT_FALSE(matchKFSSystemSharedMemoryStatusUrl("/v2/systemsharedmemory/status/", components));
+    EXPECT_FALSE(matchKFSSystemSharedMemoryUnregisterUrl("/v2/cudasharedmemory/unregister", components));
+}
+
+TEST(RestUrlRouter, SameResultsAsRegularExpressions) {
+    const std::regex predictionRegex(R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))");
+    const std::regex modelstatusRegex(R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata))?)");
+    const std::regex kfsModelMetadataRegex(R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/)?)");
+    const std::vector<std::string> heads{"", "x", "/"};
+    const std::vector<std::string> bases{"/v1/models", "/v2/models"};
+    const std::vector<std::string> names{"", "/m", "/m:x", "/versions", "/metadata"};
+    const std::vector<std::string> versions{"", "/versions/1", "/versions/", "/labels/l", "/labels/a-b"};
+    const std::vector<std::string> tails{"", ":predict", ":x", "/metadata", "/", "//"};
+    for (const auto& head : heads) {
+        for (const auto& base : bases) {
+            for (const auto& name : names) {
+                for (const auto& version : versions) {
+                    for (const auto& tail : tails) {
+                        std::string path = head + base + name + version + tail;
+                        std::smatch sm;
+                        RestUrlComponents components;
+                        bool matched = std::regex_match(path, sm, predictionRegex);
+                        ASSERT_EQ(matchPredictionUrl(path, components), matched) << path;
+                        if (matched) {
+                            EXPECT_EQ(components.modelName, sm[2].str()) << path;
+                            EXPECT_EQ(components.modelVersion, sm[3].str()) << path;
+                            EXPECT_EQ(components.modelVersionLabel, sm[4].str()) << path;
+                        }
+                        components = RestUrlComponents();
+                        matched = std::regex_match(path, sm, modelstatusRegex);
+                        ASSERT_EQ(matchModelStatusUrl(path, components), matched) << path;
+                        if (matched) {
+                            EXPECT_EQ(components.modelName, sm[2].str()) << path;
+                            EXPECT_EQ(components.modelVersion, sm[3].str()) << path;
+                            EXPECT_EQ(components.modelVersionLabel, sm[4].str()) << path;
+                            EXPECT_EQ(components.modelSubresource, sm[5].str()) << path;
+                        }
+                        components = RestUrlComponents();
+                        matched = std::regex_match(path, sm, kfsModelMetadataRegex);
+                        ASSERT_EQ(matchKFSModelMetadataUrl(path, components), matched) << path;
+                        if (matched) {
+                            EXPECT_EQ(components.modelName, sm[1].str()) << path;
+                            EXPECT_EQ(components.modelVersion, sm[2].str()) << path;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -13,9 +13,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <cstring>
+#include <limits>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <rapidjson/document.h>
 
+#include "../capi_frontend/inferenceresponse.hpp"
+#include "../capi_frontend/inferencetensor.hpp"
 #include "../logging.hpp"
 #include "../rest_utils.hpp"
 #include "../status.hpp"
@@ -734,7 +741,7 @@ TEST_F(KFSMakeJsonFromPredictResponseRawTest, CannotConvertInvalidPrecision) {
 }
 
 TEST_F(KFSMakeJsonFromPredictResponseRawTest, Positive) {
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -753,6 +760,52 @@ TEST_F(KFSMakeJsonFromPredictResponseRawTest, Positive) {
 })");
 }
 
+TEST_F(KFSMakeJsonFromPredictResponseRawTest, PositiveCompact) {
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
+    EXPECT_EQ(json, R"({"model_name":"model","id":"id","outputs":[{"name":"output1","shape":[2,1,4],"datatype":"FP32","data":[5.0,10.0,-3.0,2.5,9.0,55.5,-0.5,-1.5]},{"name":"output2","shape":[2,5],"datatype":"INT8","data":[5,2,3,8,-2,-100,0,125,4,-1]}]})");
+}
+
+TEST_F(KFSMakeJsonFromPredictResponseRawTest, CompactWithParametersAndBinaryOutput) {
+    (*proto.mutable_parameters())["sequence_id"].set_int64_param(3);
+    (*output2->mutable_parameters())["a"].set_bool_param(true);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"output1"}), StatusCode::OK);
+    ASSERT_TRUE(inferenceHeaderContentLength.has_value());
+    EXPECT_EQ(json.substr(0, inferenceHeaderContentLength.value()), R"({"model_name":"model","id":"id","parameters":{"sequence_id":3},"outputs":[{"name":"output1","shape":[2,1,4],"datatype":"FP32","parameters":{"binary_data_size":32}},{"name":"output2","shape":[2,5],"datatype":"INT8","data":[5,2,3,8,-2,-100,0,125,4,-1],"parameters":{"a":true}}]})");
+    EXPECT_EQ(json.size(), inferenceHeaderContentLength.value() + sizeof(data1));
+}
+
+TEST_F(KFSMakeJsonFromPredictResponseRawTest, FloatsWrittenWithShortestRepresentation) {
+    const float values[8] = {0.1f, 1.0f / 3, 1e-7f, 3.4028235e38f, -0.0f, 1.5f, 100.0f, -2.0f};
+    proto.mutable_raw_output_contents(0)->assign(reinterpret_cast<const char*>(values), sizeof(values));
+    for (bool pretty : {false, true}) {
+        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, pretty), StatusCode::OK);
+        const std::string expectedData = pretty ? R"("data": [0.1, 0.33333334, 1e-7, 3.4028235e38, -0.0, 1.5, 100.0, -2.0])" : R"("data":[0.1,0.33333334,1e-7,3.4028235e38,-0.0,1.5,100.0,-2.0])";
+        EXPECT_NE(json.find(expectedData), std::string::npos) << json;
+    }
+}
+
+TEST_F(KFSMakeJsonFromPredictResponseRawTest, NonFiniteOutputsWrittenAsNull) {
+    const float floats[8] = {1.5f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity(), 2.0f, -std::numeric_limits<float>::quiet_NaN(), 0.0f, 3.0f};
+    proto.mutable_raw_output_contents(0)->assign(reinterpret_cast<const char*>(floats), sizeof(floats));
+    const double doubles[4] = {std::numeric_limits<double>::quiet_NaN(), 0.5,
+        std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+    output2->set_datatype("FP64");
+    output2->mutable_shape()->Clear();
+    output2->mutable_shape()->Add(4);
+    proto.mutable_raw_output_contents(1)->assign(reinterpret_cast<const char*>(doubles), sizeof(doubles));
+    for (bool pretty : {false, true}) {
+        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, pretty), StatusCode::OK);
+        const std::string expectedFloats = pretty ? R"("data": [1.5, null, null, null, 2.0, null, 0.0, 3.0])" : R"("data":[1.5,null,null,null,2.0,null,0.0,3.0])";
+        const std::string expectedDoubles = pretty ? R"("data": [null, 0.5, null, null])" : R"("data":[null,0.5,null,null])";
+        EXPECT_NE(json.find(expectedFloats), std::string::npos) << json;
+        EXPECT_NE(json.find(expectedDoubles), std::string::npos) << json;
+        rapidjson::Document document;
+        EXPECT_FALSE(document.Parse(json.c_str()).HasParseError()) << json;
+    }
+}
+
 TEST_F(KFSMakeJsonFromPredictResponseRawTest, EmptyRawOutputContentsError) {
     proto.mutable_raw_output_contents()->Clear();
     EXPECT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::REST_SERIALIZE_NO_DATA);
@@ -803,7 +856,7 @@ protected:
         output->set_datatype(datatype);
         auto* output_contents = proto.add_raw_output_contents();
         output_contents->assign(reinterpret_cast<const char*>(&data), sizeof(T));
-        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
         ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     }
 
@@ -814,7 +867,7 @@ protected:
         output_contents->assign(reinterpret_cast<const char*>(&data), sizeof(T));
         std::set<std::string> binaryOutputs;
         binaryOutputs.insert(outputName);
-        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs), StatusCode::OK);
+        ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs, true), StatusCode::OK);
         ASSERT_EQ(inferenceHeaderContentLength.has_value(), true);
     }
 
@@ -857,6 +910,26 @@ TEST_F(KFSMakeJsonFromPredictResponsePrecisionTest, Float_binary) {
     assertDataBinary(data, expectedJson);
 }
 
+TEST_F(KFSMakeJsonFromPredictResponsePrecisionTest, MultipleBinaryOutputsAppendedInOrder) {
+    output->set_datatype("INT32");
+    int32_t firstData = 7;
+    proto.add_raw_output_contents()->assign(reinterpret_cast<const char*>(&firstData), sizeof(firstData));
+    auto* secondOutput = proto.add_outputs();
+    secondOutput->set_name("second");
+    secondOutput->set_datatype("INT16");
+    secondOutput->mutable_shape()->Add(2);
+    std::vector<int16_t> secondData{-1, 3};
+    proto.add_raw_output_contents()->assign(reinterpret_cast<const char*>(secondData.data()), secondData.size() * sizeof(int16_t));
+
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {outputName, "second"}, true), StatusCode::OK);
+    ASSERT_TRUE(inferenceHeaderContentLength.has_value());
+    ASSERT_EQ(json.size(), inferenceHeaderContentLength.value() + sizeof(firstData) + secondData.size() * sizeof(int16_t));
+    const char* binaryData = json.data() + inferenceHeaderContentLength.value();
+    EXPECT_EQ(*reinterpret_cast<const int32_t*>(binaryData), firstData);
+    EXPECT_EQ(*reinterpret_cast<const int16_t*>(binaryData + sizeof(firstData)), -1);
+    EXPECT_EQ(*reinterpret_cast<const int16_t*>(binaryData + sizeof(firstData) + sizeof(int16_t)), 3);
+}
+
 TEST_F(KFSMakeJsonFromPredictResponsePrecisionTest, Double) {
     double data = 50000000000.99;
     prepareData(data, "FP64");
@@ -1129,7 +1202,7 @@ TEST_F(KFSMakeJsonFromPredictResponsePrecisionTest, raw_BYTES_string) {
     output->mutable_shape()->Add(2);  // batch size
     auto* output_contents = proto.add_raw_output_contents();
     output_contents->assign(reinterpret_cast<const char*>(&data), dataSize);
-    auto status = makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength);
+    auto status = makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true);
     ASSERT_EQ(status, StatusCode::OK) << status.string();
     std::string expectedJson = R"({
     "model_name": "model",
@@ -1154,7 +1227,7 @@ TEST_F(KFSMakeJsonFromPredictResponsePrecisionTest, raw_BYTES_string_binary) {
     output->mutable_shape()->Add(2);  // batch size
     auto* output_contents = proto.add_raw_output_contents();
     output_contents->assign(reinterpret_cast<const char*>(&data), dataSize);
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"output"}), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"output"}, true), StatusCode::OK);
     std::string expectedJson = R"({
     "model_name": "model",
     "id": "id",
@@ -1218,7 +1291,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
     bytes_val = bytes_val_proto->mutable_contents()->mutable_bytes_contents()->Add();
     bytes_val->assign("string_2");
 
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     std::string expectedJson = R"({
     "model_name": "model",
     "id": "id",
@@ -1253,7 +1326,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
     bytes_val = bytes_val_proto->mutable_contents()->mutable_bytes_contents()->Add();
     bytes_val->assign("string_2");
 
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"bytes_val_proto"}), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"bytes_val_proto"}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), true);
     std::string expectedJson = R"({
     "model_name": "model",
@@ -1287,7 +1360,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
 }
 
 TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positive) {
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -1309,7 +1382,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
 TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positive_oneOutputsBinary) {
     std::set<std::string> binaryOutputs;
     binaryOutputs.insert("single_uint64_val");
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), true);
     std::string expectedJson = R"({
     "model_name": "model",
@@ -1336,7 +1409,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
     std::set<std::string> binaryOutputs;
     binaryOutputs.insert("single_uint64_val");
     binaryOutputs.insert("two_uint32_vals");
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, binaryOutputs, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), true);
     std::string expectedJson = R"({
     "model_name": "model",
@@ -1370,7 +1443,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Positi
 
 TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_OptionalModelVersion) {
     proto.set_model_version("version");
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -1395,7 +1468,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Option
     (*protoParameters)["key"].set_string_param("param");
     auto outputParameters = single_uint64_val->mutable_parameters();
     (*outputParameters)["key"].set_string_param("param");
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -1425,7 +1498,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Option
     (*protoParameters)["key"].set_int64_param(100);
     auto outputParameters = single_uint64_val->mutable_parameters();
     (*outputParameters)["key"].set_int64_param(100);
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -1455,7 +1528,7 @@ TEST_F(KFSMakeJsonFromPredictResponseValTest, MakeJsonFromPredictResponse_Option
     (*protoParameters)["key"].set_bool_param(true);
     auto outputParameters = single_uint64_val->mutable_parameters();
     (*outputParameters)["key"].set_bool_param(true);
-    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength), StatusCode::OK);
+    ASSERT_EQ(makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
 
     EXPECT_EQ(json, R"({
     "model_name": "model",
@@ -1508,7 +1581,7 @@ protected:
 };
 
 TEST_F(KFSMakeJsonFromPredictResponseStringTest, Positive) {
-    auto status = makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"string_output_1"});
+    auto status = makeJsonFromPredictResponse(proto, &json, inferenceHeaderContentLength, {"string_output_1"}, true);
     ASSERT_EQ(status, StatusCode::OK) << status.string();
 
     ASSERT_EQ(inferenceHeaderContentLength.has_value(), true);
@@ -1537,3 +1610,76 @@ TEST_F(KFSMakeJsonFromPredictResponseStringTest, Positive) {
         14, 0, 0, 0, 'w', 'e', 'l', 'c', 'o', 'm', 'e', ' ', 't', 'o', ' ', 'k', 'f', 's'};
     EXPECT_EQ(std::memcmp(json.substr(inferenceHeaderContentLength.value()).data(), binaryData.data(), 33), 0);
 }
+
+class KFSMakeJsonFromInferenceResponseTest : public ::testing::Test {
+protected:
+    const std::string modelName = "model";
+    InferenceResponse response{modelName, 2};
+    std::string json;
+    std::optional<int> inferenceHeaderContentLength;
+    const float data1[4] = {5.0f, 10.0f, -3.0f, 2.5f};
+    const int64_t data2[2] = {-1, 1000000000000};
+
+    void addOutput(const std::string& name, OVMS_DataType datatype, const std::vector<int64_t>& shape, const void* data, size_t byteSize) {
+        ASSERT_EQ(response.addOutput(name, datatype, shape.data(), shape.size()), StatusCode::OK);
+        const std::string* outputName = nullptr;
+        InferenceTensor* tensor = nullptr;
+        ASSERT_EQ(response.getOutput(response.getOutputCount() - 1, &outputName, &tensor), StatusCode::OK);
+        ASSERT_EQ(tensor->setBuffer(data, byteSize, OVMS_BUFFERTYPE_CPU, std::nullopt, true), StatusCode::OK);
+    }
+
+    void SetUp() override {
+        addOutput("output1", OVMS_DATATYPE_FP32, {2, 2}, data1, sizeof(data1));
+        addOutput("output2", OVMS_DATATYPE_I64, {2}, data2, sizeof(data2));
+    }
+};
+
+TEST_F(KFSMakeJsonFromInferenceResponseTest, Positive) {
+    ASSERT_EQ(makeJsonFromPredictResponse(response, "id", &json, inferenceHeaderContentLength, {}, true), StatusCode::OK);
+    ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
+    EXPECT_EQ(json, R"({
+    "model_name": "model",
+    "id": "id",
+    "model_version": "2",
+    "outputs": [{
+            "name": "output1",
+            "shape": [2, 2],
+            "datatype": "FP32",
+            "data": [5.0, 10.0, -3.0, 2.5]
+        }, {
+            "name": "output2",
+            "shape": [2],
+            "datatype": "INT64",
+            "data": [-1, 1000000000000]
+        }]
+})");
+}
+
+TEST_F(KFSMakeJsonFromInferenceResponseTest, CompactWithBinaryOutput) {
+    ASSERT_EQ(makeJsonFromPredictResponse(response, "", &json, inferenceHeaderContentLength, {"output1"}), StatusCode::OK);
+    ASSERT_TRUE(inferenceHeaderContentLength.has_value());
+    EXPECT_EQ(json.substr(0, inferenceHeaderContentLength.value()), R"({"model_name":"model","model_version":"2","outputs":[{"name":"output1","shape":[2,2],"datatype":"FP32","parameters":{"binary_data_size":16}},{"name":"output2","shape":[2],"datatype":"INT64","data":[-1,1000000000000]}]})");
+    ASSERT_EQ(json.size(), inferenceHeaderContentLength.value() + sizeof(data1));
+    EXPECT_EQ(std::memcmp(json.data() + inferenceHeaderContentLength.value(), data1, sizeof(data1)), 0);
+}
+
+TEST_F(KFSMakeJsonFromInferenceResponseTest, UnsupportedPrecisionError) {
+    const uint16_t half = 0;
+    addOutput("output3", OVMS_DATATYPE_FP16, {1}, &half, sizeof(half));
+    EXPECT_EQ(makeJsonFromPredictResponse(response, "id", &json, inferenceHeaderContentLength), StatusCode::REST_UNSUPPORTED_PRECISION);
+    ASSERT_EQ(inferenceHeaderContentLength.has_value(), false);
+}
+
+TEST_F(KFSMakeJsonFromInferenceResponseTest, InvalidTensorContentSizeError) {
+    const float data[3] = {};
+    addOutput("output3", OVMS_DATATYPE_FP32, {4}, data, sizeof(data));
+    EXPECT_EQ(makeJsonFromPredictResponse(response, "id", &json, inferenceHeaderContentLength), StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE);
+}
+
+TEST(KFSMakeJsonFromInferenceResponse, ErrorWhenNoOutputs) {
+    const std::string modelName = "model";
+    InferenceResponse response(modelName, 1);
+    std::string json;
+    std::optional<int> inferenceHeaderContentLength;
+    EXPECT_EQ(makeJsonFromPredictResponse(response, "id", &json, inferenceHeaderContentLength), StatusCode::REST_PROTO_TO_STRING_ERROR);
+}
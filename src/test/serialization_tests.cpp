@@ -15,7 +15,9 @@
 //*****************************************************************************
 
 #include <array>
+#include <cstring>
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -592,6 +594,46 @@ INSTANTIATE_TEST_SUITE_P(
 
 // C-API
 
+template <typename T>
+static ::KFSResponse::InferOutputTensor serializeTypedContents(ovms::Precision precision, std::vector<T> data) {
+    auto servableOutput = std::make_shared<ovms::TensorInfo>(std::string("out"), precision, ovms::Shape{static_cast<int64_t>(data.size())}, Layout{"C"});
+    ov::Tensor tensor(ovmsPrecisionToIE2Precision(precision), ov::Shape{data.size()}, data.data());
+    ::KFSResponse::InferOutputTensor responseOutput;
+    auto status = serializeTensorToTensorProto(responseOutput, servableOutput, tensor);
+    EXPECT_EQ(status, ovms::StatusCode::OK) << status.string();
+    return responseOutput;
+}
+
+TEST(SerializeKFSTypedContents, SameSizeTypesCopied) {
+    auto output = serializeTypedContents<float>(ovms::Precision::FP32, {1.5, -2.0, 3.25});
+    EXPECT_THAT(output.contents().fp32_contents(), ElementsAre(1.5, -2.0, 3.25));
+    output = serializeTypedContents<int64_t>(ovms::Precision::I64, {-1, std::numeric_limits<int64_t>::max()});
+    EXPECT_THAT(output.contents().int64_contents(), ElementsAre(-1, std::numeric_limits<int64_t>::max()));
+    output = serializeTypedContents<double>(ovms::Precision::FP64, {0.125, -7});
+    EXPECT_THAT(output.contents().fp64_contents(), ElementsAre(0.125, -7));
+}
+
+TEST(SerializeKFSTypedContents, NarrowTypesWidened) {
+    auto output = serializeTypedContents<int8_t>(ovms::Precision::I8, {-128, -1, 0, 127});
+    EXPECT_THAT(output.contents().int_contents(), ElementsAre(-128, -1, 0, 127));
+    output = serializeTypedContents<int16_t>(ovms::Precision::I16, {-32768, 5, 32767});
+    EXPECT_THAT(output.contents().int_contents(), ElementsAre(-32768, 5, 32767));
+    output = serializeTypedContents<uint8_t>(ovms::Precision::U8, {0, 200, 255});
+    EXPECT_THAT(output.contents().uint_contents(), ElementsAre(0, 200, 255));
+    output = serializeTypedContents<uint16_t>(ovms::Precision::U16, {1, 65535});
+    EXPECT_THAT(output.contents().uint_contents(), ElementsAre(1, 65535));
+}
+
+TEST(SerializeKFSTypedContents, Bool) {
+    std::vector<uint8_t> data{1, 0, 1};
+    auto servableOutput = std::make_shared<ovms::TensorInfo>(std::string("out"), ovms::Precision::BOOL, ovms::Shape{3}, Layout{"C"});
+    ov::Tensor tensor(ov::element::boolean, ov::Shape{3}, data.data());
+    ::KFSResponse::InferOutputTensor responseOutput;
+    ASSERT_EQ(serializeTensorToTensorProto(responseOutput, servableOutput, tensor), ovms::StatusCode::OK);
+    EXPECT_EQ(responseOutput.datatype(), "BOOL");
+    EXPECT_THAT(responseOutput.contents().bool_contents(), ElementsAre(true, false, true));
+}
+
 class CAPISerialization : public ::testing::TestWithParam<ovms::Precision> {
 protected:
     tensor_map_t prepareInputs(ovms::Precision precision, ovms::Shape shape = ovms::Shape{1, 10}) {
@@ -753,6 +795,122 @@ TEST_F(CAPISerialization, ValidSerialization) {
     EXPECT_EQ(std::memcmp(tensor.data(), buffer->data(), sizeof(float) * NUMBER_OF_ELEMENTS), 0);
 }
 
+class OutputBindingTest : public ::testing::Test {
+protected:
+    ov::Core ieCore;
+    ov::CompiledModel compiledModel;
+    ov::InferRequest inferRequest;
+    ovms::tensor_map_t outputsInfo;
+
+    void SetUp() override {
+        std::shared_ptr<ov::Model> model = ieCore.read_model(std::filesystem::current_path().u8string() + "/src/test/dummy/1/dummy.xml");
+        compiledModel = ieCore.compile_model(model, "CPU");
+        inferRequest = compiledModel.create_infer_request();
+        outputsInfo[DUMMY_MODEL_OUTPUT_NAME] = std::make_shared<ovms::TensorInfo>(
+            DUMMY_MODEL_OUTPUT_NAME,
+            ovms::Precision::FP32,
+            ovms::Shape{1, 10},
+            Layout{"NC"});
+    }
+
+    void infer(float value) {
+        std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, value);
+        std::memcpy(inferRequest.get_tensor(DUMMY_MODEL_INPUT_NAME).data(), data.data(), data.size() * sizeof(float));
+        inferRequest.infer();
+    }
+
+    void checkContent(const std::string& content, float expectedValue) {
+        ASSERT_EQ(content.size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> actual(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(actual.data(), content.data(), content.size());
+        EXPECT_EQ(actual, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, expectedValue));
+    }
+};
+
+TEST_F(OutputBindingTest, TFSInferenceWritesDirectlyToResponse) {
+    TFPredictResponse response;
+    void* originalData = inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data();
+    {
+        OutputBinding outputBinding(inferRequest);
+        outputBinding.bindOutputs(outputsInfo, &response, true);
+        ASSERT_EQ(outputBinding.getBoundOutputsCount(), 1);
+        infer(3);
+        const auto& content = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME).tensor_content();
+        EXPECT_EQ(inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data(), static_cast<const void*>(content.data()));
+        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        ASSERT_EQ(serializePredictResponse(outputGetter, UNUSED_NAME, UNUSED_VERSION, outputsInfo, &response, getTensorInfoName), ovms::StatusCode::OK);
+    }
+    EXPECT_EQ(inferRequest.get_tensor(DUMMY_MODEL_OUTPUT_NAME).data(), originalData);
+    const auto& output = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+    EXPECT_EQ(output.dtype(), tensorflow::DataType::DT_FLOAT);
+    ASSERT_EQ(output.tensor_shape().dim_size(), 2);
+    checkContent(output.tensor_content(), 4);
+    // subsequent inference does not modify already returned response
+    infer(7);
+    checkContent(output.tensor_content(), 4);
+}
+
+TEST_F(OutputBindingTest, KFSRawOutputContentsBound) {
+    KFSResponse response;
+    {
+        OutputBinding outputBinding(inferRequest);
+        outputBinding.bindOutputs(outputsInfo, &response, true);
+        ASSERT_EQ(outputBinding.getBoundOutputsCount(), 1);
+        infer(3);
+        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        ASSERT_EQ(serializePredictResponse(outputGetter, UNUSED_NAME, UNUSED_VERSION, outputsInfo, &response, getTensorInfoName), ovms::StatusCode::OK);
+    }
+    ASSERT_EQ(response.outputs_size(), 1);
+    ASSERT_EQ(response.raw_output_contents_size(), 1);
+    EXPECT_EQ(response.outputs(0).name(), DUMMY_MODEL_OUTPUT_NAME);
+    EXPECT_EQ(response.outputs(0).datatype(), "FP32");
+    checkContent(response.raw_output_contents(0), 4);
+}
+
+TEST_F(OutputBindingTest, KFSTypedContentsNotBound) {
+    KFSResponse response;
+    OutputBinding outputBinding(inferRequest);
+    outputBinding.bindOutputs(outputsInfo, &response, false);
+    EXPECT_EQ(outputBinding.getBoundOutputsCount(), 0);
+    EXPECT_EQ(response.outputs_size(), 0);
+}
+
+TEST_F(OutputBindingTest, CAPIResponseBufferBound) {
+    InferenceResponse response{"dummy", 1};
+    {
+        OutputBinding outputBinding(inferRequest);
+        outputBinding.bindOutputs(outputsInfo, &response, true);
+        ASSERT_EQ(outputBinding.getBoundOutputsCount(), 1);
+        infer(3);
+        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        ASSERT_EQ(serializePredictResponse(outputGetter, UNUSED_NAME, UNUSED_VERSION, outputsInfo, &response, getTensorInfoName), ovms::StatusCode::OK);
+    }
+    ASSERT_EQ(response.getOutputCount(), 1);
+    const std::string* outputName{nullptr};
+    InferenceTensor* responseOutput{nullptr};
+    ASSERT_EQ(response.getOutput(0, &outputName, &responseOutput), ovms::StatusCode::OK);
+    ASSERT_NE(responseOutput, nullptr);
+    EXPECT_EQ(*outputName, DUMMY_MODEL_OUTPUT_NAME);
+    EXPECT_EQ(responseOutput->getDataType(), OVMS_DATATYPE_FP32);
+    EXPECT_THAT(responseOutput->getShape(), ElementsAre(1, DUMMY_MODEL_INPUT_SIZE));
+    const auto* buffer = responseOutput->getBuffer();
+    ASSERT_NE(buffer, nullptr);
+    checkContent(std::string(static_cast<const char*>(buffer->data()), buffer->getByteSize()), 4);
+}
+
+TEST_F(OutputBindingTest, DynamicShapeOutputNotBound) {
+    outputsInfo[DUMMY_MODEL_OUTPUT_NAME] = std::make_shared<ovms::TensorInfo>(
+        DUMMY_MODEL_OUTPUT_NAME,
+        ovms::Precision::FP32,
+        ovms::Shape{ovms::Dimension::any(), 10},
+        Layout{"NC"});
+    TFPredictResponse response;
+    OutputBinding outputBinding(inferRequest);
+    outputBinding.bindOutputs(outputsInfo, &response, true);
+    EXPECT_EQ(outputBinding.getBoundOutputsCount(), 0);
+    EXPECT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 0);
+}
+
 template <typename T>
 class SerializeString : public ::testing::Test {
 public:
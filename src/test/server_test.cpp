@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 #include <chrono>
+#include <cstring>
 #include <random>
 #include <thread>
 
@@ -21,6 +22,11 @@
 #include <grpcpp/create_channel.h>
 #include <gtest/gtest.h>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
 #include "../cleaner_utils.hpp"
 #include "../dags/node_library.hpp"
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
@@ -342,3 +348,166 @@ TEST(Server, ProperShutdownInCaseOfStartError) {
     t.join();
     // this test should not hang
 }
+
+TEST(Server, AsyncGrpcModelInferAndPredict) {
+    std::string port = "9000";
+    randomizePort(port);
+    char* argv[] = {
+        (char*)"OpenVINO Model Server",
+        (char*)"--model_name",
+        (char*)"dummy",
+        (char*)"--model_path",
+        (char*)"/ovms/src/test/dummy",
+        (char*)"--port",
+        (char*)port.c_str(),
+        (char*)"--grpc_async",
+        (char*)"true",
+        (char*)"--grpc_workers",
+        (char*)"2",
+        nullptr};
+
+    ovms::Server& server = ovms::Server::instance();
+    std::thread t([&argv, &server]() {
+        ASSERT_EQ(EXIT_SUCCESS, server.start(11, argv));
+    });
+    auto start = std::chrono::high_resolution_clock::now();
+    while ((server.getModuleState(SERVABLE_MANAGER_MODULE_NAME) != ovms::ModuleState::INITIALIZED) &&
+           (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - start).count() < 5)) {
+    }
+    // methods not served asynchronously are still available
+    requestServerAlive(port.c_str(), grpc::StatusCode::OK, true);
+    requestModelReady(port.c_str(), "dummy", grpc::StatusCode::OK, true);
+
+    auto channel = grpc::CreateChannel(std::string("localhost:") + port, grpc::InsecureChannelCredentials());
+    std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, 1.0);
+    {
+        auto stub = inference::GRPCInferenceService::NewStub(channel);
+        ClientContext context;
+        KFSRequest request;
+        KFSResponse response;
+        request.set_model_name("dummy");
+        request.set_id("async");
+        auto* input = request.add_inputs();
+        input->set_name(DUMMY_MODEL_INPUT_NAME);
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(DUMMY_MODEL_INPUT_SIZE);
+        request.add_raw_input_contents(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+        auto status = stub->ModelInfer(&context, request, &response);
+        ASSERT_EQ(status.error_code(), grpc::StatusCode::OK) << status.error_message();
+        EXPECT_EQ(response.id(), "async");
+        ASSERT_EQ(response.raw_output_contents_size(), 1);
+        ASSERT_EQ(response.raw_output_contents(0).size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> output(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(output.data(), response.raw_output_contents(0).data(), response.raw_output_contents(0).size());
+        EXPECT_EQ(output, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 2.0));
+
+        ClientContext missingModelContext;
+        request.set_model_name("non_existing");
+        status = stub->ModelInfer(&missingModelContext, request, &response);
+        EXPECT_EQ(status.error_code(), grpc::StatusCode::NOT_FOUND);
+    }
+    {
+        auto stub = tensorflow::serving::PredictionService::NewStub(channel);
+        ClientContext context;
+        tensorflow::serving::PredictRequest request;
+        tensorflow::serving::PredictResponse response;
+        request.mutable_model_spec()->set_name("dummy");
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}},
+            data);
+        auto status = stub->Predict(&context, request, &response);
+        ASSERT_EQ(status.error_code(), grpc::StatusCode::OK) << status.error_message();
+        ASSERT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+        const auto& output = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.tensor_content().size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> outputData(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(outputData.data(), output.tensor_content().data(), output.tensor_content().size());
+        EXPECT_EQ(outputData, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, 2.0));
+    }
+    server.setShutdownRequest(1);
+    t.join();
+    server.setShutdownRequest(0);
+}
+
+TEST(Server, GrpcModelStreamInfer) {
+    std::string port = "9000";
+    randomizePort(port);
+    char* argv[] = {
+        (char*)"OpenVINO Model Server",
+        (char*)"--model_name",
+        (char*)"dummy",
+        (char*)"--model_path",
+        (char*)"/ovms/src/test/dummy",
+        (char*)"--port",
+        (char*)port.c_str(),
+        nullptr};
+
+    ovms::Server& server = ovms::Server::instance();
+    std::thread t([&argv, &server]() {
+        ASSERT_EQ(EXIT_SUCCESS, server.start(7, argv));
+    });
+    auto start = std::chrono::high_resolution_clock::now();
+    while ((server.getModuleState(SERVABLE_MANAGER_MODULE_NAME) != ovms::ModuleState::INITIALIZED) &&
+           (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - start).count() < 5)) {
+    }
+
+    auto stub = inference::GRPCInferenceService::NewStub(grpc::CreateChannel(std::string("localhost:") + port, grpc::InsecureChannelCredentials()));
+    ClientContext context;
+    auto stream = stub->ModelStreamInfer(&context);
+    const int requestsCount = 40;
+    const int missingModelRequest = 7;
+    // requests are written before reading any response so that they are processed concurrently
+    for (int i = 0; i < requestsCount; ++i) {
+        KFSRequest request;
+        request.set_model_name(i == missingModelRequest ? "non_existing" : "dummy");
+        request.set_id(std::to_string(i));
+        auto* input = request.add_inputs();
+        input->set_name(DUMMY_MODEL_INPUT_NAME);
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(DUMMY_MODEL_INPUT_SIZE);
+        std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, i);
+        request.add_raw_input_contents(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+        ASSERT_TRUE(stream->Write(request));
+    }
+    KFSStreamResponse response;
+    for (int i = 0; i < requestsCount; ++i) {
+        ASSERT_TRUE(stream->Read(&response)) << i;
+        EXPECT_EQ(response.infer_response().id(), std::to_string(i));
+        if (i == missingModelRequest) {
+            EXPECT_FALSE(response.error_message().empty());
+            EXPECT_EQ(response.infer_response().raw_output_contents_size(), 0);
+            continue;
+        }
+        ASSERT_TRUE(response.error_message().empty()) << response.error_message();
+        ASSERT_EQ(response.infer_response().raw_output_contents_size(), 1);
+        ASSERT_EQ(response.infer_response().raw_output_contents(0).size(), DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+        std::vector<float> output(DUMMY_MODEL_INPUT_SIZE);
+        std::memcpy(output.data(), response.infer_response().raw_output_contents(0).data(), response.infer_response().raw_output_contents(0).size());
+        EXPECT_EQ(output, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, i + 1));
+    }
+
+    // idle stream does not keep model loaded, guard of the last request is released right after its response is queued
+    auto& manager = dynamic_cast<const ovms::ServableManagerModule*>(server.getModule(SERVABLE_MANAGER_MODULE_NAME))->getServableManager();
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(manager.getModelInstance("dummy", 1, modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+    modelInstanceUnloadGuard.reset();
+    start = std::chrono::high_resolution_clock::now();
+    while (!modelInstance->canUnloadInstance() &&
+           (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - start).count() < 5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(modelInstance->canUnloadInstance());
+
+    ASSERT_TRUE(stream->WritesDone());
+    EXPECT_FALSE(stream->Read(&response));
+    auto status = stream->Finish();
+    EXPECT_EQ(status.error_code(), grpc::StatusCode::OK) << status.error_message();
+    EXPECT_TRUE(modelInstance->canUnloadInstance());
+    server.setShutdownRequest(1);
+    t.join();
+    server.setShutdownRequest(0);
+}
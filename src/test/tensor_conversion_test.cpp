@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../config.hpp"
 #include "../tensor_conversion.hpp"
 #include "opencv2/opencv.hpp"
 #include "test_utils.hpp"
@@ -112,11 +116,19 @@ TYPED_TEST(NativeFileInputConversionTest, tensorWithEmptyTensor) {
 TYPED_TEST(NativeFileInputConversionTest, tensorWithNonSupportedLayout) {
     ov::Tensor tensor;
 
-    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 1, 1, 3}, Layout{"NCHW"});
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 1, 3, 1}, Layout{"NHCW"});
 
     EXPECT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::UNSUPPORTED_LAYOUT);
 }
 
+TYPED_TEST(NativeFileInputConversionTest, tensorWithNonMatchingNumberOfChannelsNCHW) {
+    ov::Tensor tensor;
+
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 1, 1, 1}, Layout{"NCHW"});
+
+    EXPECT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::INVALID_NO_OF_CHANNELS);
+}
+
 TYPED_TEST(NativeFileInputConversionTest, tensorWithNonSupportedPrecision) {
     ov::Tensor tensor;
 
@@ -154,6 +166,48 @@ TYPED_TEST(NativeFileInputConversionTest, positive_rgb) {
     EXPECT_EQ(std::equal(ptr, ptr + tensor.get_size(), rgb_expected_tensor), true);
 }
 
+TYPED_TEST(NativeFileInputConversionTest, positive_rgb_planar_layout) {
+    uint8_t rgb_expected_tensor[] = {0x24, 0x1b, 0xed};
+
+    ov::Tensor tensor;
+
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 3, 1, 1}, Layout{"NCHW"});
+
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({1, 3, 1, 1}));
+    uint8_t* ptr = static_cast<uint8_t*>(tensor.data());
+    EXPECT_EQ(std::equal(ptr, ptr + tensor.get_size(), rgb_expected_tensor), true);
+}
+
+TYPED_TEST(NativeFileInputConversionTest, positive_planar_layout_matches_interleaved_layout) {
+    // resized and converted images written in NCHW layout are transposed images written in NHWC layout
+    const int batchSize = 3;
+    size_t filesize;
+    std::unique_ptr<char[]> image_bytes;
+    read4x4RgbJpg(filesize, image_bytes);
+    TypeParam requestTensor4x4;
+    this->prepareBinaryTensor(requestTensor4x4, image_bytes, filesize, batchSize);
+
+    ov::Tensor interleaved, planar;
+    auto interleavedInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{batchSize, 2, 3, 3}, Layout{"NHWC"});
+    auto planarInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{batchSize, 3, 2, 3}, Layout{"NCHW"});
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor4x4, interleaved, interleavedInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor4x4, planar, planarInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(planar.get_shape(), ov::Shape({batchSize, 3, 2, 3}));
+
+    const float* interleavedData = interleaved.data<float>();
+    const float* planarData = planar.data<float>();
+    for (int n = 0; n < batchSize; n++) {
+        for (int c = 0; c < 3; c++) {
+            for (int h = 0; h < 2; h++) {
+                for (int w = 0; w < 3; w++) {
+                    EXPECT_EQ(planarData[((n * 3 + c) * 2 + h) * 3 + w], interleavedData[((n * 2 + h) * 3 + w) * 3 + c]);
+                }
+            }
+        }
+    }
+}
+
 TYPED_TEST(NativeFileInputConversionTest, positive_grayscale) {
     uint8_t grayscale_expected_tensor[] = {0x00};
 
@@ -444,6 +498,64 @@ TYPED_TEST(NativeFileInputConversionTest, positive_range_resolution_matching_in_
     }
 }
 
+TYPED_TEST(NativeFileInputConversionTest, positive_big_batch_each_image_in_its_slot) {
+    // images of big batch are converted in parallel, each one has to land in its own slot
+    const int batchSize = 33;
+    size_t rgbFilesize, rgb4x4Filesize;
+    std::unique_ptr<char[]> rgbBytes, rgb4x4Bytes;
+    readRgbJpg(rgbFilesize, rgbBytes);
+    read4x4RgbJpg(rgb4x4Filesize, rgb4x4Bytes);
+    TypeParam requestTensor;
+    for (int i = 0; i < batchSize; i++) {
+        if (i % 2 == 0) {
+            this->prepareBinaryTensor(requestTensor, std::string(rgbBytes.get(), rgbFilesize));
+        } else {
+            this->prepareBinaryTensor(requestTensor, std::string(rgb4x4Bytes.get(), rgb4x4Filesize));
+        }
+    }
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{batchSize, 2, 2, 3}, Layout{"NHWC"});
+    ov::Tensor tensor;
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({batchSize, 2, 2, 3}));
+
+    std::vector<cv::Mat> expectedImages;
+    for (const auto& [bytes, filesize] : std::vector<std::pair<char*, size_t>>{{rgbBytes.get(), rgbFilesize}, {rgb4x4Bytes.get(), rgb4x4Filesize}}) {
+        cv::Mat decoded = cv::imdecode(cv::Mat(1, filesize, CV_8U, bytes), cv::IMREAD_UNCHANGED);
+        cv::Mat converted, resized;
+        decoded.convertTo(converted, CV_32F);
+        cv::resize(converted, resized, cv::Size(2, 2));
+        expectedImages.push_back(resized);
+    }
+    const size_t imageSize = 2 * 2 * 3;
+    for (int i = 0; i < batchSize; i++) {
+        const float* expected = reinterpret_cast<const float*>(expectedImages[i % 2].data);
+        const float* actual = tensor.data<float>() + i * imageSize;
+        EXPECT_TRUE(std::equal(actual, actual + imageSize, expected)) << "image: " << i;
+    }
+}
+
+TYPED_TEST(NativeFileInputConversionTest, big_batch_reports_first_failing_image) {
+    const int batchSize = 24;
+    size_t rgbFilesize, grayscaleFilesize;
+    std::unique_ptr<char[]> rgbBytes, grayscaleBytes;
+    readRgbJpg(rgbFilesize, rgbBytes);
+    readImage("/ovms/src/test/binaryutils/grayscale.jpg", grayscaleFilesize, grayscaleBytes);
+    TypeParam requestTensor;
+    for (int i = 0; i < batchSize; i++) {
+        if (i == 17) {
+            this->prepareBinaryTensor(requestTensor, std::string(grayscaleBytes.get(), grayscaleFilesize));
+        } else if (i == 19) {
+            this->prepareBinaryTensor(requestTensor, "not an image");
+        } else {
+            this->prepareBinaryTensor(requestTensor, std::string(rgbBytes.get(), rgbFilesize));
+        }
+    }
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{batchSize, 1, 1, 3}, Layout{"NHWC"});
+    ov::Tensor tensor;
+    EXPECT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::INVALID_NO_OF_CHANNELS);
+    EXPECT_FALSE(tensor);
+}
+
 class NativeFileInputConversionTFSPrecisionTest : public ::testing::TestWithParam<ovms::Precision> {
 protected:
     void SetUp() override {
@@ -685,6 +797,65 @@ TEST_F(NativeFileInputConversionTestKFSRawInputsContents, Negative_invalidFormat
     ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(this->requestTensor, tensor, tensorInfo, &this->buffer), ovms::StatusCode::INVALID_BATCH_SIZE);
 }
 
+class NativeFileInputConversionJpegScaledDecodingTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        parseConfig(true);
+    }
+    void TearDown() override {
+        parseConfig(false);
+    }
+    void parseConfig(bool jpegScaledDecoding) {
+        char* n_argv[] = {(char*)"ovms", (char*)"--model_path", (char*)"/ovms/src/test/dummy", (char*)"--model_name", (char*)"dummy", (char*)"--jpeg_scaled_decoding"};
+        int arg_count = jpegScaledDecoding ? 6 : 5;
+        ovms::Config::instance().parse(arg_count, n_argv);
+    }
+    std::string encodeJpeg(const cv::Mat& image) {
+        std::vector<uchar> encoded;
+        EXPECT_TRUE(cv::imencode(".jpg", image, encoded));
+        return std::string(encoded.begin(), encoded.end());
+    }
+};
+
+TEST_F(NativeFileInputConversionJpegScaledDecodingTest, LargeImagesDecodedCloseToTargetResolution) {
+    ASSERT_TRUE(ovms::Config::instance().jpegScaledDecoding());
+    const cv::Scalar color(10, 100, 200);
+    for (int channels : {1, 3}) {
+        ::KFSRequest::InferInputTensor requestTensor;
+        requestTensor.set_datatype("BYTES");
+        requestTensor.mutable_shape()->Add(2);
+        requestTensor.mutable_contents()->add_bytes_contents(encodeJpeg(cv::Mat(1080, 1920, CV_8UC(channels), color)));
+        requestTensor.mutable_contents()->add_bytes_contents(encodeJpeg(cv::Mat(500, 400, CV_8UC(channels), color)));
+        auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::FP32, ovms::Shape{2, 224, 224, channels}, Layout{"NHWC"});
+        ov::Tensor tensor;
+        ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+        ASSERT_EQ(tensor.get_shape(), ov::Shape({2, 224, 224, static_cast<size_t>(channels)}));
+        const float* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            EXPECT_NEAR(data[i], color[i % channels], 3) << "channels: " << channels << " index: " << i;
+        }
+    }
+}
+
+TEST_F(NativeFileInputConversionJpegScaledDecodingTest, SmallImageDecodedAtFullResolution) {
+    // 4x4 image cannot be decoded at 1/2 scale for 3x3 target, result is the same as without scaled decoding
+    ::KFSRequest::InferInputTensor requestTensor;
+    size_t filesize;
+    std::unique_ptr<char[]> image_bytes;
+    read4x4RgbJpg(filesize, image_bytes);
+    requestTensor.set_datatype("BYTES");
+    requestTensor.mutable_shape()->Add(1);
+    requestTensor.mutable_contents()->add_bytes_contents(image_bytes.get(), filesize);
+    auto tensorInfo = std::make_shared<const TensorInfo>("", ovms::Precision::U8, ovms::Shape{1, 3, 3, 3}, Layout{"NHWC"});
+
+    ov::Tensor scaledDecodingTensor, tensor;
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor, scaledDecodingTensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    parseConfig(false);
+    ASSERT_EQ(convertNativeFileFormatRequestTensorToOVTensor(requestTensor, tensor, tensorInfo, nullptr), ovms::StatusCode::OK);
+    ASSERT_EQ(scaledDecodingTensor.get_byte_size(), tensor.get_byte_size());
+    EXPECT_EQ(std::memcmp(scaledDecodingTensor.data(), tensor.data(), tensor.get_byte_size()), 0);
+}
+
 template <typename TensorType>
 class StringInputsConversionTest : public ::testing::Test {
 public:
@@ -71,6 +71,17 @@ TEST(TestThreadSafeQueue, NoElementsPushed) {
     EXPECT_EQ(std::nullopt, queue.tryPull(WAIT_FOR_ELEMENT_TIMEOUT_MICROSECONDS));
 }
 
+TEST(TestThreadSafeQueue, PullBlocksUntilElementPushed) {
+    ThreadSafeQueue<int> queue;
+    std::thread producerThread([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.push(7);
+    });
+    EXPECT_EQ(7, queue.pull());
+    producerThread.join();
+    EXPECT_EQ(0, queue.size());
+}
+
 const uint ELEMENTS_TO_INSERT = 500;
 
 static void producer(ThreadSafeQueue<int>& queue, std::future<void> startSignal) {
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../worker_pool.hpp"
+
+using ovms::WorkerPool;
+
+TEST(WorkerPool, EachIndexProcessedOnce) {
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.getThreadsCount(), 3);
+    for (size_t count : {0, 1, 2, 4, 100}) {
+        std::vector<std::atomic<int>> calls(count);
+        pool.parallelFor(count, 4, [&calls](size_t index) {
+            calls[index]++;
+        });
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(calls[i].load(), 1) << "count: " << count << " index: " << i;
+        }
+    }
+}
+
+TEST(WorkerPool, WithoutThreadsCallerProcessesAllItems) {
+    WorkerPool pool(0);
+    const auto callerId = std::this_thread::get_id();
+    size_t processed = 0;
+    pool.parallelFor(10, 8, [&](size_t index) {
+        EXPECT_EQ(std::this_thread::get_id(), callerId);
+        processed++;
+    });
+    EXPECT_EQ(processed, 10);
+}
+
+TEST(WorkerPool, MaxParallelismLimitsThreads) {
+    WorkerPool pool(4);
+    std::mutex mtx;
+    std::set<std::thread::id> threadIds;
+    pool.parallelFor(200, 2, [&](size_t index) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        std::unique_lock<std::mutex> lock(mtx);
+        threadIds.insert(std::this_thread::get_id());
+    });
+    EXPECT_LE(threadIds.size(), 2);
+    threadIds.clear();
+    pool.parallelFor(10, 1, [&](size_t index) {
+        std::unique_lock<std::mutex> lock(mtx);
+        threadIds.insert(std::this_thread::get_id());
+    });
+    ASSERT_EQ(threadIds.size(), 1);
+    EXPECT_EQ(*threadIds.begin(), std::this_thread::get_id());
+}
+
+TEST(WorkerPool, ConcurrentCallers) {
+    WorkerPool pool(2);
+    const size_t callersCount = 8;
+    const size_t itemsCount = 50;
+    std::vector<std::atomic<size_t>> sums(callersCount);
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < callersCount; caller++) {
+        callers.emplace_back([&pool, &sums, caller]() {
+            pool.parallelFor(itemsCount, 3, [&sums, caller](size_t index) {
+                sums[caller] += index;
+            });
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (size_t caller = 0; caller < callersCount; caller++) {
+        EXPECT_EQ(sums[caller].load(), itemsCount * (itemsCount - 1) / 2);
+    }
+}
+
+TEST(WorkerPool, SubmittedTasksRunOnPoolThreads) {
+    const auto callerId = std::this_thread::get_id();
+    std::atomic<size_t> processed{0};
+    std::atomic<bool> ranOnCaller{false};
+    {
+        WorkerPool pool(2);
+        for (size_t i = 0; i < 20; i++) {
+            pool.submit([&]() {
+                if (std::this_thread::get_id() == callerId) {
+                    ranOnCaller = true;
+                }
+                processed++;
+            });
+        }
+        // pending tasks are processed before pool is destroyed
+    }
+    EXPECT_EQ(processed.load(), 20);
+    EXPECT_FALSE(ranOnCaller);
+}
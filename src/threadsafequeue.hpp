@@ -57,6 +57,14 @@ public:
         }
     }
 
+    T pull() {
+        std::unique_lock<std::mutex> lock(mtx);
+        signal.wait(lock, [this]() { return queue.size() > 0; });
+        T element = std::move(queue.front());
+        queue.pop();
+        return element;
+    }
+
     size_t size() {
         return queue.size();
     }
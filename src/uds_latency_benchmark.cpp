@@ -0,0 +1,271 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <sysexits.h>
+
+#include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
+#include "src/kfserving_api/grpc_predict_v2.pb.h"
+
+// Measures round trip latency of KServe health requests sent to running model server
+// through loopback TCP and through unix domain sockets. Health requests do almost no
+// work in the server, so the difference comes from the transport.
+namespace {
+
+struct LatencyStats {
+    double mean = 0;
+    double p50 = 0;
+    double p99 = 0;
+};
+
+LatencyStats measureMicroseconds(uint32_t iterations, const std::function<bool()>& function) {
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        auto begin = std::chrono::high_resolution_clock::now();
+        if (!function()) {
+            return {};
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / 1000.0);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    LatencyStats stats;
+    for (double latency : latencies) {
+        stats.mean += latency;
+    }
+    stats.mean /= iterations;
+    stats.p50 = latencies[iterations / 2];
+    stats.p99 = latencies[std::min<size_t>(iterations - 1, iterations * 99 / 100)];
+    return stats;
+}
+
+void printStats(const std::string& name, const LatencyStats& stats) {
+    std::cout << name << ": mean " << stats.mean << " us, p50 " << stats.p50 << " us, p99 " << stats.p99 << " us" << std::endl;
+}
+
+bool measureGrpc(const std::string& target, uint32_t niter, LatencyStats& stats) {
+    auto channel = grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
+    auto stub = inference::GRPCInferenceService::NewStub(channel);
+    auto serverLive = [&stub]() {
+        grpc::ClientContext context;
+        inference::ServerLiveRequest request;
+        inference::ServerLiveResponse response;
+        return stub->ServerLive(&context, request, &response).ok() && response.live();
+    };
+    // first call establishes connection
+    if (!serverLive()) {
+        std::cerr << "gRPC ServerLive request to " << target << " failed" << std::endl;
+        return false;
+    }
+    stats = measureMicroseconds(niter, serverLive);
+    return true;
+}
+
+int connectTcp(const std::string& address, uint32_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1 ||
+        connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int connectUnix(const std::string& path) {
+    struct sockaddr_un addr;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path.c_str(), path.size());
+    if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sends request on keep-alive connection and reads whole response, relying on Content-Length header
+bool httpRoundTrip(int fd, const std::string& request, std::string& buffer) {
+    size_t sent = 0;
+    while (sent < request.size()) {
+        ssize_t count = write(fd, request.data() + sent, request.size() - sent);
+        if (count <= 0) {
+            return false;
+        }
+        sent += count;
+    }
+    buffer.clear();
+    size_t expectedSize = std::string::npos;
+    char chunk[4096];
+    while (expectedSize == std::string::npos || buffer.size() < expectedSize) {
+        ssize_t count = read(fd, chunk, sizeof(chunk));
+        if (count <= 0) {
+            return false;
+        }
+        buffer.append(chunk, count);
+        if (expectedSize == std::string::npos) {
+            size_t headersEnd = buffer.find("\r\n\r\n");
+            if (headersEnd == std::string::npos) {
+                continue;
+            }
+            size_t contentLength = 0;
+            size_t header = buffer.find("Content-Length: ");
+            if (header != std::string::npos && header < headersEnd) {
+                contentLength = std::stoul(buffer.substr(header + strlen("Content-Length: ")));
+            }
+            expectedSize = headersEnd + 4 + contentLength;
+        }
+    }
+    return buffer.compare(0, strlen("HTTP/1.1 200"), "HTTP/1.1 200") == 0;
+}
+
+bool measureRest(int fd, const std::string& name, uint32_t niter, LatencyStats& stats) {
+    if (fd < 0) {
+        std::cerr << "Could not connect to REST server at " << name << std::endl;
+        return false;
+    }
+    const std::string request = "GET /v2/health/live HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n";
+    std::string buffer;
+    auto serverLive = [fd, &request, &buffer]() {
+        return httpRoundTrip(fd, request, buffer);
+    };
+    bool result = serverLive();
+    if (result) {
+        stats = measureMicroseconds(niter, serverLive);
+    } else {
+        std::cerr << "REST health request to " << name << " failed" << std::endl;
+    }
+    close(fd);
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "Loopback TCP and unix domain socket latency benchmark, run against model server started with --grpc_uds_path and --rest_uds_path");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("address",
+            "IPv4 address of the server TCP listeners",
+            cxxopts::value<std::string>()->default_value("127.0.0.1"),
+            "ADDRESS")
+        ("port",
+            "gRPC port of the server, 0 skips gRPC over TCP",
+            cxxopts::value<uint32_t>()->default_value("9178"),
+            "PORT")
+        ("grpc_uds_path",
+            "gRPC unix domain socket of the server, empty skips gRPC over unix domain socket",
+            cxxopts::value<std::string>()->default_value(""),
+            "GRPC_UDS_PATH")
+        ("rest_port",
+            "REST port of the server, 0 skips REST over TCP",
+            cxxopts::value<uint32_t>()->default_value("0"),
+            "REST_PORT")
+        ("rest_uds_path",
+            "REST unix domain socket of the server, empty skips REST over unix domain socket",
+            cxxopts::value<std::string>()->default_value(""),
+            "REST_UDS_PATH")
+        ("niter",
+            "number of requests sent through each transport",
+            cxxopts::value<uint32_t>()->default_value("10000"),
+            "NITER");
+    // clang-format on
+    std::unique_ptr<cxxopts::ParseResult> result;
+    try {
+        result = std::make_unique<cxxopts::ParseResult>(options.parse(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (result->count("help")) {
+        std::cout << options.help() << std::endl;
+        return EX_OK;
+    }
+    const std::string address = result->operator[]("address").as<std::string>();
+    const uint32_t port = result->operator[]("port").as<uint32_t>();
+    const std::string grpcUdsPath = result->operator[]("grpc_uds_path").as<std::string>();
+    const uint32_t restPort = result->operator[]("rest_port").as<uint32_t>();
+    const std::string restUdsPath = result->operator[]("rest_uds_path").as<std::string>();
+    const uint32_t niter = result->operator[]("niter").as<uint32_t>();
+    if (niter == 0) {
+        std::cerr << "niter has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::cout << "iterations: " << niter << std::endl;
+    LatencyStats stats;
+    if (port != 0) {
+        if (!measureGrpc(address + ":" + std::to_string(port), niter, stats)) {
+            return EX_UNAVAILABLE;
+        }
+        printStats("gRPC over TCP", stats);
+    }
+    if (!grpcUdsPath.empty()) {
+        if (!measureGrpc("unix:" + grpcUdsPath, niter, stats)) {
+            return EX_UNAVAILABLE;
+        }
+        printStats("gRPC over unix domain socket", stats);
+    }
+    if (restPort != 0) {
+        if (!measureRest(connectTcp(address, restPort), address + ":" + std::to_string(restPort), niter, stats)) {
+            return EX_UNAVAILABLE;
+        }
+        printStats("REST over TCP", stats);
+    }
+    if (!restUdsPath.empty()) {
+        if (!measureRest(connectUnix(restUdsPath), "unix:" + restUdsPath, niter, stats)) {
+            return EX_UNAVAILABLE;
+        }
+        printStats("REST over unix domain socket", stats);
+    }
+    return EX_OK;
+}
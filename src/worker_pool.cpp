@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace ovms {
+
+struct WorkerPool::ParallelForState {
+    const std::function<void(size_t)>& function;
+    const size_t count;
+    std::atomic<size_t> nextIndex{0};
+    size_t completedCount = 0;
+    std::mutex mtx;
+    std::condition_variable completed;
+
+    ParallelForState(const std::function<void(size_t)>& function, size_t count) :
+        function(function),
+        count(count) {}
+
+    // function is not accessed once all indexes are claimed, so helpers starting late do not touch it
+    void process() {
+        size_t processedCount = 0;
+        for (size_t index = nextIndex++; index < count; index = nextIndex++) {
+            function(index);
+            ++processedCount;
+        }
+        if (processedCount == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        completedCount += processedCount;
+        if (completedCount == count) {
+            completed.notify_all();
+        }
+    }
+
+    void waitForCompletion() {
+        std::unique_lock<std::mutex> lock(mtx);
+        completed.wait(lock, [this]() { return completedCount == count; });
+    }
+};
+
+WorkerPool::WorkerPool(size_t threadsCount) {
+    threads.reserve(threadsCount);
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([this]() { work(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    signal.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            signal.wait(lock, [this]() { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return;
+            }
+            task = std::move(pending.front());
+            pending.pop();
+        }
+        task();
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, size_t maxParallelism, const std::function<void(size_t)>& function) {
+    if (count == 0) {
+        return;
+    }
+    size_t helpersCount = std::min({count, std::max<size_t>(maxParallelism, 1), threads.size() + 1}) - 1;
+    if (helpersCount == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            function(i);
+        }
+        return;
+    }
+    auto state = std::make_shared<ParallelForState>(function, count);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (size_t i = 0; i < helpersCount; ++i) {
+            pending.push([state]() { state->process(); });
+        }
+    }
+    for (size_t i = 0; i < helpersCount; ++i) {
+        signal.notify_one();
+    }
+    state->process();
+    state->waitForCompletion();
+}
+
+void WorkerPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        pending.push(std::move(task));
+    }
+    signal.notify_one();
+}
+}  // namespace ovms
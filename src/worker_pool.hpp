@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ovms {
+
+/**
+ * @brief Fixed number of threads helping callers to process independent items in parallel
+ *
+ * Calling thread always takes part in processing, so calls complete even when all pool
+ * threads are busy with items of other callers.
+ */
+class WorkerPool {
+    struct ParallelForState;
+
+    std::mutex mtx;
+    std::condition_variable signal;
+    std::queue<std::function<void()>> pending;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    void work();
+
+public:
+    /**
+     * @brief Starts pool threads
+     *
+     * @param threadsCount number of pool threads, 0 makes callers process all items alone
+     */
+    WorkerPool(size_t threadsCount);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    size_t getThreadsCount() const { return threads.size(); }
+
+    /**
+     * @brief Calls function for each index from 0 to count - 1 and waits until all calls complete
+     *
+     * @param count number of items
+     * @param maxParallelism maximal number of threads processing items, including calling thread
+     * @param function called concurrently for different indexes, must not throw
+     */
+    void parallelFor(size_t count, size_t maxParallelism, const std::function<void(size_t)>& function);
+
+    /**
+     * @brief Schedules task on pool thread without waiting for its completion
+     *
+     * Tasks pending when pool is destroyed are still processed. Requires at least one pool thread.
+     *
+     * @param task must not throw
+     */
+    void submit(std::function<void()> task);
+};
+}  // namespace ovms
@@ -0,0 +1,44 @@
+#!/bin/bash
+#
+# Copyright (c) 2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Compares throughput of synchronous and asynchronous gRPC serving under high client concurrency.
+# Usage: ./grpc_async_comparison.sh CLIENT_COUNT SYNC_GRPC_WORKERS ASYNC_GRPC_WORKERS [grpc_throughput.sh options]
+
+CLIENT_COUNT=${1}
+SYNC_GRPC_WORKERS=${2}
+ASYNC_GRPC_WORKERS=${3}
+shift 3
+
+IMAGE=${IMAGE:-openvino/model_server:latest}
+GRPC_PORT=${GRPC_PORT:-9178}
+MODEL_PATH=${MODEL_PATH:-$(pwd)/models/resnet50}
+MODEL_NAME=${MODEL_NAME:-resnet}
+
+run_scenario() {
+    NAME=${1}
+    shift 1
+    CONTAINER_ID=$(docker run -d -u $(id -u) -v ${MODEL_PATH}:/models/model -p ${GRPC_PORT}:${GRPC_PORT} ${IMAGE} \
+        --model_name ${MODEL_NAME} --model_path /models/model --port ${GRPC_PORT} $*)
+    # wait for model to be loaded
+    sleep 10
+    echo "=== ${NAME} ==="
+    ./grpc_throughput.sh ${CLIENT_COUNT} --grpc_port ${GRPC_PORT} --model_name ${MODEL_NAME} ${CLIENT_OPTIONS} | tail -n 1
+    docker rm -f ${CONTAINER_ID} > /dev/null
+}
+
+CLIENT_OPTIONS=$*
+run_scenario "sync, grpc_workers=${SYNC_GRPC_WORKERS}" --grpc_workers ${SYNC_GRPC_WORKERS}
+run_scenario "async, grpc_workers=${ASYNC_GRPC_WORKERS}" --grpc_async true --grpc_workers ${ASYNC_GRPC_WORKERS}